@@ -142,6 +142,7 @@ def config_mem(options, system):
     opt_nvm_ranks = getattr(options, "nvm_ranks", None)
     opt_hybrid_channel = getattr(options, "hybrid_channel", False)
     opt_dram_powerdown = getattr(options, "enable_dram_powerdown", None)
+    opt_skip_idle_refresh = getattr(options, "dram_skip_idle_refresh", False)
     opt_mem_channels_intlv = getattr(options, "mem_channels_intlv", 128)
     opt_xor_low_bit = getattr(options, "xor_low_bit", 0)
 
@@ -231,6 +232,7 @@ def config_mem(options, system):
                 # Enable low-power DRAM states if option is set
                 if issubclass(intf, m5.objects.DRAMInterface):
                     dram_intf.enable_dram_powerdown = opt_dram_powerdown
+                    dram_intf.skip_idle_refresh = opt_skip_idle_refresh
 
                 if opt_elastic_trace_en:
                     dram_intf.latency = "1ns"
@@ -163,6 +163,12 @@ def addNoISAOptions(parser):
         action="store_true",
         help="Enable low-power states in DRAMInterface",
     )
+    parser.add_argument(
+        "--dram-skip-idle-refresh",
+        action="store_true",
+        help="Skip the refresh events of DRAM ranks while there is no "
+        "traffic, accounting for the refreshes when traffic resumes",
+    )
     parser.add_argument(
         "--mem-channels-intlv",
         type=int,
@@ -0,0 +1,226 @@
+
+# Copyright (c) 2026 The gem5 Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+import argparse
+
+import m5
+from m5.objects import *
+from m5.util import (
+    addToPath,
+    fatal,
+)
+
+addToPath("../")
+
+from common import (
+    MemConfig,
+    ObjectList,
+)
+
+# This script checks that skip_idle_refresh does not change what the
+# DRAM does. It runs two identical systems side by side, one with the
+# option and one without, and feeds them the same traffic: bursts of
+# reads, sparse reads, and idle periods of up to 30 refresh intervals,
+# with the stats reset in the middle of one of them. At the end, all
+# stats of the DRAM interfaces and their ranks, i.e. the power state
+# residencies and the DRAMPower energies, must match exactly. The
+# refresh energy is a fixed energy per REF command, so matching
+# refresh energies also means matching refresh counts. With
+# --powerdown, the idle periods take the ranks into self-refresh.
+
+parser = argparse.ArgumentParser(
+    formatter_class=argparse.ArgumentDefaultsHelpFormatter
+)
+
+parser.add_argument(
+    "--mem-type",
+    default="DDR3_1600_8x8",
+    choices=ObjectList.mem_list.get_names(),
+    help="type of memory to use",
+)
+
+parser.add_argument(
+    "--mem-ranks", "-r", type=int, default=2, help="Number of ranks"
+)
+
+parser.add_argument(
+    "--page-policy",
+    "-p",
+    choices=m5.objects.PageManage.vals,
+    default="open_adaptive",
+    help="controller page policy",
+)
+
+parser.add_argument(
+    "--powerdown",
+    action="store_true",
+    help="enable DRAM powerdown and self-refresh",
+)
+
+args = parser.parse_args()
+
+# we are fine with 256 MB memory for now
+mem_range = AddrRange("256MB")
+
+# force a single channel, the traffic below is aimed at one controller
+args.mem_channels = 1
+args.external_memory_system = 0
+args.tlm_memory = 0
+args.elastic_trace_en = 0
+
+
+def create_system(skip_idle_refresh):
+    system = System(membus=IOXBar(width=32))
+    system.clk_domain = SrcClockDomain(
+        clock="2.0GHz", voltage_domain=VoltageDomain(voltage="1V")
+    )
+    system.mem_ranges = [mem_range]
+    system.mmap_using_noreserve = True
+
+    MemConfig.config_mem(args, system)
+
+    if not isinstance(system.mem_ctrls[0].dram, m5.objects.DRAMInterface):
+        fatal("This script assumes the memory is a DRAMInterface subclass")
+
+    dram = system.mem_ctrls[0].dram
+    dram.null = True
+    dram.page_policy = args.page_policy
+    dram.enable_dram_powerdown = args.powerdown
+    dram.skip_idle_refresh = skip_idle_refresh
+
+    system.tgen = PyTrafficGen()
+    system.tgen.port = system.membus.cpu_side_ports
+    system.system_port = system.membus.cpu_side_ports
+
+    return system
+
+
+root = Root(full_system=False)
+root.refresh = create_system(False)
+root.skip = create_system(True)
+root.refresh.mem_mode = "timing"
+root.skip.mem_mode = "timing"
+
+dram = root.refresh.mem_ctrls[0].dram
+trefi = int(dram.tREFI.value * 1000000000000)
+tburst = int(dram.tBURST.value * 1000000000000)
+burst_size = int(
+    dram.devices_per_rank.value
+    * dram.device_bus_width.value
+    * dram.burst_length.value
+    / 8
+)
+
+# The traffic uses fixed request intervals and only reads or only
+# writes, so that both generators issue exactly the same requests
+# without drawing from the shared random number generator. Writes come
+# last, as the ones left below the write threshold stay queued and keep
+# the ranks from going idle.
+quarter = mem_range.size() // 4
+phases = [
+    # a burst of reads
+    ("linear", 20000000, 0, 2 * tburst, 100),
+    # idle for 10.5 refresh intervals
+    ("idle", trefi * 21 // 2),
+    # reads a few times per refresh interval
+    ("linear", 8 * trefi, quarter, 2900000, 100),
+    # idle for 30 refresh intervals, reset the stats half way through
+    ("idle", 30 * trefi),
+    # reads at the full bandwidth of the memory
+    ("linear", 5000000, 2 * quarter, tburst, 100),
+    # idle for 2.5 refresh intervals
+    ("idle", trefi * 5 // 2),
+    # a burst of writes
+    ("linear", 10000000, 3 * quarter, 4 * tburst, 0),
+    # idle for 3 refresh intervals
+    ("idle", 3 * trefi),
+]
+
+reset_at = sum(p[1] for p in phases[:3]) + 15 * trefi
+end = sum(p[1] for p in phases)
+
+
+def traffic(tgen):
+    for phase in phases:
+        if phase[0] == "idle":
+            yield tgen.createIdle(phase[1])
+        else:
+            _, duration, start, itt, rd_perc = phase
+            yield tgen.createLinear(
+                duration,
+                start,
+                start + quarter - 1,
+                burst_size,
+                itt,
+                itt,
+                rd_perc,
+                0,
+            )
+
+
+def dram_stats(system):
+    """The stats of the DRAM interface and its ranks, by name"""
+    dram = system.mem_ctrls[0].dram
+    groups = [("", dram)] + [
+        (name + ".", group)
+        for name, group in sorted(dram.getStatGroups().items())
+    ]
+    stats = {}
+    for prefix, group in groups:
+        for stat in group.getStats():
+            value = getattr(stat, "value", getattr(stat, "values", None))
+            # compare the printed values, so that NaNs match
+            stats[prefix + stat.name] = str(value)
+    return stats
+
+
+m5.instantiate()
+
+root.refresh.tgen.start(traffic(root.refresh.tgen))
+root.skip.tgen.start(traffic(root.skip.tgen))
+
+m5.simulate(reset_at)
+m5.stats.reset()
+m5.simulate(end - reset_at)
+m5.stats.dump()
+
+expected = dram_stats(root.refresh)
+actual = dram_stats(root.skip)
+
+mismatches = [
+    name for name in sorted(expected) if expected[name] != actual.get(name)
+]
+for name in mismatches:
+    print(
+        "%s: %s without skipping, %s with skipping"
+        % (name, expected[name], actual.get(name))
+    )
+
+if mismatches:
+    fatal("skip_idle_refresh changed %d DRAM stats" % len(mismatches))
+
+print("DRAM stats match with and without skip_idle_refresh")
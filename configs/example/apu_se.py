@@ -261,6 +261,12 @@ parser.add_argument(
     default=4,
     help="Number of coalescer tokens per CU",
 )
+parser.add_argument(
+    "--cu-skip-idle-cycles",
+    action="store_true",
+    help="Do not tick CUs whose wavefronts are all blocked on memory "
+    "or a barrier",
+)
 parser.add_argument(
     "--vrf_lm_bus_latency",
     type=int,
@@ -506,6 +512,7 @@ for i in range(n_cu):
             localMemBarrier=args.LocalMemBarrier,
             countPages=args.countPages,
             max_cu_tokens=args.max_cu_tokens,
+            skip_idle_cycles=args.cu_skip_idle_cycles,
             vrf_lm_bus_latency=args.vrf_lm_bus_latency,
             mem_req_latency=args.mem_req_latency,
             mem_resp_latency=args.mem_resp_latency,
@@ -987,6 +994,8 @@ else:
     hsaTopology.createRavenTopology(args)
 
 m5.ticks.setGlobalFrequency("1THz")
+if args.ruby_partitions > 1:
+    root.sim_quantum = Ruby.partition_quantum(args, system.ruby.network)
 if args.abs_max_tick:
     maxtick = args.abs_max_tick
 else:
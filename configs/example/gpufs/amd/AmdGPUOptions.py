@@ -211,6 +211,12 @@ def addAmdGPUOptions(parser):
         action="store_true",
         help="Count Page Accesses and output in per-CU output files",
     )
+    parser.add_argument(
+        "--cu-skip-idle-cycles",
+        action="store_true",
+        help="Do not tick CUs whose wavefronts are all blocked on memory "
+        "or a barrier",
+    )
     parser.add_argument(
         "--TLB-prefetch", type=int, help="prefetch depth for TLBs"
     )
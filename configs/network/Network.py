@@ -116,6 +116,13 @@ def define_options(parser):
         default=50000,
         help="network-level deadlock threshold.",
     )
+    parser.add_argument(
+        "--garnet-skip-idle-wakeups",
+        action="store_true",
+        default=False,
+        help="""only wake garnet routers and NIs that can make progress,
+            and let links sleep until their next flit is ready.""",
+    )
     parser.add_argument(
         "--simple-physical-channels",
         action="store_true",
@@ -172,6 +179,7 @@ def init_network(options, network, InterfaceClass):
         network.ni_flit_size = options.link_width_bits / 8
         network.routing_algorithm = options.routing_algorithm
         network.garnet_deadlock_threshold = options.garnet_deadlock_threshold
+        network.skip_idle_wakeups = options.garnet_skip_idle_wakeups
 
         # Create Bridges and connect them to the corresponding links
         for intLink in network.int_links:
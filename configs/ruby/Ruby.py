@@ -46,6 +46,7 @@ from m5.util import (
     addToPath,
     fatal,
 )
+from m5.util.convert import toFrequency
 
 from gem5.isas import ISA
 from gem5.runtime import get_supported_isas
@@ -125,6 +126,27 @@ def define_options(parser):
         help="Recycle latency for ruby controller input buffers",
     )
 
+    parser.add_argument(
+        "--ruby-partitions",
+        type=int,
+        default=1,
+        help="Number of event queues (host threads) to spread the "
+        "memory-side Ruby controllers over. Controllers with sequencers "
+        "stay on event queue 0 together with the network and the "
+        "requestors attached to them. Messages between partitions are "
+        "exchanged at sim_quantum boundaries, so they see at least one "
+        "quantum of latency (see partition_quantum()).",
+    )
+
+    parser.add_argument(
+        "--ruby-direct-warmup",
+        action="store_true",
+        default=False,
+        help="When restoring from a checkpoint, install the recorded "
+        "cache lines directly where the protocol supports it rather than "
+        "replaying the cache trace through the sequencers",
+    )
+
     protocol = buildEnv["PROTOCOL"]
     exec(f"from . import {protocol}")
     eval(f"{protocol}.define_options(parser)")
@@ -159,11 +181,15 @@ def setup_memory_controllers(system, ruby, dir_cntrls, options):
     # for each address range as the abstract memory can handle only one
     # contiguous address range as of now.
     for dir_cntrl in dir_cntrls:
+        # Objects talking to the directory through ports, they must be
+        # simulated by the same event queue as the directory.
+        dir_cntrl._mem_side_objs = []
         crossbar = None
         if len(system.mem_ranges) > 1:
             crossbar = IOXBar()
             crossbars.append(crossbar)
             dir_cntrl.memory_out_port = crossbar.cpu_side_ports
+            dir_cntrl._mem_side_objs.append(crossbar)
 
         dir_ranges = []
         for r in system.mem_ranges:
@@ -186,6 +212,7 @@ def setup_memory_controllers(system, ruby, dir_cntrls, options):
 
             mem_ctrls.append(mem_ctrl)
             dir_ranges.append(dram_intf.range)
+            dir_cntrl._mem_side_objs.append(mem_ctrl)
 
             if crossbar != None:
                 mem_ctrl.port = crossbar.mem_side_ports
@@ -197,6 +224,9 @@ def setup_memory_controllers(system, ruby, dir_cntrls, options):
                 mem_ctrl.dram.enable_dram_powerdown = (
                     options.enable_dram_powerdown
                 )
+                mem_ctrl.dram.skip_idle_refresh = (
+                    options.dram_skip_idle_refresh
+                )
 
         index += 1
         dir_cntrl.addr_ranges = dir_ranges
@@ -286,6 +316,8 @@ def create_system(
 
     setup_memory_controllers(system, ruby, dir_cntrls, options)
 
+    partition_system(options, topology.nodes)
+
     # Connect the cpu sequencers and the piobus
     if piobus != None:
         for cpu_seq in cpu_sequencers:
@@ -294,6 +326,7 @@ def create_system(
     ruby.number_of_virtual_networks = ruby.network.number_of_virtual_networks
     ruby._cpu_ports = cpu_sequencers
     ruby.num_of_sequencers = len(cpu_sequencers)
+    ruby.direct_warmup = options.ruby_direct_warmup
 
     # Create a backing copy of physical memory in case required
     if options.access_backing_store:
@@ -303,6 +336,43 @@ def create_system(
         )
 
 
+def partition_system(options, controllers):
+    """Spread the memory-side controllers over options.ruby_partitions
+    event queues. Ruby controllers only talk to the network through
+    MessageBuffers, which hand messages between event queues at quantum
+    boundaries. Anything connected through ports (sequencers and their
+    requestors, memory controllers) must stay on the controller's queue.
+    Event queue 0 keeps the network, the RubySystem and every controller
+    that owns a RubyPort.
+    """
+    if options.ruby_partitions <= 1:
+        return
+
+    partition = 0
+    for cntrl in controllers:
+        if any(isinstance(obj, RubyPort) for obj in cntrl.descendants()):
+            continue
+
+        queue = 1 + partition % (options.ruby_partitions - 1)
+        partition += 1
+
+        cntrl.eventq_index = queue
+        for obj in getattr(cntrl, "_mem_side_objs", []):
+            obj.eventq_index = queue
+
+
+def partition_quantum(options, network):
+    """Return the simulation quantum in ticks for a partitioned Ruby
+    system. The lookahead is the smallest latency of the links connecting
+    controllers to the network, since a message cannot cross a partition
+    boundary faster than that. Must be called after the global tick
+    frequency has been fixed.
+    """
+    latency = min(int(link.latency) for link in network.ext_links)
+    period = m5.ticks.fromSeconds(1.0 / toFrequency(options.ruby_clock))
+    return max(1, latency) * period
+
+
 def create_directories(options, bootmem, ruby_system, system):
     dir_cntrl_nodes = []
     for i in range(options.num_dirs):
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ARCH_VEGA_INSTS_LANE_OPS_HH__
+#define __ARCH_VEGA_INSTS_LANE_OPS_HH__
+
+#include <cstdint>
+
+#include "arch/amdgpu/vega/gpu_registers.hh"
+#include "base/bitfield.hh"
+
+namespace gem5
+{
+
+namespace VegaISA
+{
+    /**
+     * Whole-register lane kernels for the common VALU operations.
+     *
+     * The per-lane loops in the instruction implementations test the
+     * exec mask for every lane and read each source through the
+     * operand's element accessor, which re-checks for scalar sources and
+     * input modifiers on every access. The kernels below instead take
+     * the exec mask once as a 64-bit value and work on plain arrays.
+     * When every lane is active, which is the common case, the operation
+     * is evaluated in a loop without control flow, which the host
+     * compiler is free to vectorise for whatever target it builds for.
+     * Otherwise it is evaluated for the active lanes only: inactive
+     * lanes may hold anything, and converting such a value to an
+     * integer, for one, is undefined. Inactive lanes keep their previous
+     * contents, so the results are identical to the scalar loops.
+     * Operations whose result the language leaves open for some inputs,
+     * such as the sign of std::fmin(-0.0, 0.0), should stay on the
+     * per-lane loops, as the compiler may settle them differently once
+     * the loop is vectorised.
+     */
+
+    static_assert(NumVecElemPerVecReg <= 64 && NumVecElemPerVecReg % 8 == 0,
+                  "Lane masks must fit in whole bytes of a uint64_t.");
+
+    /**
+     * dst[lane] = op(src[lane]...) for every lane set in mask.
+     */
+    template <typename DstT, typename Op, typename... SrcT>
+    inline void
+    laneMap(DstT *dst, uint64_t mask, Op op, const SrcT *... src)
+    {
+        if (mask == ~0ULL) {
+            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+                dst[lane] = op(src[lane]...);
+            }
+            return;
+        }
+
+        for (; mask; mask &= mask - 1) {
+            int lane = findLsbSet(mask);
+            dst[lane] = op(src[lane]...);
+        }
+    }
+
+    /**
+     * Evaluate the predicate op(src[lane]...) for every lane set in mask
+     * and return the results as a lane bit mask, with lanes not set in
+     * mask cleared.
+     */
+    template <typename Op, typename... SrcT>
+    inline uint64_t
+    laneCompare(uint64_t mask, Op op, const SrcT *... src)
+    {
+        if (mask != ~0ULL) {
+            uint64_t res = 0;
+            for (uint64_t m = mask; m; m &= m - 1) {
+                int lane = findLsbSet(m);
+                res |= (uint64_t)(op(src[lane]...) ? 1 : 0) << lane;
+            }
+            return res;
+        }
+
+        uint8_t pred[NumVecElemPerVecReg];
+        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+            pred[lane] = op(src[lane]...) ? 1 : 0;
+        }
+
+        // gather eight 0/1 bytes at a time into one byte of the result;
+        // the multiply moves byte i's bit to bit 56 + i
+        uint64_t res = 0;
+        for (int lane = 0; lane < NumVecElemPerVecReg; lane += 8) {
+            uint64_t bytes = 0;
+            for (int i = 0; i < 8; ++i) {
+                bytes |= (uint64_t)pred[lane + i] << (8 * i);
+            }
+            res |= ((bytes * 0x0102040810204080ULL) >> 56) << lane;
+        }
+
+        return res & mask;
+    }
+
+    /**
+     * Scratch space for a source operand whose lanes have to be
+     * materialised (scalar source or input modifiers), see
+     * VecOperand::lanes(). Deliberately left uninitialised.
+     */
+    template <typename OperandT>
+    struct LaneBuffer
+    {
+        LaneBuffer() {}
+        typename OperandT::ElemType data[NumVecElemPerVecReg];
+    };
+
+    /**
+     * Operand-level wrappers around laneMap() and laneCompare(). The
+     * sources must already have been read; the destination still has to
+     * be written back by the caller.
+     */
+    template <typename DstOperandT, typename Op, typename... SrcOperandT>
+    inline void
+    vecLaneOp(DstOperandT &vdst, uint64_t mask, Op op,
+              const SrcOperandT &... src)
+    {
+        laneMap(vdst.lanes(), mask, op,
+                src.lanes(LaneBuffer<SrcOperandT>().data)...);
+    }
+
+    template <typename Op, typename... SrcOperandT>
+    inline uint64_t
+    vecLaneCompare(uint64_t mask, Op op, const SrcOperandT &... src)
+    {
+        return laneCompare(mask, op,
+                           src.lanes(LaneBuffer<SrcOperandT>().data)...);
+    }
+} // namespace VegaISA
+} // namespace gem5
+
+#endif // __ARCH_VEGA_INSTS_LANE_OPS_HH__
@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+#include "arch/amdgpu/vega/insts/lane_ops.hh"
+
+using namespace gem5;
+using namespace gem5::VegaISA;
+
+namespace
+{
+
+constexpr int Lanes = NumVecElemPerVecReg;
+
+// Random lane values with a generous sprinkling of the special cases the
+// vectorised kernels must not treat differently from the scalar loops.
+void
+fill(std::mt19937_64 &rng, float *vals)
+{
+    const float special[] = {
+        0.0f, -0.0f, 1.0f, -1.0f,
+        std::numeric_limits<float>::infinity(),
+        -std::numeric_limits<float>::infinity(),
+        std::numeric_limits<float>::quiet_NaN(),
+        -std::numeric_limits<float>::quiet_NaN(),
+        std::numeric_limits<float>::denorm_min(),
+        std::numeric_limits<float>::max(),
+        std::numeric_limits<float>::lowest(),
+    };
+    std::uniform_real_distribution<float> dist(-1e6f, 1e6f);
+    for (int lane = 0; lane < Lanes; ++lane) {
+        if (rng() % 3 == 0) {
+            vals[lane] = special[rng() % std::size(special)];
+        } else {
+            vals[lane] = dist(rng);
+        }
+    }
+}
+
+template <typename T>
+void
+fill(std::mt19937_64 &rng, T *vals)
+{
+    const T special[] = {
+        0, 1, T(-1),
+        std::numeric_limits<T>::max(),
+        std::numeric_limits<T>::min(),
+    };
+    for (int lane = 0; lane < Lanes; ++lane) {
+        if (rng() % 4 == 0) {
+            vals[lane] = special[rng() % std::size(special)];
+        } else {
+            vals[lane] = T(rng());
+        }
+    }
+}
+
+// Lane results must match bit for bit, except that when several inputs
+// of an operation are NaN, which of them propagates is up to the host
+// compiler (it may commute the operands), for the scalar loops as much as
+// for the kernels. Any NaN is accepted for any other NaN.
+template <typename T>
+bool
+sameLanes(const T *expect, const T *actual)
+{
+    for (int lane = 0; lane < Lanes; ++lane) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(expect[lane]) && std::isnan(actual[lane])) {
+                continue;
+            }
+        }
+        if (std::memcmp(&expect[lane], &actual[lane], sizeof(T)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64_t
+randomMask(std::mt19937_64 &rng)
+{
+    switch (rng() % 4) {
+      case 0: return ~0ULL;
+      case 1: return 0;
+      case 2: return rng() & rng();
+      default: return rng();
+    }
+}
+
+// The per-lane loop the kernels replace.
+template <typename D, typename Op, typename... S>
+void
+scalarMap(D *dst, uint64_t mask, Op op, const S *... src)
+{
+    for (int lane = 0; lane < Lanes; ++lane) {
+        if ((mask >> lane) & 1) {
+            dst[lane] = op(src[lane]...);
+        }
+    }
+}
+
+template <typename Op, typename... S>
+uint64_t
+scalarCompare(uint64_t mask, Op op, const S *... src)
+{
+    uint64_t res = 0;
+    for (int lane = 0; lane < Lanes; ++lane) {
+        if ((mask >> lane) & 1) {
+            res |= (uint64_t)(op(src[lane]...) ? 1 : 0) << lane;
+        }
+    }
+    return res;
+}
+
+template <typename D, typename S, typename Op>
+void
+checkBinary(Op op)
+{
+    std::mt19937_64 rng(1234);
+    for (int iter = 0; iter < 1000; ++iter) {
+        S a[Lanes], b[Lanes];
+        D init[Lanes], expect[Lanes], actual[Lanes];
+        fill(rng, a);
+        fill(rng, b);
+        fill(rng, init);
+        uint64_t mask = randomMask(rng);
+
+        std::memcpy(expect, init, sizeof(init));
+        std::memcpy(actual, init, sizeof(init));
+        scalarMap(expect, mask, op, a, b);
+        laneMap(actual, mask, op, a, b);
+
+        ASSERT_TRUE(sameLanes(expect, actual));
+        ASSERT_EQ(scalarCompare(mask, op, a, b),
+                  laneCompare(mask, op, a, b));
+    }
+}
+
+// Minimal stand-in for VecOperand exercising the operand-level wrappers.
+template <typename T>
+struct FakeOperand
+{
+    using ElemType = T;
+
+    T vals[Lanes];
+    bool scalar = false;
+
+    const T *
+    lanes(T *buf) const
+    {
+        if (!scalar) {
+            return vals;
+        }
+        for (int lane = 0; lane < Lanes; ++lane) {
+            buf[lane] = vals[0];
+        }
+        return buf;
+    }
+
+    T *lanes() { return vals; }
+};
+
+} // anonymous namespace
+
+TEST(VegaLaneOpsTest, FloatArith)
+{
+    checkBinary<float, float>([](auto a, auto b) { return a + b; });
+    checkBinary<float, float>([](auto a, auto b) { return b - a; });
+    checkBinary<float, float>([](auto a, auto b) { return a * b; });
+    checkBinary<float, float>(
+        [](auto a, auto b) { return std::fma(a, b, a); });
+}
+
+TEST(VegaLaneOpsTest, FloatCompare)
+{
+    checkBinary<float, float>([](auto a, auto b) { return a < b; });
+    checkBinary<float, float>([](auto a, auto b) { return a == b; });
+    checkBinary<float, float>([](auto a, auto b) { return !(a >= b); });
+    checkBinary<float, float>(
+        [](auto a, auto b) { return std::isnan(a) || std::isnan(b); });
+}
+
+TEST(VegaLaneOpsTest, IntArith)
+{
+    checkBinary<uint32_t, uint32_t>([](auto a, auto b) { return a + b; });
+    checkBinary<uint32_t, uint32_t>([](auto a, auto b) { return a * b; });
+    checkBinary<uint32_t, uint32_t>([](auto a, auto b) { return a ^ b; });
+    checkBinary<uint32_t, uint32_t>(
+        [](auto a, auto b) { return b << (a & 31); });
+    checkBinary<int32_t, int32_t>(
+        [](auto a, auto b) { return b >> (a & 31); });
+    checkBinary<int32_t, int32_t>(
+        [](auto a, auto b) { return std::min(a, b); });
+    checkBinary<uint16_t, uint16_t>([](auto a, auto b) { return a - b; });
+    checkBinary<uint64_t, uint64_t>([](auto a, auto b) { return a + b; });
+}
+
+TEST(VegaLaneOpsTest, IntCompare)
+{
+    checkBinary<uint32_t, uint32_t>([](auto a, auto b) { return a <= b; });
+    checkBinary<int32_t, int32_t>([](auto a, auto b) { return a > b; });
+    checkBinary<int64_t, int64_t>([](auto a, auto b) { return a != b; });
+}
+
+TEST(VegaLaneOpsTest, Convert)
+{
+    std::mt19937_64 rng(42);
+    for (int iter = 0; iter < 1000; ++iter) {
+        float src[Lanes];
+        double expect[Lanes] = {}, actual[Lanes] = {};
+        fill(rng, src);
+        uint64_t mask = randomMask(rng);
+        auto op = [](auto a) { return (double)a; };
+
+        scalarMap(expect, mask, op, src);
+        laneMap(actual, mask, op, src);
+
+        ASSERT_TRUE(sameLanes(expect, actual));
+    }
+}
+
+TEST(VegaLaneOpsTest, OperandWrappers)
+{
+    std::mt19937_64 rng(7);
+    for (int iter = 0; iter < 1000; ++iter) {
+        FakeOperand<uint32_t> src0, src1, vdst;
+        fill(rng, src0.vals);
+        fill(rng, src1.vals);
+        fill(rng, vdst.vals);
+        src0.scalar = rng() % 2;
+        uint64_t mask = randomMask(rng);
+
+        uint32_t expect[Lanes];
+        std::memcpy(expect, vdst.vals, sizeof(expect));
+        uint64_t expect_cmp = 0;
+        for (int lane = 0; lane < Lanes; ++lane) {
+            uint32_t a = src0.scalar ? src0.vals[0] : src0.vals[lane];
+            if ((mask >> lane) & 1) {
+                expect[lane] = a - src1.vals[lane];
+                expect_cmp |= (uint64_t)(a < src1.vals[lane]) << lane;
+            }
+        }
+
+        vecLaneOp(vdst, mask, [](auto a, auto b) { return a - b; },
+                  src0, src1);
+        uint64_t cmp = vecLaneCompare(mask,
+            [](auto a, auto b) { return a < b; }, src0, src1);
+
+        ASSERT_TRUE(sameLanes(expect, vdst.vals));
+        ASSERT_EQ(expect_cmp, cmp);
+    }
+}
+
+TEST(VegaLaneOpsTest, InactiveLanesNotEvaluated)
+{
+    // Inactive lanes may hold values the operation must never see, such
+    // as floats out of the range of the integer they're converted to.
+    std::mt19937_64 rng(99);
+    for (int iter = 0; iter < 1000; ++iter) {
+        uint64_t mask = randomMask(rng);
+        float src[Lanes];
+        fill(rng, src);
+        for (int lane = 0; lane < Lanes; ++lane) {
+            if (!((mask >> lane) & 1)) {
+                src[lane] = std::numeric_limits<float>::quiet_NaN();
+            }
+        }
+
+        uint64_t seen = 0;
+        auto op = [&](const float &a) {
+            seen |= 1ULL << (&a - src);
+            return !std::isnan(a);
+        };
+
+        int32_t dst[Lanes] = {};
+        laneMap(dst, mask, op, src);
+        ASSERT_EQ(mask, seen);
+
+        seen = 0;
+        laneCompare(mask, op, src);
+        ASSERT_EQ(mask, seen);
+    }
+}
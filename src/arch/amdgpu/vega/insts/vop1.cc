@@ -31,6 +31,7 @@
 
 #include "arch/amdgpu/vega/insts/inst_util.hh"
 #include "arch/amdgpu/vega/insts/instructions.hh"
+#include "arch/amdgpu/vega/insts/lane_ops.hh"
 
 namespace gem5
 {
@@ -109,11 +110,8 @@ namespace VegaISA
                 }
             }
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src[lane];
-                }
-            }
+            vecLaneOp(vdst, wf->execMask().to_ullong(),
+                [](auto a) { return a; }, src);
         }
 
         vdst.write();
@@ -226,11 +224,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF64)a; }, src);
 
         vdst.write();
     } // execute
@@ -258,11 +253,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF32)a; }, src);
 
         vdst.write();
     } // execute
@@ -290,11 +282,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF32)a; }, src);
 
         vdst.write();
     } // execute
@@ -509,11 +498,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemI32)std::floor(src[lane] + 0.5);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemI32)std::floor(a + 0.5); }, src);
 
         vdst.write();
     } // execute
@@ -542,11 +528,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemI32)std::floor(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemI32)std::floor(a); }, src);
 
         vdst.write();
     } // execute
@@ -595,11 +578,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF32)a; }, src);
 
         vdst.write();
     } // execute
@@ -627,11 +607,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF64)a; }, src);
 
         vdst.write();
     } // execute
@@ -659,11 +636,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)(bits(src[lane], 7, 0));
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF32)(bits(a, 7, 0)); }, src);
 
         vdst.write();
     } // execute
@@ -691,11 +665,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)(bits(src[lane], 15, 8));
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF32)(bits(a, 15, 8)); }, src);
 
         vdst.write();
     } // execute
@@ -723,11 +694,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)(bits(src[lane], 23, 16));
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF32)(bits(a, 23, 16)); }, src);
 
         vdst.write();
     } // execute
@@ -755,11 +723,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)(bits(src[lane], 31, 24));
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF32)(bits(a, 31, 24)); }, src);
 
         vdst.write();
     } // execute
@@ -835,11 +800,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF64)a; }, src);
 
         vdst.write();
     } // execute
@@ -867,11 +829,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::trunc(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::trunc(a); }, src);
 
         vdst.write();
     } // execute
@@ -900,11 +859,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::ceil(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::ceil(a); }, src);
 
         vdst.write();
     } // execute
@@ -932,11 +888,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = roundNearestEven(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return roundNearestEven(a); }, src);
 
         vdst.write();
     } // execute
@@ -965,11 +918,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::floor(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::floor(a); }, src);
 
         vdst.write();
     } // execute
@@ -1030,11 +980,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::trunc(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::trunc(a); }, src);
 
         vdst.write();
     } // execute
@@ -1063,11 +1010,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::ceil(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::ceil(a); }, src);
 
         vdst.write();
     } // execute
@@ -1095,11 +1039,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = roundNearestEven(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return roundNearestEven(a); }, src);
 
         vdst.write();
     } // execute
@@ -1128,11 +1069,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::floor(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::floor(a); }, src);
 
         vdst.write();
     } // execute
@@ -1160,11 +1098,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::pow(2.0, src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::pow(2.0, a); }, src);
 
         vdst.write();
     } // execute
@@ -1192,11 +1127,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::log2(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::log2(a); }, src);
 
         vdst.write();
     } // execute
@@ -1224,11 +1156,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = 1.0 / src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return 1.0 / a; }, src);
 
         vdst.write();
     } // execute
@@ -1258,11 +1187,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = 1.0 / src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return 1.0 / a; }, src);
 
         vdst.write();
     } // execute
@@ -1290,11 +1216,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = 1.0 / std::sqrt(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return 1.0 / std::sqrt(a); }, src);
 
         vdst.write();
     } // execute
@@ -1409,11 +1332,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::sqrt(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::sqrt(a); }, src);
 
         vdst.write();
     } // execute
@@ -1441,11 +1361,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::sqrt(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::sqrt(a); }, src);
 
         vdst.write();
     } // execute
@@ -1553,11 +1470,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = ~src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return ~a; }, src);
 
         vdst.write();
     } // execute
@@ -1585,11 +1499,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = reverseBits(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return reverseBits(a); }, src);
 
         vdst.write();
     } // execute
@@ -1617,11 +1528,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = findFirstOneMsb(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return findFirstOneMsb(a); }, src);
 
         vdst.write();
     } // execute
@@ -1649,11 +1557,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = findFirstOne(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return findFirstOne(a); }, src);
 
         vdst.write();
     } // execute
@@ -1681,11 +1586,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = firstOppositeSignBit(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return firstOppositeSignBit(a); }, src);
 
         vdst.write();
     } // execute
@@ -1929,11 +1831,8 @@ namespace VegaISA
         panic_if(isDPPInst(), "DPP unimplemented for v_mov_b64");
         panic_if(isSDWAInst(), "SDWA unimplemented for v_mov_b64");
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return a; }, src);
 
         vdst.write();
     } // execute
@@ -2359,11 +2258,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::pow(2.0, src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::pow(2.0, a); }, src);
 
         vdst.write();
     } // execute
@@ -2391,11 +2287,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::log2(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::log2(a); }, src);
 
         vdst.write();
     } // execute
@@ -2423,11 +2316,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return a; }, src);
 
         vdst.write();
     } // execute
@@ -31,6 +31,7 @@
 
 #include "arch/amdgpu/vega/insts/inst_util.hh"
 #include "arch/amdgpu/vega/insts/instructions.hh"
+#include "arch/amdgpu/vega/insts/lane_ops.hh"
 #include "debug/VEGA.hh"
 
 namespace gem5
@@ -127,11 +128,8 @@ namespace VegaISA
                 }
             }
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] + src1[lane];
-                }
-            }
+            vecLaneOp(vdst, wf->execMask().to_ullong(),
+                [](auto a, auto b) { return a + b; }, src0, src1);
         }
 
         vdst.write();
@@ -163,11 +161,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a - b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -198,11 +193,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b - a; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -232,11 +224,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a * b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -344,12 +333,11 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = sext<24>(bits(src0[lane], 23, 0))
-                    * sext<24>(bits(src1[lane], 23, 0));
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) {
+                return sext<24>(bits(a, 23, 0))
+                    * sext<24>(bits(b, 23, 0));
+            }, src0, src1);
 
         vdst.write();
     } // execute
@@ -410,12 +398,11 @@ namespace VegaISA
     {
         auto opImpl = [](VecOperandU32& src0, VecOperandU32& src1,
                          VecOperandU32& vdst, Wavefront* wf) {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = bits(src0[lane], 23, 0) *
-                                 bits(src1[lane], 23, 0);
-                }
-            }
+            vecLaneOp(vdst, wf->execMask().to_ullong(),
+                [](auto a, auto b) {
+                    return bits(a, 23, 0) *
+                        bits(b, 23, 0);
+                }, src0, src1);
         };
 
         vop2Helper<ConstVecOperandU32, VecOperandU32>(gpuDynInst, opImpl);
@@ -548,11 +535,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return std::min(a, b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -581,11 +565,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return std::max(a, b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -614,11 +595,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return std::min(a, b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -647,11 +625,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return std::max(a, b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -682,11 +657,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 4, 0);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b >> bits(a, 4, 0); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -717,11 +689,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 4, 0);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b >> bits(a, 4, 0); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -791,11 +760,8 @@ namespace VegaISA
 
             processSDWA_dst(extData.iFmt_VOP_SDWA, vdst, origVdst);
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src1[lane] << bits(src0[lane], 4, 0);
-                }
-            }
+            vecLaneOp(vdst, wf->execMask().to_ullong(),
+                [](auto a, auto b) { return b << bits(a, 4, 0); }, src0, src1);
         }
 
         vdst.write();
@@ -851,11 +817,8 @@ namespace VegaISA
                 }
             }
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] & src1[lane];
-                }
-            }
+            vecLaneOp(vdst, wf->execMask().to_ullong(),
+                [](auto a, auto b) { return a & b; }, src0, src1);
         }
 
         vdst.write();
@@ -926,11 +889,8 @@ namespace VegaISA
 
             processSDWA_dst(extData.iFmt_VOP_SDWA, vdst, origVdst);
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] | src1[lane];
-                }
-            }
+            vecLaneOp(vdst, wf->execMask().to_ullong(),
+                [](auto a, auto b) { return a | b; }, src0, src1);
         }
 
         vdst.write();
@@ -961,11 +921,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] ^ src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a ^ b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1598,11 +1555,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a + b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1632,11 +1586,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a - b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1667,11 +1618,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b - a; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1701,11 +1649,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a * b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1735,11 +1680,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] << bits(src0[lane], 3, 0);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b << bits(a, 3, 0); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1770,11 +1712,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> src0[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b >> a; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1805,11 +1744,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> src0[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b >> a; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1882,11 +1818,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return std::max(a, b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1915,11 +1848,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return std::max(a, b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1948,11 +1878,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return std::min(a, b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1981,11 +1908,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return std::min(a, b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -2074,11 +1998,8 @@ namespace VegaISA
 
             processSDWA_dst(extData.iFmt_VOP_SDWA, vdst, origVdst);
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] + src1[lane];
-                }
-            }
+            vecLaneOp(vdst, wf->execMask().to_ullong(),
+                [](auto a, auto b) { return a + b; }, src0, src1);
         }
 
         vdst.write();
@@ -2108,11 +2029,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a - b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -2141,11 +2059,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b - a; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -2209,11 +2124,8 @@ namespace VegaISA
         src1.read();
         vdst.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = ~(src0[lane] ^ src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return ~(a ^ b); }, src0, src1);
 
         vdst.write();
     } // execute
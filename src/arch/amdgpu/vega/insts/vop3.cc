@@ -32,6 +32,7 @@
 #include "arch/amdgpu/common/dtype/mxfp_types.hh"
 #include "arch/amdgpu/vega/insts/inst_util.hh"
 #include "arch/amdgpu/vega/insts/instructions.hh"
+#include "arch/amdgpu/vega/insts/lane_ops.hh"
 
 namespace gem5
 {
@@ -124,11 +125,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a + b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -181,11 +179,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a - b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -238,11 +233,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b - a; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -483,12 +475,11 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = sext<24>(bits(src0[lane], 23, 0))
-                    * sext<24>(bits(src1[lane], 23, 0));
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) {
+                return sext<24>(bits(a, 23, 0))
+                    * sext<24>(bits(b, 23, 0));
+            }, src0, src1);
 
         vdst.write();
     } // execute
@@ -575,11 +566,10 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = bits(src0[lane], 23, 0) * bits(src1[lane], 23, 0);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) {
+                return bits(a, 23, 0) * bits(b, 23, 0);
+            }, src0, src1);
 
         vdst.write();
     } // execute
@@ -775,11 +765,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return std::min(a, b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -818,11 +805,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return std::max(a, b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -861,11 +845,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return std::min(a, b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -904,11 +885,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return std::max(a, b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -949,11 +927,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 4, 0);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b >> bits(a, 4, 0); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -994,11 +969,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 4, 0);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b >> bits(a, 4, 0); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1038,11 +1010,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] << bits(src0[lane], 4, 0);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b << bits(a, 4, 0); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1082,11 +1051,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] & src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a & b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1126,11 +1092,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] | src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a | b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1172,11 +1135,10 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] | src1[lane] | src2[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return a | b | c;
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -1216,11 +1178,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] ^ src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a ^ b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1734,11 +1693,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a + b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1778,11 +1734,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a - b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1823,11 +1776,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b - a; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1867,11 +1817,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a * b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1911,11 +1858,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] << bits(src0[lane], 3, 0);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b << bits(a, 3, 0); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1962,11 +1906,8 @@ namespace VegaISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 3, 0);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b >> bits(a, 3, 0); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -2007,11 +1948,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 3, 0);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b >> bits(a, 3, 0); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -2100,11 +2038,8 @@ namespace VegaISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return std::max(a, b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -2149,11 +2084,8 @@ namespace VegaISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return std::max(a, b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -2198,11 +2130,8 @@ namespace VegaISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return std::min(a, b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -2247,11 +2176,8 @@ namespace VegaISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return std::min(a, b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -2310,11 +2236,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a + b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -2353,11 +2276,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a - b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -2396,11 +2316,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b - a; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -2514,11 +2431,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return a; }, src);
 
         vdst.write();
     } // execute
@@ -2608,11 +2522,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF64)a; }, src);
 
         vdst.write();
     } // execute
@@ -2650,11 +2561,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF32)a; }, src);
 
         vdst.write();
     } // execute
@@ -2690,11 +2598,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF32)a; }, src);
 
         vdst.write();
     } // execute
@@ -2975,11 +2880,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemI32)std::floor(src[lane] + 0.5);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemI32)std::floor(a + 0.5); }, src);
 
         vdst.write();
     } // execute
@@ -3016,11 +2918,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemI32)std::floor(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemI32)std::floor(a); }, src);
 
         vdst.write();
     } // execute
@@ -3085,11 +2984,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF32)a; }, src);
 
         vdst.write();
     } // execute
@@ -3133,11 +3029,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF64)a; }, src);
 
         vdst.write();
     } // execute
@@ -3173,11 +3066,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)bits(src[lane], 7, 0);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF32)bits(a, 7, 0); }, src);
 
         vdst.write();
     } // execute
@@ -3213,11 +3103,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)bits(src[lane], 15, 8);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF32)bits(a, 15, 8); }, src);
 
         vdst.write();
     } // execute
@@ -3253,11 +3140,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)bits(src[lane], 23, 16);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF32)bits(a, 23, 16); }, src);
 
         vdst.write();
     } // execute
@@ -3293,11 +3177,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)bits(src[lane], 31, 24);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF32)bits(a, 31, 24); }, src);
 
         vdst.write();
     } // execute
@@ -3389,11 +3270,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return (VecElemF64)a; }, src);
 
         vdst.write();
     } // execute
@@ -3429,11 +3307,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::trunc(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::trunc(a); }, src);
 
         vdst.write();
     } // execute
@@ -3470,11 +3345,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::ceil(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::ceil(a); }, src);
 
         vdst.write();
     } // execute
@@ -3510,11 +3382,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = roundNearestEven(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return roundNearestEven(a); }, src);
 
         vdst.write();
     } // execute
@@ -3551,11 +3420,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::floor(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::floor(a); }, src);
 
         vdst.write();
     } // execute
@@ -3632,11 +3498,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::trunc(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::trunc(a); }, src);
 
         vdst.write();
     } // execute
@@ -3673,11 +3536,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::ceil(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::ceil(a); }, src);
 
         vdst.write();
     } // execute
@@ -3713,11 +3573,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = roundNearestEven(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return roundNearestEven(a); }, src);
 
         vdst.write();
     } // execute
@@ -3754,11 +3611,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::floor(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::floor(a); }, src);
 
         vdst.write();
     } // execute
@@ -3794,11 +3648,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::pow(2.0, src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::pow(2.0, a); }, src);
 
         vdst.write();
     } // execute
@@ -3842,11 +3693,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::log2(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::log2(a); }, src);
 
         vdst.write();
     } // execute
@@ -3882,11 +3730,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = 1.0 / src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return 1.0 / a; }, src);
 
         vdst.write();
     } // execute
@@ -3924,11 +3769,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = 1.0 / src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return 1.0 / a; }, src);
 
         vdst.write();
     } // execute
@@ -3964,11 +3806,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = 1.0 / std::sqrt(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return 1.0 / std::sqrt(a); }, src);
 
         vdst.write();
     } // execute
@@ -4106,11 +3945,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::sqrt(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::sqrt(a); }, src);
 
         vdst.write();
     } // execute
@@ -4146,11 +3982,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::sqrt(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::sqrt(a); }, src);
 
         vdst.write();
     } // execute
@@ -4274,11 +4107,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = ~src[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return ~a; }, src);
 
         vdst.write();
     } // execute
@@ -4306,11 +4136,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = reverseBits(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return reverseBits(a); }, src);
 
         vdst.write();
     } // execute
@@ -4346,11 +4173,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = findFirstOneMsb(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return findFirstOneMsb(a); }, src);
 
         vdst.write();
     } // execute
@@ -4386,11 +4210,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = findFirstOne(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return findFirstOne(a); }, src);
 
         vdst.write();
     } // execute
@@ -4426,11 +4247,8 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = firstOppositeSignBit(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return firstOppositeSignBit(a); }, src);
 
         vdst.write();
     } // execute
@@ -5120,11 +4938,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::pow(2.0, src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::pow(2.0, a); }, src);
 
         vdst.write();
     } // execute
@@ -5152,11 +4967,8 @@ namespace VegaISA
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::log2(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a) { return std::log2(a); }, src);
 
         vdst.write();
     } // execute
@@ -5213,11 +5025,10 @@ namespace VegaISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return std::fma(a, b, c);
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -5274,11 +5085,10 @@ namespace VegaISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return std::fma(a, b, c);
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -5320,12 +5130,11 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = sext<24>(bits(src0[lane], 23, 0))
-                    * sext<24>(bits(src1[lane], 23, 0)) + src2[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return sext<24>(bits(a, 23, 0))
+                    * sext<24>(bits(b, 23, 0)) + c;
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -5367,12 +5176,11 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = bits(src0[lane], 23, 0) * bits(src1[lane], 23, 0)
-                    + src2[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return bits(a, 23, 0) * bits(b, 23, 0)
+                    + c;
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -5498,12 +5306,11 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (src0[lane] >> bits(src1[lane], 4, 0))
-                    & ((1 << bits(src2[lane], 4, 0)) - 1);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return (a >> bits(b, 4, 0))
+                    & ((1 << bits(c, 4, 0)) - 1);
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -5598,12 +5405,11 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (src0[lane] & src1[lane]) | (~src0[lane]
-                    & src2[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return (a & b) | (~a
+                    & c);
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -5660,11 +5466,10 @@ namespace VegaISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return std::fma(a, b, c);
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -5721,11 +5526,10 @@ namespace VegaISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return std::fma(a, b, c);
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -6383,18 +6187,17 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::abs(bits(src0[lane], 31, 24)
-                    - bits(src1[lane], 31, 24))
-                    + std::abs(bits(src0[lane], 23, 16)
-                    - bits(src1[lane], 23, 16))
-                    + std::abs(bits(src0[lane], 15, 8)
-                    - bits(src1[lane], 15, 8))
-                    + std::abs(bits(src0[lane], 7, 0)
-                    - bits(src1[lane], 7, 0)) + src2[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return std::abs(bits(a, 31, 24)
+                    - bits(b, 31, 24))
+                    + std::abs(bits(a, 23, 16)
+                    - bits(b, 23, 16))
+                    + std::abs(bits(a, 15, 8)
+                    - bits(b, 15, 8))
+                    + std::abs(bits(a, 7, 0)
+                    - bits(b, 7, 0)) + c;
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -6436,15 +6239,14 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (((bits(src0[lane], 31, 24)
-                    - bits(src1[lane], 31, 24)) + (bits(src0[lane], 23, 16)
-                    - bits(src1[lane], 23, 16)) + (bits(src0[lane], 15, 8)
-                    - bits(src1[lane], 15, 8)) + (bits(src0[lane], 7, 0)
-                    - bits(src1[lane], 7, 0))) << 16) + src2[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return (((bits(a, 31, 24)
+                    - bits(b, 31, 24)) + (bits(a, 23, 16)
+                    - bits(b, 23, 16)) + (bits(a, 15, 8)
+                    - bits(b, 15, 8)) + (bits(a, 7, 0)
+                    - bits(b, 7, 0))) << 16) + c;
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -6487,14 +6289,13 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::abs(bits(src0[lane], 31, 16)
-                    - bits(src1[lane], 31, 16))
-                    + std::abs(bits(src0[lane], 15, 0)
-                    - bits(src1[lane], 15, 0)) + src2[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return std::abs(bits(a, 31, 16)
+                    - bits(b, 31, 16))
+                    + std::abs(bits(a, 15, 0)
+                    - bits(b, 15, 0)) + c;
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -6592,13 +6393,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (((VecElemU8)src0[lane] & 0xff)
-                    << (8 * bits(src1[lane], 1, 0)))
-                    | (src2[lane] & ~(0xff << (8 * bits(src1[lane], 1, 0))));
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return (((VecElemU8)a & 0xff)
+                    << (8 * bits(b, 1, 0)))
+                    | (c & ~(0xff << (8 * bits(b, 1, 0))));
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -6972,11 +6772,10 @@ namespace VegaISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return std::fma(a, b, c);
+            }, src0, src1, src2);
 
         //vdst.write();
     } // execute
@@ -7264,11 +7063,10 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (src0[lane] ^ src1[lane]) + src2[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return (a ^ b) + c;
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -7309,12 +7107,11 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (src0[lane] << bits(src1[lane], 4, 0))
-                           + src2[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return (a << bits(b, 4, 0))
+                    + c;
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -7401,11 +7198,10 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane] + src2[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return a + b + c;
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -7446,12 +7242,11 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (src0[lane] << bits(src1[lane], 4, 0))
-                           | src2[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return (a << bits(b, 4, 0))
+                    | c;
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -7493,11 +7288,10 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (src0[lane] & src1[lane]) | src2[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return (a & b) | c;
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -7562,11 +7356,10 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane] + src2[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return a * b + c;
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -7609,11 +7402,10 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane] + src2[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b, auto c) {
+                return a * b + c;
+            }, src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -8633,11 +8425,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = popCount(src0[lane]) + src1[lane];
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return popCount(a) + b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -8777,11 +8566,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] << bits(src0[lane], 5, 0);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b << bits(a, 5, 0); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -8822,11 +8608,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 5, 0);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) { return b >> bits(a, 5, 0); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -8937,12 +8720,11 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = ((1 << bits(src0[lane], 4, 0)) - 1)
-                    << bits(src1[lane], 4, 0);
-            }
-        }
+        vecLaneOp(vdst, wf->execMask().to_ullong(),
+            [](auto a, auto b) {
+                return ((1 << bits(a, 4, 0)) - 1)
+                    << bits(b, 4, 0);
+            }, src0, src1);
 
         vdst.write();
     } // execute
@@ -30,6 +30,7 @@
  */
 
 #include "arch/amdgpu/vega/insts/instructions.hh"
+#include "arch/amdgpu/vega/insts/lane_ops.hh"
 
 namespace gem5
 {
@@ -1277,11 +1278,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1311,11 +1309,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1345,11 +1340,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1379,11 +1371,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1413,12 +1402,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return (a < b || a > b); }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1448,11 +1433,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1482,12 +1464,11 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) {
+                return (!std::isnan(a)
+                    && !std::isnan(b));
+            }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1517,12 +1498,11 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) {
+                return (std::isnan(a)
+                    || std::isnan(b));
+            }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1552,11 +1532,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a >= b); }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1586,12 +1563,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a < b || a > b); }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1621,11 +1594,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a > b); }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1655,11 +1625,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a <= b); }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1689,11 +1656,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a != b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1723,11 +1687,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a < b); }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1818,11 +1779,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -1854,11 +1812,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -1890,11 +1845,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -1926,11 +1878,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -1962,12 +1911,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return (a < b || a > b); }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -1999,11 +1944,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2036,12 +1978,11 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) {
+                return (!std::isnan(a)
+                    && !std::isnan(b));
+            }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2074,12 +2015,11 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) {
+                return (std::isnan(a)
+                    || std::isnan(b));
+            }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2111,11 +2051,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a >= b); }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2147,12 +2084,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a < b || a > b); }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2184,11 +2117,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a > b); }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2220,11 +2150,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a <= b); }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2256,11 +2183,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] == src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a == b); }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2292,11 +2216,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a < b); }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2387,11 +2308,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2421,11 +2339,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2455,11 +2370,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2489,11 +2401,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2523,12 +2432,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return (a < b || a > b); }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2558,11 +2463,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2592,12 +2494,11 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) {
+                return (!std::isnan(a)
+                    && !std::isnan(b));
+            }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2627,12 +2528,11 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) {
+                return (std::isnan(a)
+                    || std::isnan(b));
+            }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2662,11 +2562,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a >= b); }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2696,12 +2593,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a < b || a > b); }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2731,11 +2624,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a > b); }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2765,11 +2655,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a <= b); }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2799,11 +2686,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a != b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2833,11 +2717,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a < b); }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2928,11 +2809,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2964,11 +2842,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -3000,11 +2875,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3036,11 +2908,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3072,12 +2941,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return (a < b || a > b); }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3109,11 +2974,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3146,12 +3008,11 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) {
+                return (!std::isnan(a)
+                    && !std::isnan(b));
+            }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3184,12 +3045,11 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) {
+                return (std::isnan(a)
+                    || std::isnan(b));
+            }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3221,11 +3081,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a >= b); }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3257,12 +3114,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a < b || a > b); }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3294,11 +3147,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a > b); }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3330,11 +3180,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a <= b); }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3366,11 +3213,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3402,11 +3246,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return !(a < b); }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3495,11 +3336,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3528,11 +3366,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3561,11 +3396,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3594,11 +3426,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3627,11 +3456,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a != b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3660,11 +3486,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3749,11 +3572,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3782,11 +3602,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3815,11 +3632,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3848,11 +3662,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3881,11 +3692,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a != b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3914,11 +3722,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4006,11 +3811,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4041,11 +3843,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4076,11 +3875,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4111,11 +3907,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4146,11 +3939,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4181,11 +3971,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4276,11 +4063,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4311,11 +4095,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4346,11 +4127,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4381,11 +4159,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4416,11 +4191,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4451,11 +4223,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4543,11 +4312,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4576,11 +4342,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4609,11 +4372,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4642,11 +4402,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4675,11 +4432,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a != b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4708,11 +4462,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4797,11 +4548,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4830,11 +4578,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4863,11 +4608,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4896,11 +4638,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4929,11 +4668,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a != b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4962,11 +4698,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5054,11 +4787,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5089,11 +4819,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5124,11 +4851,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5159,11 +4883,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5194,11 +4915,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5229,11 +4947,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5324,11 +5039,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5359,11 +5071,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5394,11 +5103,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5429,11 +5135,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5464,11 +5167,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5499,11 +5199,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5591,11 +5288,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5624,11 +5318,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5657,11 +5348,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5690,11 +5378,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5723,11 +5408,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a != b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5756,11 +5438,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5845,11 +5524,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5878,11 +5554,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5911,11 +5584,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5944,11 +5614,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5977,11 +5644,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a != b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -6010,11 +5674,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -6102,11 +5763,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6137,11 +5795,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6172,11 +5827,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6207,11 +5859,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6242,11 +5891,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6277,11 +5923,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6372,11 +6015,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6407,11 +6047,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6442,11 +6079,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6477,11 +6111,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6512,11 +6143,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6547,11 +6175,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCompare(wf->execMask().to_ullong(),
+            [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -105,6 +105,8 @@ namespace VegaISA
             "Incorrect number of DWORDS for VEGA operand.");
 
       public:
+        using ElemType = DataType;
+
         VecOperand() = delete;
 
         VecOperand(GPUDynInstPtr gpuDynInst, int opIdx)
@@ -316,6 +318,43 @@ namespace VegaISA
             return vecReg.template as<DataType>()[idx];
         }
 
+        /**
+         * pointer to the values of all lanes, as returned by the [] operator,
+         * for the whole-register kernels in insts/lane_ops.hh. vector
+         * operands without modifiers are returned in place; scalar sources
+         * and operands with abs/neg modifiers are materialised into buf.
+         */
+        template<bool Condition = NumDwords == 1 || NumDwords == 2>
+        typename std::enable_if<Condition, const DataType*>::type
+        lanes([[maybe_unused]] DataType *buf) const
+        {
+            if constexpr (Const) {
+                if (scalar || absMod || negMod) {
+                    for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+                        buf[lane] = (*this)[lane];
+                    }
+                    return buf;
+                }
+            } else {
+                assert(!scalar);
+            }
+
+            return vecReg.template as<DataType>();
+        }
+
+        /**
+         * pointer to the lanes of a destination operand, see the setter []
+         * operator.
+         */
+        template<bool Condition = (NumDwords == 1 || NumDwords == 2) && !Const>
+        typename std::enable_if<Condition, DataType*>::type
+        lanes()
+        {
+            assert(!scalar);
+
+            return vecReg.template as<DataType>();
+        }
+
         private:
           /**
            * if we determine that this operand is a scalar (reg or constant)
@@ -156,6 +156,8 @@ class Decoder : public InstDecoder
     void
     setContext(FPSCR fpscr)
     {
+        if (fpscrLen != fpscr.len || fpscrStride != fpscr.stride)
+            _contextVersion++;
         fpscrLen = fpscr.len;
         fpscrStride = fpscr.stride;
     }
@@ -163,12 +165,16 @@ class Decoder : public InstDecoder
     void
     setSveLen(uint8_t len)
     {
+        if (sveLen != len)
+            _contextVersion++;
         sveLen = len;
     }
 
     void
     setSmeLen(uint8_t len)
     {
+        if (smeLen != len)
+            _contextVersion++;
         smeLen = len;
     }
 };
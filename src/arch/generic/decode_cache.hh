@@ -59,19 +59,17 @@ class BasicDecodeCache
     decode(Decoder *const decoder, EMI mach_inst, Addr addr)
     {
         auto &entry = decodePages.lookup(addr);
-        if (entry.inst && (entry.machInst == mach_inst))
+        if (entry.inst && (entry.machInst == mach_inst)) {
+            decoder->decodeCacheStats.addrHits++;
             return entry.inst;
+        }
 
         entry.machInst = mach_inst;
 
-        auto iter = instMap.find(mach_inst);
-        if (iter != instMap.end()) {
-            entry.inst = iter->second;
-            return entry.inst;
-        }
-
-        entry.inst = decoder->decodeInst(mach_inst);
-        instMap[mach_inst] = entry.inst;
+        StaticInstPtr &inst = decoder->lookupInst(instMap, mach_inst);
+        if (!inst)
+            inst = decoder->decodeInst(mach_inst);
+        entry.inst = inst;
         return entry.inst;
     }
 };
@@ -32,6 +32,30 @@
 namespace gem5
 {
 
+InstDecoder::DecodeCacheStats::DecodeCacheStats(statistics::Group *parent)
+    : statistics::Group(parent, "decodeCache"),
+      ADD_STAT(addrHits, statistics::units::Count::get(),
+               "Instructions found in the cache by their address"),
+      ADD_STAT(instLookups, statistics::units::Count::get(),
+               "Instructions looked up by their encoding"),
+      ADD_STAT(instHits, statistics::units::Count::get(),
+               "Instructions found in the cache by their encoding"),
+      ADD_STAT(probes, statistics::units::Count::get(),
+               "Keys compared when looking up encodings"),
+      ADD_STAT(evictions, statistics::units::Count::get(),
+               "Decoded instructions evicted from a full cache"),
+      ADD_STAT(instHitRate, statistics::units::Ratio::get(),
+               "Fraction of lookups by encoding that hit",
+               instHits / instLookups),
+      ADD_STAT(probesPerLookup, statistics::units::Rate<
+                  statistics::units::Count, statistics::units::Count>::get(),
+               "Keys compared per lookup by encoding",
+               probes / instLookups)
+{
+    addrHits.flags(statistics::nozero);
+    evictions.flags(statistics::nozero);
+}
+
 StaticInstPtr
 InstDecoder::fetchRomMicroop(MicroPC micropc, StaticInstPtr curMacroop)
 {
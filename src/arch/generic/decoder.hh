@@ -31,6 +31,7 @@
 #include "arch/generic/pcstate.hh"
 #include "base/bitfield.hh"
 #include "base/intmath.hh"
+#include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/static_inst_fwd.hh"
 #include "params/InstDecoder.hh"
@@ -49,12 +50,54 @@ class InstDecoder : public SimObject
     bool instDone = false;
     bool outOfBytes = true;
 
+    /**
+     * Version of the decoding context, bumped whenever state other than
+     * the PC that decode() depends on (e.g. the operating mode) changes.
+     */
+    uint64_t _contextVersion = 0;
+
+    struct DecodeCacheStats : public statistics::Group
+    {
+        DecodeCacheStats(statistics::Group *parent);
+
+        statistics::Scalar addrHits;
+        statistics::Scalar instLookups;
+        statistics::Scalar instHits;
+        statistics::Scalar probes;
+        statistics::Scalar evictions;
+        statistics::Formula instHitRate;
+        statistics::Formula probesPerLookup;
+    } decodeCacheStats;
+
+    /**
+     * Look an instruction up in a decode cache, and count the lookup.
+     *
+     * @param map The decode_cache::InstMap to look in.
+     * @param mach_inst The machine instruction to look for.
+     * @return The cached instruction, or an empty pointer to store the
+     *         decoded instruction in.
+     */
+    template <class Map, class EMI>
+    StaticInstPtr &
+    lookupInst(Map &map, const EMI &mach_inst)
+    {
+        auto found = map.lookup(mach_inst);
+        decodeCacheStats.instLookups++;
+        decodeCacheStats.probes += found.probes;
+        if (found.hit)
+            decodeCacheStats.instHits++;
+        if (found.evicted)
+            decodeCacheStats.evictions++;
+        return *found.value;
+    }
+
   public:
     template <typename MoreBytesType>
     InstDecoder(const InstDecoderParams &params, MoreBytesType *mb_buf) :
         SimObject(params), _moreBytesPtr(mb_buf),
         _moreBytesSize(sizeof(MoreBytesType)),
-        _pcMask(~mask(floorLog2(_moreBytesSize)))
+        _pcMask(~mask(floorLog2(_moreBytesSize))),
+        decodeCacheStats(this)
     {}
 
     virtual StaticInstPtr fetchRomMicroop(
@@ -90,12 +133,20 @@ class InstDecoder : public SimObject
     {
         instDone = old->instDone;
         outOfBytes = old->outOfBytes;
+        _contextVersion++;
     }
 
     void *moreBytesPtr() const { return _moreBytesPtr; }
     size_t moreBytesSize() const { return _moreBytesSize; }
     Addr pcMask() const { return _pcMask; }
 
+    /**
+     * Get the version of the decoding context. Instructions decoded
+     * under one version may not be valid under another, even when they
+     * are fetched from the same bytes at the same PC.
+     */
+    uint64_t contextVersion() const { return _contextVersion; }
+
     /**
      * Is an instruction ready to be decoded?
      *
@@ -95,7 +95,7 @@ Decoder::decode(ExtMachInst mach_inst, Addr addr)
     DPRINTF(Decode, "Decoding instruction 0x%08x at address %#x\n",
             mach_inst.instBits, addr);
 
-    StaticInstPtr &si = instMap[mach_inst];
+    StaticInstPtr &si = lookupInst(instMap, mach_inst);
     if (!si)
         si = decodeInst(mach_inst);
 
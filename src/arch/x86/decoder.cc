@@ -163,6 +163,7 @@ Decoder::doFromCacheState()
         return PrefixState;
     } else if (chunkIdx == instBytes->chunks.size() - 1) {
         // We matched the cache, so use its value.
+        decodeCacheStats.addrHits++;
         instDone = true;
         offset = instBytes->lastOffset;
         if (offset == sizeof(MachInst))
@@ -677,15 +678,9 @@ Decoder::InstCacheMap Decoder::instCacheMap;
 StaticInstPtr
 Decoder::decode(ExtMachInst mach_inst, Addr addr)
 {
-    StaticInstPtr si;
-
-    auto iter = instMap->find(mach_inst);
-    if (iter != instMap->end()) {
-        si = iter->second;
-    } else {
+    StaticInstPtr &si = lookupInst(*instMap, mach_inst);
+    if (!si)
         si = decodeInst(mach_inst);
-        (*instMap)[mach_inst] = si;
-    }
 
     si->size(basePC + offset - origPC);
 
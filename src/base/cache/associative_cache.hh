@@ -251,26 +251,59 @@ class AssociativeCache : public Named
         replPolicy->reset(entry->replacementData);
     }
 
+    /**
+     * A view of replacement candidates as entries of this cache. It
+     * shares the lifetime of the ReplacementCandidates it wraps.
+     */
+    class EntryCandidates
+    {
+      private:
+        ReplacementCandidates candidates;
+
+      public:
+        class iterator
+        {
+          private:
+            ReplacementCandidates::iterator it;
+
+          public:
+            explicit iterator(ReplacementCandidates::iterator _it)
+                : it(_it)
+            {}
+
+            Entry *operator*() const { return static_cast<Entry *>(*it); }
+            iterator &operator++() { ++it; return *this; }
+            bool operator==(const iterator &o) const { return it == o.it; }
+            bool operator!=(const iterator &o) const { return it != o.it; }
+        };
+
+        explicit EntryCandidates(const ReplacementCandidates &_candidates)
+            : candidates(_candidates)
+        {}
+
+        iterator begin() const { return iterator(candidates.begin()); }
+        iterator end() const { return iterator(candidates.end()); }
+        std::size_t size() const { return candidates.size(); }
+        bool empty() const { return candidates.empty(); }
+
+        Entry *
+        operator[](std::size_t idx) const
+        {
+            return static_cast<Entry *>(candidates[idx]);
+        }
+    };
+
     /**
      * Find the set of entries that could be replaced given
      * that we want to add a new entry with the provided key
      * @param addr key to select the set of entries
-     * @result vector of candidates matching with the provided key
+     * @result view of the candidates matching with the provided key,
+     *   valid until the next lookup
      */
-    std::vector<Entry *>
+    EntryCandidates
     getPossibleEntries(const Addr addr) const
     {
-        std::vector<ReplaceableEntry *> selected_entries =
-            indexingPolicy->getPossibleEntries(addr);
-
-        std::vector<Entry *> entries;
-
-        std::transform(selected_entries.begin(), selected_entries.end(),
-                       std::back_inserter(entries), [](auto &entry) {
-                           return static_cast<Entry *>(entry);
-                       });
-
-        return entries;
+        return EntryCandidates(indexingPolicy->getPossibleEntries(addr));
     }
 
     /** Iterator types */
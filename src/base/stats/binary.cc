@@ -0,0 +1,374 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/binary.hh"
+
+#include <cstring>
+#include <ostream>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "base/stats/info.hh"
+#include "base/stats/units.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+namespace
+{
+
+template <typename T>
+void
+put(std::string &buf, T value)
+{
+    buf.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void
+putString(std::string &buf, const std::string &str)
+{
+    put<uint32_t>(buf, str.size());
+    buf.append(str);
+}
+
+} // anonymous namespace
+
+Binary::Binary(std::ostream &_stream, bool desc)
+    : stream(_stream), descriptions(desc), entryPos(0),
+      schemaChanged(false), dumpCount(0)
+{
+    FileHeader header{};
+    std::memcpy(header.magic, "gem5stat", sizeof(header.magic));
+    header.version = formatVersion;
+    header.byteOrderMark = byteOrderMark;
+    stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+}
+
+void
+Binary::begin()
+{
+    values.clear();
+    entryPos = 0;
+    // The first dump always writes a schema, even an empty one.
+    schemaChanged = dumpCount == 0;
+    if (schemaChanged)
+        schema.clear();
+}
+
+void
+Binary::end()
+{
+    // The dump ended early, i.e., it had fewer stats than the schema.
+    if (!schemaChanged && entryPos != schema.size()) {
+        schema.resize(entryPos);
+        schemaChanged = true;
+    }
+
+    if (schemaChanged)
+        writeSchema();
+    writeSnapshot();
+
+    stream.flush();
+    dumpCount++;
+}
+
+bool
+Binary::valid() const
+{
+    return stream.good();
+}
+
+void
+Binary::beginGroup(const char *name)
+{
+    if (path.empty()) {
+        path.push(name);
+    } else {
+        path.push(path.top() + "." + name);
+    }
+}
+
+void
+Binary::endGroup()
+{
+    assert(!path.empty());
+    path.pop();
+}
+
+std::string
+Binary::statName(const std::string &name) const
+{
+    if (path.empty())
+        return name;
+    else
+        return path.top() + "." + name;
+}
+
+bool
+Binary::noOutput(const Info &info) const
+{
+    // Unlike the text output, stats whose prerequisite is zero are
+    // still dumped, as the schema would otherwise change between dumps.
+    return !info.flags.isSet(display);
+}
+
+Binary::Entry *
+Binary::nextEntry(const Info &info, uint32_t sub, EntryKind kind,
+                  uint32_t num_cols)
+{
+    if (!schemaChanged && entryPos < schema.size()) {
+        const Entry &entry = schema[entryPos];
+        if (entry.info == &info && entry.sub == sub && entry.kind == kind &&
+            entry.numCols == num_cols) {
+            ++entryPos;
+            return nullptr;
+        }
+    }
+
+    if (!schemaChanged) {
+        // Everything before this entry is unchanged and kept.
+        schema.resize(entryPos);
+        schemaChanged = true;
+    }
+
+    Entry &entry = schema.emplace_back();
+    entry.info = &info;
+    entry.sub = sub;
+    entry.kind = kind;
+    entry.distType = 0;
+    entry.flags = info.flags;
+    entry.precision = info.precision;
+    entry.numCols = num_cols;
+    if (descriptions)
+        entry.desc = info.desc;
+    entry.unit = info.unit->getUnitString();
+    entry.separator = info.separatorString;
+    return &entry;
+}
+
+void
+Binary::visit(const ScalarInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    if (Entry *entry = nextEntry(info, 0, ScalarEntry, 1))
+        entry->name = statName(info.name);
+    values.push_back(info.result());
+}
+
+void
+Binary::visit(const VectorInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    const VResult &vr = info.result();
+    if (Entry *entry = nextEntry(info, 0, VectorEntry, vr.size())) {
+        entry->name = statName(info.name);
+        entry->labels = info.subnames;
+        entry->labels.resize(vr.size());
+    }
+    values.insert(values.end(), vr.begin(), vr.end());
+}
+
+void
+Binary::visit(const Vector2dInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    // Rows are laid out like the text output prints them: one vector
+    // per x-index, skipping unnamed rows if any row has a name.
+    bool havesub = false;
+    for (off_type i = 0; i < info.subnames.size() && i < info.x; ++i) {
+        if (!info.subnames[i].empty())
+            havesub = true;
+    }
+
+    for (off_type i = 0; i < info.x; ++i) {
+        if (havesub && (i >= info.subnames.size() || info.subnames[i].empty()))
+            continue;
+
+        if (Entry *entry = nextEntry(info, i, VectorRowEntry, info.y)) {
+            entry->name = statName(info.name + "_" +
+                (havesub ? info.subnames[i] : std::to_string(i)));
+            entry->labels = info.y_subnames;
+            entry->labels.resize(info.y);
+        }
+        auto row = info.cvec.begin() + i * info.y;
+        values.insert(values.end(), row, row + info.y);
+    }
+
+    if (info.flags.isSet(total) && info.x > 1) {
+        if (Entry *entry = nextEntry(info, info.x, VectorRowEntry, 1)) {
+            entry->name = statName(info.name);
+            entry->labels = {"total"};
+            entry->flags &= ~total;
+        }
+        values.push_back(info.total());
+    }
+}
+
+void
+Binary::appendDist(const Info &info, uint32_t sub, const std::string &name,
+                   const std::string &desc, const DistData &data)
+{
+    const uint32_t num_cols = NumDistFields + data.cvec.size();
+    if (Entry *entry = nextEntry(info, sub, DistEntry, num_cols)) {
+        entry->name = name;
+        entry->distType = data.type;
+        if (descriptions)
+            entry->desc = desc;
+    }
+
+    // In DistField order
+    const double fields[NumDistFields] = {
+        data.samples, data.sum, data.squares, data.logs,
+        data.min_val, data.max_val, data.underflow, data.overflow,
+        data.min, data.max, data.bucket_size,
+    };
+    values.insert(values.end(), fields, fields + NumDistFields);
+    values.insert(values.end(), data.cvec.begin(), data.cvec.end());
+}
+
+void
+Binary::visit(const DistInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    appendDist(info, 0, statName(info.name), info.desc, info.data);
+}
+
+void
+Binary::visit(const VectorDistInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    for (off_type i = 0; i < info.size(); ++i) {
+        const std::string name = statName(info.name + "_" +
+            (info.subnames[i].empty() ? std::to_string(i) :
+             info.subnames[i]));
+        const std::string &desc =
+            info.subdescs[i].empty() ? info.desc : info.subdescs[i];
+        appendDist(info, i, name, desc, info.data[i]);
+    }
+}
+
+void
+Binary::visit(const FormulaInfo &info)
+{
+    visit((const VectorInfo &)info);
+}
+
+void
+Binary::visit(const SparseHistInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    // The buckets of a sparse histogram change from dump to dump, so
+    // they do not fit in a fixed set of columns.
+    warn_once("Binary stat files only record the number of samples of "
+              "sparse histograms.\n");
+
+    if (Entry *entry = nextEntry(info, 0, ScalarEntry, 1))
+        entry->name = statName(info.name) + info.separatorString + "samples";
+    values.push_back(info.data.samples);
+}
+
+void
+Binary::writeBlock(BlockType type, const std::string &payload)
+{
+    BlockHeader header{};
+    header.type = type;
+    header.size = (payload.size() + 7) & ~uint64_t(7);
+    stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    stream.write(payload.data(), payload.size());
+
+    const char padding[8] = {};
+    stream.write(padding, header.size - payload.size());
+}
+
+void
+Binary::writeSchema()
+{
+    uint64_t num_cols = 0;
+    for (const auto &entry : schema)
+        num_cols += entry.numCols;
+
+    std::string buf;
+    put<uint64_t>(buf, num_cols);
+    put<uint64_t>(buf, schema.size());
+    for (const auto &entry : schema) {
+        put<uint8_t>(buf, entry.kind);
+        put<uint8_t>(buf, entry.distType);
+        put<uint16_t>(buf, entry.flags);
+        put<int32_t>(buf, entry.precision);
+        put<uint32_t>(buf, entry.numCols);
+        put<uint32_t>(buf, entry.labels.size());
+        putString(buf, entry.name);
+        putString(buf, entry.desc);
+        putString(buf, entry.unit);
+        putString(buf, entry.separator);
+        for (const auto &label : entry.labels)
+            putString(buf, label);
+    }
+
+    writeBlock(SchemaBlock, buf);
+}
+
+void
+Binary::writeSnapshot()
+{
+    BlockHeader header{};
+    header.type = SnapshotBlock;
+    header.size = sizeof(uint64_t) + values.size() * sizeof(double);
+    stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    const uint64_t tick = curTick();
+    stream.write(reinterpret_cast<const char *>(&tick), sizeof(tick));
+    stream.write(reinterpret_cast<const char *>(values.data()),
+                 values.size() * sizeof(double));
+}
+
+std::unique_ptr<Output>
+initBinary(const std::string &filename, bool desc)
+{
+    OutputStream *os = simout.create(filename, true, true);
+    return std::unique_ptr<Output>(new Binary(*os->stream(), desc));
+}
+
+} // namespace statistics
+} // namespace gem5
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_BINARY_HH__
+#define __BASE_STATS_BINARY_HH__
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <stack>
+#include <string>
+#include <vector>
+
+#include "base/stats/output.hh"
+#include "base/stats/types.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+class Info;
+
+/**
+ * Dependency-free binary stat output.
+ *
+ * A file starts with a FileHeader, followed by a sequence of blocks,
+ * each introduced by a BlockHeader. A schema block lists the stats of a
+ * dump and the columns they occupy; a snapshot block holds the tick of a
+ * dump followed by one double per column. The schema is only written
+ * for the first dump and whenever the set of dumped stats changes (e.g.,
+ * when dumping a subtree), so periodic dumps append nothing but
+ * fixed-size snapshots. The snapshots following a schema can thus be
+ * memory-mapped as a [dumps x columns] array, where each stat is a
+ * fixed column range.
+ *
+ * All fields use the byte order of the host that wrote the file, which
+ * readers identify through FileHeader::byteOrderMark. See
+ * util/stats/binstats.py for a reader and a converter to text.
+ */
+class Binary : public Output
+{
+  public:
+    static constexpr uint32_t formatVersion = 1;
+    static constexpr uint32_t byteOrderMark = 0x01020304;
+
+    struct FileHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t byteOrderMark;
+    };
+
+    enum BlockType : uint32_t
+    {
+        SchemaBlock = 1,
+        SnapshotBlock = 2,
+    };
+
+    /** Payloads are padded so that every block is 8-byte aligned. */
+    struct BlockHeader
+    {
+        uint32_t type;
+        uint32_t reserved;
+        uint64_t size;
+    };
+
+    enum EntryKind : uint8_t
+    {
+        /** A single value. */
+        ScalarEntry = 0,
+        /**
+         * One value per label. Empty labels stand for the element index,
+         * unless another label is set, in which case the text output
+         * skips the element.
+         */
+        VectorEntry = 1,
+        /** The NumDistFields fields of DistData followed by the buckets. */
+        DistEntry = 2,
+        /**
+         * A row of a 2d vector. Unlike VectorEntry, a single element
+         * keeps its label in the text output.
+         */
+        VectorRowEntry = 3,
+    };
+
+    /** Column order of the fixed fields of a distribution entry. */
+    enum DistField
+    {
+        DistSamples,
+        DistSum,
+        DistSquares,
+        DistLogs,
+        DistMinVal,
+        DistMaxVal,
+        DistUnderflow,
+        DistOverflow,
+        DistMin,
+        DistMax,
+        DistBucketSize,
+        NumDistFields
+    };
+
+    Binary(std::ostream &stream, bool desc);
+
+    Binary() = delete;
+    Binary(const Binary &other) = delete;
+
+  public: // Output interface
+    void begin() override;
+    void end() override;
+    bool valid() const override;
+
+    void beginGroup(const char *name) override;
+    void endGroup() override;
+
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+  protected:
+    /** Schema description of the columns produced by one stat (part). */
+    struct Entry
+    {
+        /** Identity of the entry, used to detect schema changes. */
+        const Info *info;
+        uint32_t sub;
+
+        EntryKind kind;
+        uint8_t distType;
+        uint16_t flags;
+        int32_t precision;
+        uint32_t numCols;
+        std::string name;
+        std::string desc;
+        std::string unit;
+        std::string separator;
+        std::vector<std::string> labels;
+    };
+
+    /**
+     * Account for the next entry of this dump. If it matches the schema
+     * of the previous dump, nullptr is returned. Otherwise the schema is
+     * rewritten from this point on and the new entry is returned for the
+     * caller to fill in its name and labels.
+     */
+    Entry *nextEntry(const Info &info, uint32_t sub, EntryKind kind,
+                     uint32_t num_cols);
+
+    void appendDist(const Info &info, uint32_t sub, const std::string &name,
+                    const std::string &desc, const DistData &data);
+
+    std::string statName(const std::string &name) const;
+    bool noOutput(const Info &info) const;
+
+    void writeBlock(BlockType type, const std::string &payload);
+    void writeSchema();
+    void writeSnapshot();
+
+    std::ostream &stream;
+    const bool descriptions;
+
+    std::stack<std::string> path;
+
+    std::vector<Entry> schema;
+    /** Position in the schema while it still matches the current dump. */
+    size_t entryPos;
+    bool schemaChanged;
+
+    /** Column values of the current dump. */
+    std::vector<double> values;
+    uint64_t dumpCount;
+};
+
+std::unique_ptr<Output> initBinary(const std::string &filename, bool desc);
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_BINARY_HH__
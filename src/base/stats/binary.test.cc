@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base/gtest/cur_tick_fake.hh"
+#include "base/stats/binary.hh"
+#include "base/stats/info.hh"
+#include "base/stats/output.hh"
+
+using namespace gem5;
+using statistics::Binary;
+
+// Instantiate the fake class to have a valid curTick of 0
+GTestTickHandler tickHandler;
+
+namespace
+{
+
+template <class Base>
+class TestInfo : public Base
+{
+  public:
+    TestInfo(const std::string &name)
+    {
+        this->name = name;
+        this->desc = name + " description";
+        this->flags = statistics::display;
+    }
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override {}
+    bool zero() const override { return false; }
+    void visit(statistics::Output &visitor) override {}
+};
+
+class TestScalar : public TestInfo<statistics::ScalarInfo>
+{
+  public:
+    using TestInfo::TestInfo;
+
+    double val = 0;
+
+    statistics::Counter value() const override { return val; }
+    statistics::Result result() const override { return val; }
+    statistics::Result total() const override { return val; }
+};
+
+class TestVector : public TestInfo<statistics::VectorInfo>
+{
+  public:
+    using TestInfo::TestInfo;
+
+    statistics::VCounter vals;
+    mutable statistics::VResult res;
+
+    statistics::size_type size() const override { return vals.size(); }
+    const statistics::VCounter &value() const override { return vals; }
+
+    const statistics::VResult &
+    result() const override
+    {
+        res.assign(vals.begin(), vals.end());
+        return res;
+    }
+
+    statistics::Result
+    total() const override
+    {
+        statistics::Result sum = 0;
+        for (auto v : vals)
+            sum += v;
+        return sum;
+    }
+};
+
+using TestDist = TestInfo<statistics::DistInfo>;
+
+/** Minimal reader for the block structure of a binary stat file. */
+class Reader
+{
+  public:
+    explicit Reader(const std::string &data) : data(data), pos(0) {}
+
+    template <typename T>
+    T
+    get()
+    {
+        T value;
+        EXPECT_LE(pos + sizeof(T), data.size());
+        std::memcpy(&value, data.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+
+    std::string
+    getString()
+    {
+        const auto len = get<uint32_t>();
+        std::string str = data.substr(pos, len);
+        pos += len;
+        return str;
+    }
+
+    bool done() const { return pos == data.size(); }
+
+    const std::string data;
+    size_t pos;
+};
+
+struct Column
+{
+    std::string name;
+    std::vector<std::string> labels;
+    uint32_t numCols;
+};
+
+std::vector<Column>
+readSchema(Reader &reader)
+{
+    const auto header = reader.get<Binary::BlockHeader>();
+    EXPECT_EQ(header.type, Binary::SchemaBlock);
+    EXPECT_EQ(header.size % 8, 0);
+    const size_t end = reader.pos + header.size;
+
+    reader.get<uint64_t>(); // number of columns
+    const auto num_entries = reader.get<uint64_t>();
+    std::vector<Column> entries;
+    for (uint64_t i = 0; i < num_entries; ++i) {
+        Column col;
+        reader.get<uint8_t>(); // kind
+        reader.get<uint8_t>(); // dist type
+        reader.get<uint16_t>(); // flags
+        reader.get<int32_t>(); // precision
+        col.numCols = reader.get<uint32_t>();
+        const auto num_labels = reader.get<uint32_t>();
+        col.name = reader.getString();
+        reader.getString(); // desc
+        reader.getString(); // unit
+        reader.getString(); // separator
+        for (uint32_t j = 0; j < num_labels; ++j)
+            col.labels.push_back(reader.getString());
+        entries.push_back(col);
+    }
+    reader.pos = end;
+    return entries;
+}
+
+std::vector<double>
+readSnapshot(Reader &reader, Tick expected_tick)
+{
+    const auto header = reader.get<Binary::BlockHeader>();
+    EXPECT_EQ(header.type, Binary::SnapshotBlock);
+    EXPECT_EQ(reader.get<uint64_t>(), expected_tick);
+    std::vector<double> values((header.size - sizeof(uint64_t)) /
+                               sizeof(double));
+    for (auto &v : values)
+        v = reader.get<double>();
+    return values;
+}
+
+} // anonymous namespace
+
+/** The schema is written once and each dump appends a snapshot. */
+TEST(StatsBinaryTest, SchemaOncePerLayout)
+{
+    TestScalar scalar("scalar");
+    TestVector vector("vector");
+    vector.vals = {1, 2, 3};
+    vector.subnames = {"a", "", "c"};
+    TestDist dist("dist");
+    dist.data.type = statistics::Dist;
+    dist.data.cvec = {4, 5};
+    dist.data.samples = 9;
+    dist.data.bucket_size = 1;
+
+    std::stringstream ss;
+    Binary binary(ss, true);
+
+    auto dump = [&](bool full) {
+        binary.begin();
+        binary.beginGroup("system");
+        binary.visit(scalar);
+        if (full) {
+            binary.visit(vector);
+            binary.visit(dist);
+        }
+        binary.endGroup();
+        binary.end();
+    };
+
+    tickHandler.setCurTick(100);
+    scalar.val = 1;
+    dump(true);
+    tickHandler.setCurTick(200);
+    scalar.val = 2;
+    vector.vals[1] = 7;
+    dump(true);
+    tickHandler.setCurTick(300);
+    dump(false);
+
+    Reader reader(ss.str());
+    const auto header = reader.get<Binary::FileHeader>();
+    ASSERT_EQ(std::string(header.magic, 8), "gem5stat");
+    ASSERT_EQ(header.version, Binary::formatVersion);
+    ASSERT_EQ(header.byteOrderMark, Binary::byteOrderMark);
+
+    auto schema = readSchema(reader);
+    ASSERT_EQ(schema.size(), 3);
+    EXPECT_EQ(schema[0].name, "system.scalar");
+    EXPECT_EQ(schema[0].numCols, 1);
+    EXPECT_EQ(schema[1].name, "system.vector");
+    EXPECT_EQ(schema[1].labels,
+              std::vector<std::string>({"a", "", "c"}));
+    EXPECT_EQ(schema[2].name, "system.dist");
+    EXPECT_EQ(schema[2].numCols, Binary::NumDistFields + 2);
+
+    const size_t num_cols = 1 + 3 + Binary::NumDistFields + 2;
+    auto snap = readSnapshot(reader, 100);
+    ASSERT_EQ(snap.size(), num_cols);
+    EXPECT_EQ(snap[0], 1);
+    EXPECT_EQ(snap[2], 2);
+    EXPECT_EQ(snap[4 + Binary::DistSamples], 9);
+    EXPECT_EQ(snap[4 + Binary::NumDistFields + 1], 5);
+
+    // Same layout: no new schema.
+    snap = readSnapshot(reader, 200);
+    ASSERT_EQ(snap.size(), num_cols);
+    EXPECT_EQ(snap[0], 2);
+    EXPECT_EQ(snap[2], 7);
+
+    // Fewer stats: a new schema precedes the snapshot.
+    schema = readSchema(reader);
+    ASSERT_EQ(schema.size(), 1);
+    EXPECT_EQ(schema[0].name, "system.scalar");
+    snap = readSnapshot(reader, 300);
+    ASSERT_EQ(snap.size(), 1);
+
+    EXPECT_TRUE(reader.done());
+}
+
+/** Stats without the display flag are not dumped. */
+TEST(StatsBinaryTest, NoDisplay)
+{
+    TestScalar shown("shown");
+    TestScalar hidden("hidden");
+    hidden.flags = statistics::none;
+
+    std::stringstream ss;
+    Binary binary(ss, false);
+    binary.begin();
+    binary.visit(hidden);
+    binary.visit(shown);
+    binary.end();
+
+    Reader reader(ss.str());
+    reader.get<Binary::FileHeader>();
+    auto schema = readSchema(reader);
+    ASSERT_EQ(schema.size(), 1);
+    EXPECT_EQ(schema[0].name, "shown");
+    EXPECT_EQ(readSnapshot(reader, curTick()).size(), 1);
+}
@@ -44,6 +44,7 @@
 
 #include "base/stats/text.hh"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <fstream>
@@ -51,6 +52,7 @@
 #include <limits>
 #include <sstream>
 #include <string>
+#include <utility>
 
 #include "base/cast.hh"
 #include "base/logging.hh"
@@ -65,6 +67,40 @@ namespace
 
 constexpr auto Nan = std::numeric_limits<float>::quiet_NaN();
 
+/**
+ * Compare two rows of stat values. Missing trailing values are taken
+ * to be zero and NaNs compare equal to each other, so that formulas
+ * stuck at NaN are not reported as changing on every dump.
+ */
+bool
+sameValues(const statistics::VResult &a, const statistics::VResult &b)
+{
+    const size_t size = std::max(a.size(), b.size());
+    for (size_t i = 0; i < size; ++i) {
+        const statistics::Result x = i < a.size() ? a[i] : 0.0;
+        const statistics::Result y = i < b.size() ? b[i] : 0.0;
+        if (x != y && !(std::isnan(x) && std::isnan(y)))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Values that identify the state of a distribution. The bucket
+ * geometry and the min/max values are left out as they only change
+ * when samples are added.
+ */
+statistics::VResult
+distValues(const statistics::DistData &data)
+{
+    statistics::VResult values = {
+        data.samples, data.sum, data.squares, data.logs,
+        data.underflow, data.overflow
+    };
+    values.insert(values.end(), data.cvec.begin(), data.cvec.end());
+    return values;
+}
+
 } // anonymous namespace
 
 namespace statistics
@@ -73,7 +109,8 @@ namespace statistics
 std::list<Info *> &statsList();
 
 Text::Text()
-    : mystream(false), stream(NULL), descriptions(false), spaces(false)
+    : mystream(false), stream(NULL), enableUnits(false),
+      descriptions(false), spaces(false), deltas(false)
 {
 }
 
@@ -177,6 +214,31 @@ Text::noOutput(const Info &info)
     return false;
 }
 
+bool
+Text::unchanged(const Info &info, off_type row, const VResult &values)
+{
+    std::vector<VResult> &rows = lastValues[&info];
+    if (rows.size() <= row)
+        rows.resize(row + 1);
+
+    if (sameValues(rows[row], values))
+        return true;
+
+    rows[row] = values;
+    return false;
+}
+
+Flags
+Text::printFlags(const Info &info) const
+{
+    // The values are remembered before printing, so a row that drops
+    // back to zero must still be printed.
+    Flags flags = info.flags;
+    if (deltas)
+        flags.clear(nozero);
+    return flags;
+}
+
 std::string
 ValueToString(Result value, int precision)
 {
@@ -442,7 +504,7 @@ DistPrint::DistPrint(const Text *text, const VectorDistInfo &info,
 void
 DistPrint::init(const Text *text, const Info &info)
 {
-    setup(text->statName(info.name), info.flags, info.precision,
+    setup(text->statName(info.name), text->printFlags(info), info.precision,
         text->descriptions, info.desc, text->enableUnits,
         info.unit->getUnitString(), text->spaces);
     separatorString = info.separatorString;
@@ -589,10 +651,15 @@ Text::visit(const ScalarInfo &info)
     if (noOutput(info))
         return;
 
+    const Result value = info.result();
+    if (deltas && unchanged(info, 0, VResult(1, value)))
+        return;
+
     ScalarPrint print(spaces);
-    print.setup(statName(info.name), info.flags, info.precision, descriptions,
-        info.desc, enableUnits, info.unit->getUnitString(), spaces);
-    print.value = info.result();
+    print.setup(statName(info.name), printFlags(info), info.precision,
+        descriptions, info.desc, enableUnits, info.unit->getUnitString(),
+        spaces);
+    print.value = value;
     print.pdf = Nan;
     print.cdf = Nan;
 
@@ -605,10 +672,14 @@ Text::visit(const VectorInfo &info)
     if (noOutput(info))
         return;
 
+    if (deltas && unchanged(info, 0, info.result()))
+        return;
+
     size_type size = info.size();
     VectorPrint print(spaces);
-    print.setup(statName(info.name), info.flags, info.precision, descriptions,
-        info.desc, enableUnits, info.unit->getUnitString(), spaces);
+    print.setup(statName(info.name), printFlags(info), info.precision,
+        descriptions, info.desc, enableUnits, info.unit->getUnitString(),
+        spaces);
     print.separatorString = info.separatorString;
     print.vec = info.result();
     print.total = info.total();
@@ -651,7 +722,7 @@ Text::visit(const Vector2dInfo &info)
             }
         }
     }
-    print.flags = info.flags;
+    print.flags = printFlags(info);
     print.separatorString = info.separatorString;
     print.descriptions = descriptions;
     print.enableUnits = enableUnits;
@@ -679,6 +750,9 @@ Text::visit(const Vector2dInfo &info)
             total += yvec[j];
         }
 
+        if (deltas && unchanged(info, i, yvec))
+            continue;
+
         print.name = statName(
             info.name + "_" +
             (havesub ? info.subnames[i] : std::to_string(i)));
@@ -693,7 +767,8 @@ Text::visit(const Vector2dInfo &info)
     std::vector<std::string> total_subname;
     total_subname.push_back("total");
 
-    if (info.flags.isSet(statistics::total) && (info.x > 1)) {
+    if (info.flags.isSet(statistics::total) && (info.x > 1) &&
+        !(deltas && unchanged(info, info.x, VResult(1, info.total())))) {
         print.name = statName(info.name);
         print.subnames = total_subname;
         print.desc = info.desc;
@@ -710,6 +785,9 @@ Text::visit(const DistInfo &info)
     if (noOutput(info))
         return;
 
+    if (deltas && unchanged(info, 0, distValues(info.data)))
+        return;
+
     DistPrint print(this, info);
     print(*stream);
 }
@@ -721,6 +799,9 @@ Text::visit(const VectorDistInfo &info)
         return;
 
     for (off_type i = 0; i < info.size(); ++i) {
+        if (deltas && unchanged(info, i, distValues(info.data[i])))
+            continue;
+
         DistPrint print(this, info, i);
         print(*stream);
     }
@@ -758,7 +839,7 @@ SparseHistPrint::SparseHistPrint(const Text *text, const SparseHistInfo &info)
 void
 SparseHistPrint::init(const Text *text, const Info &info)
 {
-    setup(text->statName(info.name), info.flags, info.precision,
+    setup(text->statName(info.name), text->printFlags(info), info.precision,
         text->descriptions, info.desc, text->enableUnits,
         info.unit->getUnitString(), text->spaces);
     separatorString = info.separatorString;
@@ -796,12 +877,22 @@ Text::visit(const SparseHistInfo &info)
     if (noOutput(info))
         return;
 
+    if (deltas) {
+        VResult values(1, info.data.samples);
+        for (const auto &[bucket, count] : info.data.cmap) {
+            values.push_back(bucket);
+            values.push_back(count);
+        }
+        if (unchanged(info, 0, values))
+            return;
+    }
+
     SparseHistPrint print(this, info);
     print(*stream);
 }
 
 Output *
-initText(const std::string &filename, bool desc, bool spaces)
+initText(const std::string &filename, bool desc, bool spaces, bool deltas)
 {
     static Text text;
     static bool connected = false;
@@ -811,6 +902,7 @@ initText(const std::string &filename, bool desc, bool spaces)
         text.descriptions = desc;
         text.enableUnits = desc; // the units are printed if descs are
         text.spaces = spaces;
+        text.deltas = deltas;
         connected = true;
     }
 
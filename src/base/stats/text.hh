@@ -44,9 +44,12 @@
 #include <iosfwd>
 #include <stack>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "base/compiler.hh"
 #include "base/output.hh"
+#include "base/stats/info.hh"
 #include "base/stats/output.hh"
 #include "base/stats/types.hh"
 
@@ -65,13 +68,35 @@ class Text : public Output
     // Object/group path
     std::stack<std::string> path;
 
+    /**
+     * Values of each stat at the time it was last printed, indexed by
+     * the row of output they belong to. Only used when deltas are
+     * enabled. Stats that have never been printed are compared against
+     * zero, so stats that stay at their reset value are never printed.
+     */
+    std::unordered_map<const Info *, std::vector<VResult>> lastValues;
+
   protected:
     bool noOutput(const Info &info);
 
+    /**
+     * Check if a row of a stat still has the values it had when it was
+     * last printed, and remember the new values if it does not. Only
+     * call this when deltas are enabled.
+     *
+     * @param info Stat that owns the row.
+     * @param row Index of the row within the stat's output.
+     * @param values Current values of the row.
+     * @return true if the row can be skipped.
+     */
+    bool unchanged(const Info &info, off_type row, const VResult &values);
+
   public:
     bool enableUnits;
     bool descriptions;
     bool spaces;
+    /** Only print the stats that changed since the previous dump. */
+    bool deltas;
 
   public:
     Text();
@@ -83,6 +108,13 @@ class Text : public Output
     void open(const std::string &file);
     std::string statName(const std::string &name) const;
 
+    /**
+     * Flags to print a stat with. With deltas, a printed row always
+     * changed since the previous dump, so nozero is ignored: a row that
+     * went back to zero must show up too.
+     */
+    Flags printFlags(const Info &info) const;
+
     // Implement Visit
     void visit(const ScalarInfo &info) override;
     void visit(const VectorInfo &info) override;
@@ -104,7 +136,8 @@ class Text : public Output
 
 std::string ValueToString(Result value, int precision);
 
-Output *initText(const std::string &filename, bool desc, bool spaces);
+Output *initText(const std::string &filename, bool desc, bool spaces,
+                 bool deltas);
 
 } // namespace statistics
 } // namespace gem5
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include "base/stats/info.hh"
+#include "base/stats/text.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+class TestScalar : public statistics::ScalarInfo
+{
+  public:
+    TestScalar(const std::string &name,
+               statistics::FlagsType flags = statistics::display)
+    {
+        this->name = name;
+        this->flags = flags;
+    }
+
+    double val = 0;
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override { val = 0; }
+    bool zero() const override { return val == 0; }
+    void visit(statistics::Output &visitor) override {}
+
+    statistics::Counter value() const override { return val; }
+    statistics::Result result() const override { return val; }
+    statistics::Result total() const override { return val; }
+};
+
+/** Dump the given stats and return the produced text. */
+std::string
+dump(statistics::Text &text, std::stringstream &stream,
+     std::initializer_list<TestScalar *> stats)
+{
+    stream.str("");
+    for (auto *stat : stats)
+        text.visit(*stat);
+    return stream.str();
+}
+
+} // anonymous namespace
+
+/** Without deltas, every stat is printed on every dump. */
+TEST(StatsTextTest, NoDeltas)
+{
+    std::stringstream stream;
+    statistics::Text text(stream);
+
+    TestScalar a("a"), b("b");
+    EXPECT_EQ(dump(text, stream, {&a, &b}), "a 0\nb 0\n");
+    EXPECT_EQ(dump(text, stream, {&a, &b}), "a 0\nb 0\n");
+}
+
+/** With deltas, only stats that changed since they were last printed. */
+TEST(StatsTextTest, Deltas)
+{
+    std::stringstream stream;
+    statistics::Text text(stream);
+    text.deltas = true;
+
+    TestScalar a("a"), b("b"), c("c");
+    c.val = std::numeric_limits<double>::quiet_NaN();
+
+    // Stats still at zero are not printed, NaN only once
+    EXPECT_EQ(dump(text, stream, {&a, &b, &c}), "c nan\n");
+
+    a.val = 2;
+    EXPECT_EQ(dump(text, stream, {&a, &b, &c}), "a 2\n");
+    EXPECT_EQ(dump(text, stream, {&a, &b, &c}), "");
+
+    b.val = 1;
+    a.reset();
+    EXPECT_EQ(dump(text, stream, {&a, &b, &c}), "a 0\nb 1\n");
+}
+
+/**
+ * With deltas, a nozero stat that goes back to zero is still printed, or
+ * readers would keep its previous value.
+ */
+TEST(StatsTextTest, DeltasNoZeroReset)
+{
+    std::stringstream stream;
+    statistics::Text text(stream);
+    text.deltas = true;
+
+    TestScalar a("a", statistics::display | statistics::nozero);
+    EXPECT_EQ(dump(text, stream, {&a}), "");
+
+    a.val = 3;
+    EXPECT_EQ(dump(text, stream, {&a}), "a 3\n");
+
+    a.reset();
+    EXPECT_EQ(dump(text, stream, {&a}), "a 0\n");
+    EXPECT_EQ(dump(text, stream, {&a}), "");
+}
@@ -29,10 +29,19 @@
 #ifndef __CPU_DECODE_CACHE_HH__
 #define __CPU_DECODE_CACHE_HH__
 
-#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "base/bitfield.hh"
 #include "base/compiler.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/types.hh"
 #include "cpu/static_inst_fwd.hh"
 
 namespace gem5
@@ -41,9 +50,211 @@ namespace gem5
 namespace decode_cache
 {
 
-/// Hash for decoded instructions.
+/**
+ * A bounded cache from a key to a value, stored in flat arrays.
+ *
+ * A hash of the key picks a set of Ways slots, and only that set is
+ * searched. The 32 bit tags and use times of a set share a cache line,
+ * and a key is only compared if its tag matches. The use times come from
+ * a counter of lookups of type Time; when it wraps, the use times are
+ * halved, which keeps them in order. When a key goes into a
+ * full set, the table doubles if it is at least a quarter full and has
+ * fewer than MaxEntries slots. Otherwise the least recently used entry
+ * of the set is replaced, so the values must be something that can be
+ * recomputed, like the result of decoding the key.
+ */
+template <typename Key, typename Value, unsigned Ways = 8,
+          typename Time = uint32_t>
+class InstTable
+{
+    static_assert(Ways <= 32 && (Ways & (Ways - 1)) == 0,
+                  "Sets are searched with a 32 bit mask.");
+    static_assert(std::is_unsigned_v<Time>, "Use times must wrap.");
+
+  public:
+    static constexpr size_t DefaultMaxEntries = 1 << 16;
+    static constexpr size_t InitialEntries = 256;
+
+    /// The result of a lookup.
+    struct Lookup
+    {
+        /// The value for the key, which is Value() if it was not found.
+        Value *value;
+        /// Whether the key was found.
+        bool hit;
+        /// How many keys were compared, which is more than one only if
+        /// tags collide.
+        unsigned probes;
+        /// Whether another key was evicted to make room for this one.
+        bool evicted;
+    };
+
+    InstTable(size_t max_entries = DefaultMaxEntries)
+        : maxEntries(std::max<size_t>(max_entries, Ways))
+    {
+        fatal_if(!isPowerOf2(maxEntries),
+                 "Decode cache size %d is not a power of 2.", maxEntries);
+        resize(std::min(maxEntries, InitialEntries));
+    }
+
+    /// Find the value for key, and if it is not there make room for it.
+    Lookup
+    lookup(const Key &key)
+    {
+        const uint64_t hash = hashOf(key);
+        const uint32_t tag = tagOf(hash);
+        const size_t set = setOf(hash);
+        Set &s = sets[set];
+        if (GEM5_UNLIKELY(++tick == 0))
+            age();
+
+        // Compare all the tags at once, and then the keys of those that
+        // match
+        uint32_t match = 0;
+        for (unsigned way = 0; way < Ways; way++)
+            match |= uint32_t(s.tags[way] == tag) << way;
+
+        Lookup result{nullptr, false, 0, false};
+        for (; match; match &= match - 1) {
+            const unsigned way = ctz32(match);
+            Entry &entry = entries[set * Ways + way];
+            result.probes++;
+            if (entry.key == key) {
+                s.lastUse[way] = tick;
+                result.value = &entry.value;
+                result.hit = true;
+                return result;
+            }
+        }
+
+        // Slots fill up in order and are never freed, so a set is full
+        // if its last slot is used. Full sets are rare below a quarter
+        // load, so only grow for them past that.
+        if (s.tags[Ways - 1] && 4 * numEntries >= capacity() &&
+                capacity() < maxEntries) {
+            resize(capacity() * 2);
+            return lookup(key);
+        }
+
+        Entry &entry = insert(tag, set, key, result.evicted);
+        entry.value = Value();
+        result.value = &entry.value;
+        return result;
+    }
+
+    /// The number of slots the table has room for right now.
+    size_t capacity() const { return entries.size(); }
+    /// The number of keys in the table.
+    size_t size() const { return numEntries; }
+
+  private:
+    // Align sets to their size, rounded up to a power of 2, so that they
+    // do not straddle cache lines
+    static constexpr size_t SetAlign =
+        size_t(1) << ceilLog2((sizeof(uint32_t) + sizeof(Time)) * Ways);
+
+    struct alignas(SetAlign) Set
+    {
+        /// Tags of the slots, 0 for a free slot.
+        uint32_t tags[Ways];
+        Time lastUse[Ways];
+    };
+
+    struct Entry
+    {
+        Key key;
+        Value value;
+    };
+
+    static uint64_t
+    hashOf(const Key &key)
+    {
+        // Spread the bits, since std::hash is often the identity
+        return std::hash<Key>()(key) * 0x9e3779b97f4a7c15ULL;
+    }
+
+    static uint32_t tagOf(uint64_t hash) { return (hash >> 8) | 1; }
+
+    size_t
+    setOf(uint64_t hash) const
+    {
+        return setBits ? hash >> (64 - setBits) : 0;
+    }
+
+    /// Put a key in its set, replacing the least recently used entry
+    /// if the set is full. @return The entry the key went into.
+    Entry &
+    insert(uint32_t tag, size_t set, const Key &key, bool &evicted)
+    {
+        Set &s = sets[set];
+        unsigned victim = 0;
+        evicted = true;
+        for (unsigned way = 0; way < Ways; way++) {
+            if (!s.tags[way]) {
+                victim = way;
+                evicted = false;
+                break;
+            }
+            if (s.lastUse[way] < s.lastUse[victim])
+                victim = way;
+        }
+        if (!evicted)
+            numEntries++;
+        s.tags[victim] = tag;
+        s.lastUse[victim] = tick;
+        Entry &entry = entries[set * Ways + victim];
+        entry.key = key;
+        return entry;
+    }
+
+    /// Halve all the use times, once the lookup counter has wrapped.
+    void
+    age()
+    {
+        for (Set &s : sets) {
+            for (unsigned way = 0; way < Ways; way++)
+                s.lastUse[way] >>= 1;
+        }
+        // Past every halved use time
+        tick = Time(1) << (8 * sizeof(Time) - 1);
+    }
+
+    void
+    resize(size_t num_entries)
+    {
+        std::vector<Set> old_sets(num_entries / Ways, Set{});
+        std::vector<Entry> old_entries(num_entries);
+        old_sets.swap(sets);
+        old_entries.swap(entries);
+        numEntries = 0;
+        setBits = floorLog2(sets.size());
+
+        for (size_t set = 0; set < old_sets.size(); set++) {
+            for (unsigned way = 0; way < Ways; way++) {
+                if (!old_sets[set].tags[way])
+                    continue;
+                Entry &old = old_entries[set * Ways + way];
+                const uint64_t hash = hashOf(old.key);
+                bool evicted;
+                Entry &entry = insert(tagOf(hash), setOf(hash), old.key,
+                                      evicted);
+                entry.value = std::move(old.value);
+            }
+        }
+    }
+
+    const size_t maxEntries;
+    size_t numEntries = 0;
+    unsigned setBits = 0;
+    Time tick = 0;
+
+    std::vector<Set> sets;
+    std::vector<Entry> entries;
+};
+
+/// Cache of decoded instructions.
 template <typename EMI>
-using InstMap = std::unordered_map<EMI, StaticInstPtr>;
+using InstMap = InstTable<EMI, StaticInstPtr>;
 
 /// A sparse map from an Addr to a Value, stored in page chunks.
 template<class Value, Addr CacheChunkShift = 12>
@@ -69,20 +280,57 @@ class AddrMap
     {
         Value items[CacheChunkBytes];
     };
-    // A map of cache chunks which allows a sparse mapping.
-    typedef typename std::unordered_map<Addr, CacheChunk *> ChunkMap;
-    typedef typename ChunkMap::iterator ChunkIt;
+
+    // An open addressed map of cache chunks which allows a sparse
+    // mapping. Chunks are handed out by reference, so they are never
+    // evicted, and the map grows instead.
+    struct ChunkSlot
+    {
+        Addr addr;
+        std::unique_ptr<CacheChunk> chunk;
+    };
+    std::vector<ChunkSlot> chunkMap;
+    size_t numChunks = 0;
+
     // Mini cache of recent lookups.
-    ChunkIt recent[2];
-    ChunkMap chunkMap;
+    std::pair<Addr, CacheChunk *> recent[2];
 
     /// Update the mini cache of recent lookups.
     /// @param recentest The most recent result;
     void
-    update(ChunkIt recentest)
+    update(Addr chunk_addr, CacheChunk *recentest)
     {
         recent[1] = recent[0];
-        recent[0] = recentest;
+        recent[0] = {chunk_addr, recentest};
+    }
+
+    size_t
+    slotOf(Addr chunk_addr) const
+    {
+        uint64_t hash = (chunk_addr >> CacheChunkShift) *
+            0x9e3779b97f4a7c15ULL;
+        return (hash >> 32) & (chunkMap.size() - 1);
+    }
+
+    /// Find the slot of a chunk, or the free slot it would go into.
+    ChunkSlot &
+    findSlot(Addr chunk_addr)
+    {
+        size_t i = slotOf(chunk_addr);
+        while (chunkMap[i].chunk && chunkMap[i].addr != chunk_addr)
+            i = (i + 1) & (chunkMap.size() - 1);
+        return chunkMap[i];
+    }
+
+    void
+    grow()
+    {
+        std::vector<ChunkSlot> old(chunkMap.size() * 2);
+        old.swap(chunkMap);
+        for (auto &slot: old) {
+            if (slot.chunk)
+                findSlot(slot.addr) = std::move(slot);
+        }
     }
 
     /// Attempt to find the CacheChunk which goes with a particular
@@ -95,36 +343,38 @@ class AddrMap
         Addr chunk_addr = chunkStart(addr);
 
         // Check against recent lookups.
-        if (recent[0] != chunkMap.end()) {
-            if (recent[0]->first == chunk_addr)
-                return recent[0]->second;
-            if (recent[1] != chunkMap.end() &&
-                    recent[1]->first == chunk_addr) {
-                update(recent[1]);
+        if (recent[0].second) {
+            if (recent[0].first == chunk_addr)
+                return recent[0].second;
+            if (recent[1].second && recent[1].first == chunk_addr) {
+                update(recent[1].first, recent[1].second);
                 // recent[1] has just become recent[0].
-                return recent[0]->second;
+                return recent[0].second;
             }
         }
 
-        // Actually look in the hash_map.
-        ChunkIt it = chunkMap.find(chunk_addr);
-        if (it != chunkMap.end()) {
-            update(it);
-            return it->second;
+        // Actually look in the hash map.
+        ChunkSlot *slot = &findSlot(chunk_addr);
+        if (!slot->chunk) {
+            // Didn't find an existing chunk, so add a new one. Keep the
+            // map at most half full so that probe sequences stay short.
+            if (2 * (numChunks + 1) > chunkMap.size()) {
+                grow();
+                slot = &findSlot(chunk_addr);
+            }
+            slot->addr = chunk_addr;
+            slot->chunk.reset(new CacheChunk());
+            numChunks++;
         }
-
-        // Didn't find an existing chunk, so add a new one.
-        CacheChunk *newChunk = new CacheChunk;
-        typename ChunkMap::value_type to_insert(chunk_addr, newChunk);
-        update(chunkMap.insert(to_insert).first);
-        return newChunk;
+        update(chunk_addr, slot->chunk.get());
+        return slot->chunk.get();
     }
 
   public:
     /// Constructor
-    AddrMap()
+    AddrMap() : chunkMap(16)
     {
-        recent[0] = recent[1] = chunkMap.end();
+        recent[0] = recent[1] = {0, nullptr};
     }
 
     Value &
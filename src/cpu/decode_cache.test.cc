@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "cpu/decode_cache.hh"
+
+using namespace gem5;
+
+using Table = decode_cache::InstTable<uint64_t, int>;
+
+TEST(InstTableTest, MissThenHit)
+{
+    Table table;
+
+    auto miss = table.lookup(42);
+    EXPECT_FALSE(miss.hit);
+    EXPECT_FALSE(miss.evicted);
+    EXPECT_EQ(*miss.value, 0);
+    *miss.value = 7;
+
+    auto hit = table.lookup(42);
+    EXPECT_TRUE(hit.hit);
+    EXPECT_GE(hit.probes, 1);
+    EXPECT_EQ(*hit.value, 7);
+
+    EXPECT_FALSE(table.lookup(43).hit);
+}
+
+TEST(InstTableTest, GrowsBeforeEvicting)
+{
+    Table table(1 << 12);
+    EXPECT_EQ(table.capacity(), Table::InitialEntries);
+
+    // Half the final size fits without evicting anything
+    for (uint64_t key = 0; key < (1 << 11); key++) {
+        auto found = table.lookup(key * 0x1000);
+        EXPECT_FALSE(found.evicted);
+        *found.value = key + 1;
+    }
+    EXPECT_GT(table.capacity(), Table::InitialEntries);
+    EXPECT_LE(table.capacity(), 1 << 12);
+
+    for (uint64_t key = 0; key < (1 << 11); key++) {
+        auto found = table.lookup(key * 0x1000);
+        ASSERT_TRUE(found.hit);
+        EXPECT_EQ(*found.value, key + 1);
+    }
+}
+
+TEST(InstTableTest, EvictsLeastRecentlyUsed)
+{
+    // A single set
+    decode_cache::InstTable<uint64_t, int, 4> table(4);
+
+    for (int key = 0; key < 4; key++)
+        *table.lookup(key).value = key + 1;
+    EXPECT_TRUE(table.lookup(0).hit);
+
+    auto found = table.lookup(4);
+    EXPECT_FALSE(found.hit);
+    EXPECT_TRUE(found.evicted);
+    EXPECT_EQ(*found.value, 0);
+    *found.value = 5;
+
+    EXPECT_EQ(table.capacity(), 4);
+    EXPECT_FALSE(table.lookup(1).hit);
+    EXPECT_EQ(*table.lookup(0).value, 1);
+    EXPECT_EQ(*table.lookup(4).value, 5);
+}
+
+TEST(InstTableTest, LeastRecentlyUsedAcrossWrap)
+{
+    // An 8 bit lookup counter wraps every 256 lookups
+    decode_cache::InstTable<uint64_t, int, 4, uint8_t> table(4);
+
+    for (int key = 0; key < 4; key++)
+        *table.lookup(key).value = key + 1;
+
+    // Key 3 is used just before the counter wraps and the other keys
+    // just after, so only ordering the use times across the wrap keeps
+    // key 3 the one to evict.
+    for (int i = 0; i < 250; i++)
+        ASSERT_TRUE(table.lookup(i % 3).hit);
+    ASSERT_TRUE(table.lookup(3).hit);
+    for (int i = 0; i < 12; i++)
+        ASSERT_TRUE(table.lookup(i % 3).hit);
+
+    EXPECT_TRUE(table.lookup(4).evicted);
+    for (int key : {0, 1, 2, 4})
+        EXPECT_TRUE(table.lookup(key).hit);
+    EXPECT_FALSE(table.lookup(3).hit);
+}
+
+TEST(AddrMapTest, Lookup)
+{
+    decode_cache::AddrMap<int> map;
+
+    // Touch enough pages to grow the chunk map
+    for (Addr page = 0; page < 100; page++)
+        map.lookup(page << 12 | 0x10) = page + 1;
+    for (Addr page = 0; page < 100; page++) {
+        EXPECT_EQ(map.lookup(page << 12 | 0x10), page + 1);
+        EXPECT_EQ(map.lookup(page << 12 | 0x14), 0);
+    }
+}
@@ -61,6 +61,15 @@ class BaseAtomicSimpleCPU(BaseSimpleCPU):
     width = Param.Int(1, "CPU width")
     simulate_data_stalls = Param.Bool(False, "Simulate dcache stall cycles")
     simulate_inst_stalls = Param.Bool(False, "Simulate icache stall cycles")
+    basic_block_cache = Param.Bool(
+        False,
+        "Reuse decoded basic blocks instead of fetching and decoding "
+        "every instruction. Instruction fetches that hit in the block "
+        "cache do not access the icache.",
+    )
+    basic_block_cache_size = Param.Unsigned(
+        16384, "Maximum number of blocks in the basic block cache"
+    )
 
     def addSimPointProbe(self, interval):
         simpoint = SimPoint()
@@ -78,16 +78,62 @@ AtomicSimpleCPU::AtomicSimpleCPU(const BaseAtomicSimpleCPUParams &p)
       width(p.width), locked(false),
       simulate_data_stalls(p.simulate_data_stalls),
       simulate_inst_stalls(p.simulate_inst_stalls),
+      decoderSkipped(false),
       icachePort(name() + ".icache_port"),
       dcachePort(name() + ".dcache_port", this),
       dcache_access(false), dcache_latency(0),
       ppCommit(nullptr)
 {
     _status = Idle;
-    ifetch_req = std::make_shared<Request>();
-    data_read_req = std::make_shared<Request>();
-    data_write_req = std::make_shared<Request>();
-    data_amo_req = std::make_shared<Request>();
+    ifetch_req = makeRequest();
+    data_read_req = makeRequest();
+    data_write_req = makeRequest();
+    data_amo_req = makeRequest();
+
+    if (p.basic_block_cache) {
+        fatal_if(numThreads > 1,
+                "The basic block cache only supports a single thread.");
+        blockCache = std::make_unique<BlockCache>(p.basic_block_cache_size);
+        blockCacheStats = std::make_unique<BlockCacheStats>(
+                this, blockCache->counts);
+    }
+}
+
+AtomicSimpleCPU::BlockCacheStats::BlockCacheStats(
+        statistics::Group *parent, BlockCache::Counts &_counts)
+    : statistics::Group(parent, "basicBlockCache"),
+      counts(_counts),
+      ADD_STAT(hits, statistics::units::Count::get(),
+               "Number of instructions taken from the basic block cache"),
+      ADD_STAT(misses, statistics::units::Count::get(),
+               "Number of instructions fetched and decoded because they "
+               "were not in the basic block cache"),
+      ADD_STAT(blockEntries, statistics::units::Count::get(),
+               "Number of times a cached block was entered from its start"),
+      ADD_STAT(blocksBuilt, statistics::units::Count::get(),
+               "Number of basic blocks added to the cache"),
+      ADD_STAT(invalidations, statistics::units::Count::get(),
+               "Number of basic blocks invalidated by writes"),
+      ADD_STAT(flushes, statistics::units::Count::get(),
+               "Number of times the basic block cache was flushed"),
+      ADD_STAT(hitRate, statistics::units::Ratio::get(),
+               "Fraction of instructions taken from the basic block cache",
+               hits / (hits + misses))
+{
+    hits.scalar(counts.hits);
+    misses.scalar(counts.misses);
+    blockEntries.scalar(counts.blockEntries);
+    blocksBuilt.scalar(counts.blocksBuilt);
+    invalidations.scalar(counts.invalidations);
+    flushes.scalar(counts.flushes);
+    hitRate.precision(6);
+}
+
+void
+AtomicSimpleCPU::BlockCacheStats::resetStats()
+{
+    counts = BlockCache::Counts();
+    statistics::Group::resetStats();
 }
 
 
@@ -148,6 +194,12 @@ AtomicSimpleCPU::drainResume()
     DPRINTF(SimpleCPU, "Resume\n");
     verifyMemoryMode();
 
+    // Memory and thread state may have changed while the CPU was drained.
+    if (blockCache) {
+        blockCache->stop();
+        blockCache->flush();
+    }
+
     assert(!threadContexts.empty());
 
     _status = BaseSimpleCPU::Idle;
@@ -298,6 +350,8 @@ AtomicSimpleCPU::AtomicCPUDPort::recvAtomicSnoop(PacketPtr pkt)
             t_info->thread->getIsaPtr()->handleLockedSnoop(pkt,
                     cacheBlockMask);
         }
+        static_cast<AtomicSimpleCPU *>(cpu)->invalidateBlocks(
+                pkt->getAddr(), pkt->getSize());
     }
 
     return 0;
@@ -325,6 +379,11 @@ AtomicSimpleCPU::AtomicCPUDPort::recvFunctionalSnoop(PacketPtr pkt)
                     cacheBlockMask);
         }
     }
+
+    if (pkt->isInvalidate() || pkt->isWrite()) {
+        static_cast<AtomicSimpleCPU *>(cpu)->invalidateBlocks(
+                pkt->getAddr(), pkt->getSize());
+    }
 }
 
 bool
@@ -503,6 +562,7 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
 
                     // Notify other threads on this CPU of write
                     threadSnoop(&pkt, curThread);
+                    invalidateBlocks(req->getPaddr(), req->getSize());
                 }
                 dcache_access = true;
                 panic_if(pkt.isError(), "Data write (%s) failed: %s",
@@ -590,6 +650,7 @@ AtomicSimpleCPU::amoMem(Addr addr, uint8_t* data, unsigned size,
             dcache_latency += req->localAccessor(thread->getTC(), &pkt);
         } else {
             dcache_latency += sendPacket(dcachePort, &pkt);
+            invalidateBlocks(req->getPaddr(), req->getSize());
         }
 
         dcache_access = true;
@@ -652,11 +713,26 @@ AtomicSimpleCPU::tick()
         const PCStateBase &pc = thread->pcState();
 
         bool needToFetch = !isRomMicroPC(pc.microPC()) && !curMacroStaticInst;
-        if (needToFetch) {
+
+        // Try to take the instruction from the block cache. Following a
+        // block needs no translation, entering one needs a translation
+        // of its first instruction.
+        const BlockCache::Entry *cached = nullptr;
+        if (needToFetch && blockCache) {
+            cached = t_info.fetchOffset ? blockCache->current() :
+                blockCache->next(pc, thread->decoder->contextVersion());
+        }
+
+        if (needToFetch && !cached) {
             ifetch_req->taskId(taskId());
             setupFetchRequest(ifetch_req);
             fault = thread->mmu->translateAtomic(ifetch_req, thread->getTC(),
                                                  BaseMMU::Execute);
+            if (blockCache && fault == NoFault && !t_info.fetchOffset) {
+                cached = blockCache->enter(pc, ifetch_req->getVaddr(),
+                        ifetch_req->getPaddr(),
+                        thread->decoder->contextVersion());
+            }
         }
 
         if (fault == NoFault) {
@@ -664,7 +740,12 @@ AtomicSimpleCPU::tick()
             bool icache_access = false;
             dcache_access = false; // assume no dcache access
 
-            if (needToFetch) {
+            if (needToFetch && !cached) {
+                if (decoderSkipped) {
+                    thread->decoder->reset();
+                    decoderSkipped = false;
+                }
+
                 // This is commented out because the decoder would act like
                 // a tiny cache otherwise. It wouldn't be flushed when needed
                 // like the I cache. It should be flushed, and when that works
@@ -677,7 +758,20 @@ AtomicSimpleCPU::tick()
                 //}
             }
 
-            preExecute();
+            if (cached) {
+                preExecuteCached(*cached);
+                decoderSkipped = true;
+            } else {
+                preExecute();
+                if (blockCache && needToFetch && !t_info.stayAtPC) {
+                    auto &decoder = thread->decoder;
+                    blockCache->record(thread->pcState(),
+                            curMacroStaticInst ? curMacroStaticInst :
+                                                 curStaticInst,
+                            t_info.fetchOffset / decoder->moreBytesSize() + 1,
+                            ifetch_req->getVaddr() + ifetch_req->getSize());
+                }
+            }
 
             Tick stall_ticks = 0;
             if (curStaticInst) {
@@ -700,6 +794,15 @@ AtomicSimpleCPU::tick()
                 }
 
                 postExecute();
+
+                // These may change memory or translations behind the
+                // CPU's back, e.g. when emulating a system call.
+                if (blockCache && (curStaticInst->isSerializing() ||
+                            curStaticInst->isNonSpeculative() ||
+                            curStaticInst->isSquashAfter() ||
+                            curStaticInst->isSyscall())) {
+                    blockCache->flush();
+                }
             }
 
             // @todo remove me after debugging with legion done
@@ -723,6 +826,8 @@ AtomicSimpleCPU::tick()
             }
 
         }
+        if (fault != NoFault && blockCache)
+            blockCache->stop();
         if (fault != NoFault || !t_info.stayAtPC)
             advancePC(fault);
     }
@@ -738,6 +843,39 @@ AtomicSimpleCPU::tick()
         reschedule(tickEvent, curTick() + latency, true);
 }
 
+void
+AtomicSimpleCPU::preExecuteCached(const BlockCache::Entry &entry)
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    SimpleThread *thread = t_info.thread;
+
+    t_info.setPredicate(true);
+    t_info.setMemAccPredicate(true);
+
+    // Step through the fetches the decoder needed for this instruction,
+    // so it takes as many cycles as it does when it isn't cached.
+    const size_t fetch_size = thread->decoder->moreBytesSize();
+    if (t_info.fetchOffset / fetch_size + 1 < entry.fetches) {
+        t_info.stayAtPC = true;
+        t_info.fetchOffset += fetch_size;
+        curStaticInst = nullptr;
+        return;
+    }
+
+    t_info.stayAtPC = false;
+    thread->pcState(*entry.decodedPC);
+
+    if (entry.inst->isMacroop()) {
+        curMacroStaticInst = entry.inst;
+        curStaticInst =
+            curMacroStaticInst->fetchMicroop(entry.decodedPC->microPC());
+    } else {
+        curStaticInst = entry.inst;
+    }
+
+    setupFetchedInst();
+}
+
 Tick
 AtomicSimpleCPU::fetchInstMem()
 {
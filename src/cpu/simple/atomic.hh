@@ -41,8 +41,13 @@
 #ifndef __CPU_SIMPLE_ATOMIC_HH__
 #define __CPU_SIMPLE_ATOMIC_HH__
 
+#include <memory>
+
+#include "base/statistics.hh"
 #include "cpu/simple/base.hh"
+#include "cpu/simple/basic_block_cache.hh"
 #include "cpu/simple/exec_context.hh"
+#include "cpu/static_inst.hh"
 #include "mem/request.hh"
 #include "params/BaseAtomicSimpleCPU.hh"
 #include "sim/probe/probe.hh"
@@ -67,9 +72,53 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     const bool simulate_data_stalls;
     const bool simulate_inst_stalls;
 
+    typedef BasicBlockCache<StaticInstPtr> BlockCache;
+
+    /** Cache of decoded basic blocks, if enabled. */
+    std::unique_ptr<BlockCache> blockCache;
+
+    struct BlockCacheStats : public statistics::Group
+    {
+        BlockCacheStats(statistics::Group *parent,
+                        BlockCache::Counts &counts);
+
+        void resetStats() override;
+
+        /** The counts kept by the cache, reported by the stats below. */
+        BlockCache::Counts &counts;
+
+        statistics::Value hits;
+        statistics::Value misses;
+        statistics::Value blockEntries;
+        statistics::Value blocksBuilt;
+        statistics::Value invalidations;
+        statistics::Value flushes;
+        statistics::Formula hitRate;
+    };
+    std::unique_ptr<BlockCacheStats> blockCacheStats;
+    /**
+     * Whether instructions were taken from the block cache since the
+     * decoder was last used, leaving the decoder's state stale.
+     */
+    bool decoderSkipped;
+
     // main simulation loop (one cycle)
     void tick();
 
+    /**
+     * Equivalent of preExecute() for an instruction taken from the
+     * block cache rather than fetched and decoded.
+     */
+    void preExecuteCached(const BlockCache::Entry &entry);
+
+    /** Drop cached blocks overlapping a write to physical memory. */
+    void
+    invalidateBlocks(Addr paddr, Addr size)
+    {
+        if (blockCache)
+            blockCache->invalidate(paddr, size);
+    }
+
     /**
      * Check if a system is in a drained state.
      *
@@ -137,6 +137,11 @@ class BaseSimpleCPU : public BaseCPU
     void setupFetchRequest(const RequestPtr &req);
     void serviceInstCountEvents();
     void preExecute();
+    /**
+     * Set up tracing and branch prediction for curStaticInst once it
+     * has been fetched, and count the fetch.
+     */
+    void setupFetchedInst();
     void postExecute();
     void advancePC(const Fault &fault);
 
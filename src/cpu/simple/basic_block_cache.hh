@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_SIMPLE_BASIC_BLOCK_CACHE_HH__
+#define __CPU_SIMPLE_BASIC_BLOCK_CACHE_HH__
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "arch/generic/pcstate.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * A cache of decoded basic blocks for the atomic CPU.
+ *
+ * Each block is a run of instructions that were fetched sequentially
+ * from one aligned region of memory, together with the PC each one was
+ * decoded at and the PC the decoder produced. The CPU can follow a block
+ * one instruction at a time without translating, fetching or decoding,
+ * as long as the PC keeps matching and the decoding context is unchanged.
+ *
+ * Blocks never span a Region, so a single translation at block entry
+ * validates every instruction in the block. Blocks are invalidated by
+ * writes to the physical memory they were fetched from.
+ *
+ * The cache counts its hits and misses, and leaves reporting them as
+ * statistics to its owner.
+ *
+ * @tparam InstPtr Pointer to a decoded instruction, a StaticInstPtr in
+ *         the CPU. It tells the cache which instructions end a block.
+ */
+template <class InstPtr>
+class BasicBlockCache
+{
+  public:
+    /**
+     * Blocks are confined to naturally aligned regions of this size,
+     * which is no larger than the smallest page of any ISA.
+     */
+    static constexpr Addr RegionBytes = 4096;
+
+    /** Maximum number of instructions in a block. */
+    static constexpr size_t MaxBlockInsts = 64;
+
+    struct Entry
+    {
+        /** PC the instruction was decoded at. */
+        std::unique_ptr<PCStateBase> pc;
+        /** PC after decoding the instruction. */
+        std::unique_ptr<PCStateBase> decodedPC;
+        /** Instruction returned by the decoder, possibly a macroop. */
+        InstPtr inst;
+        /** Number of fetches the decoder needed for this instruction. */
+        unsigned fetches;
+    };
+
+    struct Counts
+    {
+        /** Instructions taken from the cache. */
+        uint64_t hits = 0;
+        /** Instructions fetched and decoded because they weren't cached. */
+        uint64_t misses = 0;
+        /** Times a cached block was entered from its start. */
+        uint64_t blockEntries = 0;
+        /** Blocks added to the cache. */
+        uint64_t blocksBuilt = 0;
+        /** Blocks invalidated by writes. */
+        uint64_t invalidations = 0;
+        /** Times the cache was flushed. */
+        uint64_t flushes = 0;
+    };
+
+    /** Events counted so far, which the owner may reset. */
+    Counts counts;
+
+  protected:
+    struct Block
+    {
+        Block(Addr pc_addr, Addr _vaddr, Addr _paddr, uint64_t _context) :
+            pcAddr(pc_addr), vaddr(_vaddr), paddr(_paddr),
+            context(_context), start(_paddr), end(_paddr)
+        {}
+
+        /** Address of the first instruction. */
+        Addr pcAddr;
+        /** Virtual and physical address it was first fetched from. */
+        Addr vaddr;
+        Addr paddr;
+        /** Version of the decoding context the block was decoded in. */
+        uint64_t context;
+        /** Physical range of the bytes fetched for the block. */
+        Addr start;
+        Addr end;
+
+        bool valid = true;
+        std::vector<Entry> insts;
+    };
+
+    typedef std::shared_ptr<Block> BlockPtr;
+
+    const size_t maxBlocks;
+
+    /** All blocks, by the virtual address of their first instruction. */
+    std::unordered_map<Addr, BlockPtr> blocks;
+    /** All blocks, by the physical region they were fetched from. */
+    std::unordered_map<Addr, std::vector<BlockPtr>> regions;
+
+    /** The block being followed or recorded. */
+    BlockPtr cur;
+    /** Index of the next instruction in cur. */
+    size_t idx = 0;
+    /** Whether instructions are being appended to cur. */
+    bool recording = false;
+    /** The entry returned by the last hit, if the last lookup hit. */
+    const Entry *hitEntry = nullptr;
+
+    /** PC of the instruction being recorded. */
+    std::unique_ptr<PCStateBase> recordPC;
+    /** Address the instruction being recorded was first fetched from. */
+    Addr recordFetchAddr = 0;
+
+    static Addr regionOf(Addr addr) { return addr & ~(RegionBytes - 1); }
+
+    void remove(BlockPtr block);
+
+    const Entry *hit(const BlockPtr &block, size_t index);
+
+  public:
+    BasicBlockCache(size_t max_blocks) : maxBlocks(max_blocks) {}
+
+    /**
+     * Get the next instruction of the block being followed without
+     * translating its address.
+     *
+     * @param pc The current PC.
+     * @param context The decoder's current context version.
+     * @return The cached instruction at pc, or nullptr.
+     */
+    const Entry *next(const PCStateBase &pc, uint64_t context);
+
+    /**
+     * Get the instruction at pc from the start of a block. If there is
+     * no valid block there, start recording one, or keep recording the
+     * current block if pc follows on from it.
+     *
+     * @param pc The current PC.
+     * @param vaddr The virtual address the instruction is fetched from.
+     * @param paddr The physical address vaddr translates to.
+     * @param context The decoder's current context version.
+     * @return The cached instruction at pc, or nullptr.
+     */
+    const Entry *enter(const PCStateBase &pc, Addr vaddr, Addr paddr,
+                       uint64_t context);
+
+    /**
+     * Get the entry returned by the last call to next() or enter(). This
+     * is used while the CPU steps through the remaining fetches of an
+     * instruction that needed more than one.
+     */
+    const Entry *current() const { return hitEntry; }
+
+    /**
+     * Append an instruction decoded by the regular fetch path to the
+     * block being recorded, if any. The instruction must have been
+     * looked up with enter() first.
+     *
+     * @param decoded_pc The PC after decoding the instruction.
+     * @param inst The instruction returned by the decoder.
+     * @param fetches The number of fetches needed to decode it.
+     * @param fetch_end The virtual address after the last byte fetched.
+     */
+    void record(const PCStateBase &decoded_pc, const InstPtr &inst,
+                unsigned fetches, Addr fetch_end);
+
+    /** Stop following or recording the current block. */
+    void
+    stop()
+    {
+        cur = nullptr;
+        recording = false;
+        hitEntry = nullptr;
+    }
+
+    /** Drop all blocks fetched from [paddr, paddr + size). */
+    void invalidate(Addr paddr, Addr size);
+
+    /** Drop all blocks. */
+    void flush();
+};
+
+template <class InstPtr>
+const typename BasicBlockCache<InstPtr>::Entry *
+BasicBlockCache<InstPtr>::hit(const BlockPtr &block, size_t index)
+{
+    cur = block;
+    idx = index + 1;
+    recording = false;
+    hitEntry = &block->insts[index];
+    counts.hits++;
+    return hitEntry;
+}
+
+template <class InstPtr>
+const typename BasicBlockCache<InstPtr>::Entry *
+BasicBlockCache<InstPtr>::next(const PCStateBase &pc, uint64_t context)
+{
+    hitEntry = nullptr;
+    if (!cur || recording || !cur->valid || idx >= cur->insts.size() ||
+            cur->context != context || *cur->insts[idx].pc != pc) {
+        return nullptr;
+    }
+    return hit(cur, idx);
+}
+
+template <class InstPtr>
+const typename BasicBlockCache<InstPtr>::Entry *
+BasicBlockCache<InstPtr>::enter(const PCStateBase &pc, Addr vaddr,
+                                Addr paddr, uint64_t context)
+{
+    hitEntry = nullptr;
+
+    const Addr pc_addr = pc.instAddr();
+    auto it = blocks.find(pc_addr);
+    if (it != blocks.end()) {
+        const BlockPtr &block = it->second;
+        if (block->paddr - block->vaddr == paddr - vaddr &&
+                block->context == context && *block->insts[0].pc == pc) {
+            counts.blockEntries++;
+            return hit(block, 0);
+        }
+    }
+
+    counts.misses++;
+
+    // Keep recording the current block if this instruction can go in it.
+    if (recording && !cur->insts.empty() && it == blocks.end() &&
+            regionOf(vaddr) == regionOf(cur->vaddr) &&
+            paddr - vaddr == cur->paddr - cur->vaddr &&
+            context == cur->context) {
+        set(recordPC, pc);
+        recordFetchAddr = vaddr;
+        return nullptr;
+    }
+
+    if (blocks.size() >= maxBlocks)
+        flush();
+
+    cur = std::make_shared<Block>(pc_addr, vaddr, paddr, context);
+    idx = 0;
+    recording = true;
+    set(recordPC, pc);
+    recordFetchAddr = vaddr;
+    return nullptr;
+}
+
+template <class InstPtr>
+void
+BasicBlockCache<InstPtr>::record(const PCStateBase &decoded_pc,
+                        const InstPtr &inst, unsigned fetches,
+                        Addr fetch_end)
+{
+    if (!recording)
+        return;
+
+    // The instruction runs into the next region, so it can't be
+    // validated by the translation of the block's first instruction.
+    if (regionOf(fetch_end - 1) != regionOf(cur->vaddr)) {
+        stop();
+        return;
+    }
+
+    if (cur->insts.empty()) {
+        auto it = blocks.find(cur->pcAddr);
+        if (it != blocks.end())
+            remove(it->second);
+        blocks[cur->pcAddr] = cur;
+        regions[regionOf(cur->paddr)].push_back(cur);
+        counts.blocksBuilt++;
+    }
+
+    Entry entry;
+    entry.pc = std::move(recordPC);
+    set(entry.decodedPC, decoded_pc);
+    entry.inst = inst;
+    entry.fetches = fetches;
+    cur->insts.push_back(std::move(entry));
+
+    cur->start = std::min(cur->start,
+            cur->paddr + (recordFetchAddr - cur->vaddr));
+    cur->end = std::max(cur->end, cur->paddr + (fetch_end - cur->vaddr));
+
+    if (inst->isControl() || inst->isSerializing() ||
+            inst->isNonSpeculative() || inst->isSquashAfter() ||
+            inst->isSyscall() || cur->insts.size() >= MaxBlockInsts) {
+        stop();
+    }
+}
+
+template <class InstPtr>
+void
+BasicBlockCache<InstPtr>::remove(BlockPtr block)
+{
+    block->valid = false;
+
+    auto it = blocks.find(block->pcAddr);
+    if (it != blocks.end() && it->second == block)
+        blocks.erase(it);
+
+    auto rit = regions.find(regionOf(block->paddr));
+    if (rit != regions.end()) {
+        auto &list = rit->second;
+        list.erase(std::remove(list.begin(), list.end(), block), list.end());
+        if (list.empty())
+            regions.erase(rit);
+    }
+
+    // Leave cur and hitEntry alone, the CPU may still be stepping through
+    // the fetches of an instruction it got from this block.
+    if (block == cur)
+        recording = false;
+}
+
+template <class InstPtr>
+void
+BasicBlockCache<InstPtr>::invalidate(Addr paddr, Addr size)
+{
+    if (regions.empty() || size == 0)
+        return;
+
+    std::vector<BlockPtr> stale;
+    auto check = [&](const std::vector<BlockPtr> &list) {
+        for (const auto &block: list) {
+            if (block->start < paddr + size && paddr < block->end)
+                stale.push_back(block);
+        }
+    };
+
+    // A write may cross into later regions. Large writes, e.g. loading a
+    // memory image, touch more regions than there are blocks, so scan the
+    // blocks instead of looking each region up.
+    const Addr first = regionOf(paddr);
+    const Addr last = regionOf(paddr + size - 1);
+    if ((last - first) / RegionBytes >= regions.size()) {
+        for (const auto &[region, list]: regions) {
+            if (region >= first && region <= last)
+                check(list);
+        }
+    } else {
+        for (Addr region = first; ; region += RegionBytes) {
+            auto it = regions.find(region);
+            if (it != regions.end())
+                check(it->second);
+            if (region == last)
+                break;
+        }
+    }
+
+    for (const auto &block: stale) {
+        remove(block);
+        counts.invalidations++;
+    }
+}
+
+template <class InstPtr>
+void
+BasicBlockCache<InstPtr>::flush()
+{
+    if (cur) {
+        cur->valid = false;
+        recording = false;
+    }
+    blocks.clear();
+    regions.clear();
+    counts.flushes++;
+}
+
+} // namespace gem5
+
+#endif // __CPU_SIMPLE_BASIC_BLOCK_CACHE_HH__
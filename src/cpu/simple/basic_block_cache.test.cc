@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "arch/generic/pcstate.hh"
+#include "cpu/simple/basic_block_cache.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+typedef GenericISA::SimplePCState<4> PCState;
+
+/** Stands in for a decoded instruction, only control ends a block. */
+struct TestInst
+{
+    bool control;
+
+    bool isControl() const { return control; }
+    bool isSerializing() const { return false; }
+    bool isNonSpeculative() const { return false; }
+    bool isSquashAfter() const { return false; }
+    bool isSyscall() const { return false; }
+};
+
+typedef const TestInst *TestInstPtr;
+typedef BasicBlockCache<TestInstPtr> TestCache;
+
+class BasicBlockCacheTest : public testing::Test
+{
+  protected:
+    TestCache cache{16};
+
+    const TestInst plainInst{false};
+    const TestInst branchInst{true};
+    TestInstPtr plain = &plainInst;
+    TestInstPtr branch = &branchInst;
+
+    /** Physical minus virtual address of the instructions. */
+    Addr offset = 0x10000;
+    uint64_t context = 0;
+
+    /**
+     * Run the instruction at pc the way the atomic CPU does: follow the
+     * current block, then try to enter one, and otherwise record the
+     * instruction as if it had been fetched and decoded.
+     *
+     * @return The cached entry, or nullptr if the instruction was
+     *         recorded.
+     */
+    const TestCache::Entry *
+    step(Addr pc_addr, TestInstPtr inst, unsigned bytes = 4)
+    {
+        PCState pc(pc_addr);
+        const TestCache::Entry *entry = cache.next(pc, context);
+        if (!entry)
+            entry = cache.enter(pc, pc_addr, pc_addr + offset, context);
+        if (!entry)
+            cache.record(pc, inst, 1, pc_addr + bytes);
+        return entry;
+    }
+
+    /** Check if a block starts at pc without recording one. */
+    bool
+    cached(TestCache &c, Addr pc_addr)
+    {
+        const TestCache::Entry *entry =
+            c.enter(PCState(pc_addr), pc_addr, pc_addr + offset, context);
+        c.stop();
+        return entry;
+    }
+};
+
+} // anonymous namespace
+
+TEST_F(BasicBlockCacheTest, RecordAndFollow)
+{
+    for (Addr pc = 0x1000; pc < 0x100c; pc += 4)
+        EXPECT_EQ(step(pc, plain), nullptr);
+    EXPECT_EQ(step(0x100c, branch), nullptr);
+    EXPECT_EQ(cache.counts.blocksBuilt, 1);
+    EXPECT_EQ(cache.counts.misses, 4);
+
+    for (Addr pc = 0x1000; pc < 0x1010; pc += 4) {
+        const TestCache::Entry *entry = step(pc, plain);
+        ASSERT_NE(entry, nullptr);
+        EXPECT_EQ(cache.current(), entry);
+        EXPECT_EQ(entry->pc->instAddr(), pc);
+        EXPECT_EQ(entry->decodedPC->instAddr(), pc);
+        EXPECT_EQ(entry->inst, pc == 0x100c ? branch : plain);
+        EXPECT_EQ(entry->fetches, 1);
+    }
+    EXPECT_EQ(cache.counts.hits, 4);
+    EXPECT_EQ(cache.counts.blockEntries, 1);
+}
+
+TEST_F(BasicBlockCacheTest, ContextMismatch)
+{
+    for (Addr pc = 0x1000; pc < 0x100c; pc += 4)
+        step(pc, plain);
+    step(0x100c, branch);
+
+    // The decoder changed state while following the block
+    ASSERT_NE(step(0x1000, plain), nullptr);
+    context = 1;
+    EXPECT_EQ(cache.next(PCState(0x1004), context), nullptr);
+
+    // The block can't be entered either, and is decoded again
+    EXPECT_EQ(step(0x1000, plain), nullptr);
+    for (Addr pc = 0x1004; pc < 0x100c; pc += 4)
+        EXPECT_EQ(step(pc, plain), nullptr);
+    EXPECT_EQ(step(0x100c, branch), nullptr);
+    EXPECT_EQ(cache.counts.blocksBuilt, 2);
+
+    ASSERT_NE(step(0x1000, plain), nullptr);
+    context = 0;
+    EXPECT_EQ(step(0x1004, plain), nullptr);
+}
+
+TEST_F(BasicBlockCacheTest, TranslationMismatch)
+{
+    step(0x1000, plain);
+    step(0x1004, branch);
+
+    // The page was mapped somewhere else
+    PCState pc(0x1000);
+    EXPECT_EQ(cache.enter(pc, 0x1000, 0x1000 + offset + 0x4000, context),
+              nullptr);
+    EXPECT_EQ(cache.counts.blockEntries, 0);
+    EXPECT_NE(cache.enter(pc, 0x1000, 0x1000 + offset, context), nullptr);
+    EXPECT_EQ(cache.counts.blockEntries, 1);
+}
+
+TEST_F(BasicBlockCacheTest, EndsAtControl)
+{
+    step(0x1000, plain);
+    step(0x1004, branch);
+    step(0x1008, plain);
+    step(0x100c, branch);
+    EXPECT_EQ(cache.counts.blocksBuilt, 2);
+
+    ASSERT_NE(step(0x1000, plain), nullptr);
+    ASSERT_NE(step(0x1004, plain), nullptr);
+    EXPECT_EQ(cache.counts.blockEntries, 1);
+
+    // The next block has to be entered with a translation
+    EXPECT_EQ(cache.next(PCState(0x1008), context), nullptr);
+    ASSERT_NE(step(0x1008, plain), nullptr);
+    EXPECT_EQ(cache.counts.blockEntries, 2);
+}
+
+TEST_F(BasicBlockCacheTest, EndsAtRegion)
+{
+    const Addr region = TestCache::RegionBytes;
+    step(region - 8, plain);
+    step(region - 4, plain);
+    step(region, plain);
+    step(region + 4, branch);
+    EXPECT_EQ(cache.counts.blocksBuilt, 2);
+
+    ASSERT_NE(step(region - 8, plain), nullptr);
+    ASSERT_NE(step(region - 4, plain), nullptr);
+    EXPECT_EQ(cache.next(PCState(region), context), nullptr);
+    ASSERT_NE(step(region, plain), nullptr);
+    EXPECT_EQ(cache.counts.blockEntries, 2);
+}
+
+TEST_F(BasicBlockCacheTest, InstructionCrossesRegion)
+{
+    const Addr region = TestCache::RegionBytes;
+    step(region - 8, plain);
+    step(region - 4, plain, 8);
+    step(region + 4, branch);
+
+    // The instruction fetched from both regions is never cached
+    ASSERT_NE(step(region - 8, plain), nullptr);
+    EXPECT_EQ(step(region - 4, plain, 8), nullptr);
+    EXPECT_EQ(step(region - 4, plain, 8), nullptr);
+    EXPECT_EQ(cache.counts.blocksBuilt, 2);
+}
+
+TEST_F(BasicBlockCacheTest, InvalidateWhileFollowing)
+{
+    for (Addr pc = 0x1000; pc < 0x100c; pc += 4)
+        step(pc, plain);
+    step(0x100c, branch);
+
+    const TestCache::Entry *entry = step(0x1000, plain);
+    ASSERT_NE(entry, nullptr);
+
+    // A store overwrites the last instruction of the block
+    cache.invalidate(0x100c + offset, 4);
+    EXPECT_EQ(cache.counts.invalidations, 1);
+
+    // The entry being executed stays usable, but nothing else is taken
+    // from the block.
+    EXPECT_EQ(cache.current(), entry);
+    EXPECT_EQ(entry->inst, plain);
+    EXPECT_EQ(cache.next(PCState(0x1004), context), nullptr);
+    EXPECT_EQ(step(0x1000, plain), nullptr);
+}
+
+TEST_F(BasicBlockCacheTest, InvalidateOtherBytes)
+{
+    step(0x1000, plain);
+    step(0x1004, branch);
+
+    cache.invalidate(0x1008 + offset, 4);
+    cache.invalidate(0xffc + offset, 4);
+    EXPECT_EQ(cache.counts.invalidations, 0);
+    EXPECT_NE(step(0x1000, plain), nullptr);
+}
+
+TEST_F(BasicBlockCacheTest, InvalidateAcrossRegions)
+{
+    const Addr region = TestCache::RegionBytes;
+    step(region + 8, plain);
+    step(region + 12, branch);
+    step(3 * region, branch);
+
+    // The writes start in the region before the first block
+    cache.invalidate(region - 4 + offset, 12);
+    EXPECT_EQ(cache.counts.invalidations, 0);
+    cache.invalidate(region - 4 + offset, 16);
+    EXPECT_EQ(cache.counts.invalidations, 1);
+    EXPECT_FALSE(cached(cache, region + 8));
+    EXPECT_TRUE(cached(cache, 3 * region));
+
+    // A write covering more regions than there are blocks
+    cache.invalidate(offset, 64 * region);
+    EXPECT_EQ(cache.counts.invalidations, 2);
+    EXPECT_FALSE(cached(cache, 3 * region));
+}
+
+TEST_F(BasicBlockCacheTest, FlushWhenFull)
+{
+    TestCache small(2);
+    for (Addr pc: {0x1000, 0x2000}) {
+        ASSERT_FALSE(cached(small, pc));
+        small.enter(PCState(pc), pc, pc + offset, context);
+        small.record(PCState(pc), branch, 1, pc + 4);
+    }
+    EXPECT_TRUE(cached(small, 0x1000));
+    EXPECT_TRUE(cached(small, 0x2000));
+    EXPECT_EQ(small.counts.flushes, 0);
+
+    // Starting a third block drops the first two
+    small.enter(PCState(0x3000), 0x3000, 0x3000 + offset, context);
+    small.record(PCState(0x3000), branch, 1, 0x3004);
+    EXPECT_EQ(small.counts.flushes, 1);
+    EXPECT_TRUE(cached(small, 0x3000));
+    EXPECT_FALSE(cached(small, 0x1000));
+    EXPECT_FALSE(cached(small, 0x2000));
+}
@@ -283,6 +283,12 @@ class ComputeUnit(ClockedObject):
     fetch_depth = Param.Int(
         2, "number of i-cache lines that may be buffered in the fetch unit."
     )
+    skip_idle_cycles = Param.Bool(
+        False,
+        "Stop ticking the pipeline while every wavefront is blocked on "
+        "memory or a barrier and resume when a response or dispatch "
+        "arrives. Idle-cycle stats are accounted for the skipped cycles.",
+    )
 
 
 class Shader(ClockedObject):
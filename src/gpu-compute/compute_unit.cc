@@ -114,6 +114,7 @@ ComputeUnit::ComputeUnit(const Params &p) : ClockedObject(p),
     sqcTLBPort(csprintf("%s-port", name()), this),
     _cacheLineSize(p.system->cacheLineSize()),
     _numBarrierSlots(p.num_barrier_slots),
+    skipIdleCycles(p.skip_idle_cycles), quiesced(false),
     globalSeqNum(0), wavefrontSize(p.wf_size),
     scoreboardCheckToSchedule(p),
     scheduleToExecute(p),
@@ -462,6 +463,7 @@ void
 ComputeUnit::dispWorkgroup(HSAQueueEntry *task, int num_wfs_in_wg)
 {
     // If we aren't ticking, start it up!
+    wakeUp();
     if (!tickEvent.scheduled()) {
         DPRINTF(GPUDisp, "CU%d: Scheduling wakeup next cycle\n", cu_id);
         schedule(tickEvent, nextCycle());
@@ -783,7 +785,16 @@ ComputeUnit::exec()
 
     // Put this CU to sleep if there is no more work to be done.
     if (!isDone()) {
-        schedule(tickEvent, nextCycle());
+        if (skipIdleCycles && isQuiescent()) {
+            // Nothing can change until a response, retry or dispatch
+            // arrives, so stop ticking until wakeUp() is called.
+            quiesced = true;
+            quiesceCycle = curCycle() + Cycles(1);
+            DPRINTF(GPUDisp, "CU%d: Quiescent, skipping idle cycles\n",
+                    cu_id);
+        } else {
+            schedule(tickEvent, nextCycle());
+        }
     } else {
         shader->notifyCuSleep();
         DPRINTF(GPUDisp, "CU%d: Going to sleep\n", cu_id);
@@ -848,6 +859,8 @@ ComputeUnit::DataPort::recvTimingResp(PacketPtr pkt)
 bool
 ComputeUnit::DataPort::handleResponse(PacketPtr pkt)
 {
+    computeUnit->wakeUp();
+
     // Ruby has completed the memory op. Schedule the mem_resp_event at the
     // appropriate cycle to process the timing memory response
     // This delay represents the pipeline delay
@@ -974,6 +987,8 @@ ComputeUnit::ScalarDataPort::recvTimingResp(PacketPtr pkt)
 bool
 ComputeUnit::ScalarDataPort::handleResponse(PacketPtr pkt)
 {
+    computeUnit->wakeUp();
+
     // From scalar cache invalidate that was issued at kernel start.
     if (pkt->req->isKernel()) {
         delete pkt->senderState;
@@ -1020,6 +1035,8 @@ ComputeUnit::ScalarDataPort::handleResponse(PacketPtr pkt)
 void
 ComputeUnit::ScalarDataPort::recvReqRetry()
 {
+    computeUnit->wakeUp();
+
     for (const auto &pkt : retries) {
         if (!sendTimingReq(pkt)) {
             break;
@@ -1032,6 +1049,8 @@ ComputeUnit::ScalarDataPort::recvReqRetry()
 void
 ComputeUnit::DataPort::recvReqRetry()
 {
+    computeUnit->wakeUp();
+
     int len = retries.size();
 
     assert(len > 0);
@@ -1077,12 +1096,16 @@ ComputeUnit::SQCPort::recvTimingResp(PacketPtr pkt)
 void
 ComputeUnit::handleSQCReturn(PacketPtr pkt)
 {
+    // Fetches return here from the SQC port and from the system hub
+    wakeUp();
     fetchStage.processFetchReturn(pkt);
 }
 
 void
 ComputeUnit::SQCPort::recvReqRetry()
 {
+    computeUnit->wakeUp();
+
     int len = retries.size();
 
     assert(len > 0);
@@ -1453,6 +1476,8 @@ ComputeUnit::sendInvL2(Addr paddr)
 void
 ComputeUnit::DataPort::processMemRespEvent(PacketPtr pkt)
 {
+    computeUnit->wakeUp();
+
     DataPort::SenderState *sender_state =
         safe_cast<DataPort::SenderState*>(pkt->senderState);
 
@@ -1535,6 +1560,8 @@ ComputeUnit::DataPort::processMemRespEvent(PacketPtr pkt)
 bool
 ComputeUnit::DTLBPort::recvTimingResp(PacketPtr pkt)
 {
+    computeUnit->wakeUp();
+
     Addr line = pkt->req->getPaddr();
 
     DPRINTF(GPUTLB, "CU%d: DTLBPort received %#x->%#x\n", computeUnit->cu_id,
@@ -1807,6 +1834,8 @@ ComputeUnit::ScalarDataPort::MemReqEvent::process()
 void
 ComputeUnit::DTLBPort::recvReqRetry()
 {
+    computeUnit->wakeUp();
+
     int len = retries.size();
 
     DPRINTF(GPUTLB, "CU%d: DTLB recvReqRetry - %d pending requests\n",
@@ -1838,6 +1867,8 @@ ComputeUnit::DTLBPort::recvReqRetry()
 bool
 ComputeUnit::ScalarDTLBPort::recvTimingResp(PacketPtr pkt)
 {
+    computeUnit->wakeUp();
+
     assert(pkt->senderState);
 
     GpuTranslationState *translation_state =
@@ -1909,6 +1940,8 @@ ComputeUnit::ScalarDTLBPort::recvTimingResp(PacketPtr pkt)
 bool
 ComputeUnit::ITLBPort::recvTimingResp(PacketPtr pkt)
 {
+    computeUnit->wakeUp();
+
     [[maybe_unused]] Addr line = pkt->req->getPaddr();
     DPRINTF(GPUTLB, "CU%d: ITLBPort received %#x->%#x\n",
             computeUnit->cu_id, pkt->req->getVaddr(), line);
@@ -1962,6 +1995,8 @@ ComputeUnit::ITLBPort::recvTimingResp(PacketPtr pkt)
 void
 ComputeUnit::ITLBPort::recvReqRetry()
 {
+    computeUnit->wakeUp();
+
 
     int len = retries.size();
     DPRINTF(GPUTLB, "CU%d: ITLB recvReqRetry - %d pending requests\n", len);
@@ -2164,6 +2199,68 @@ ComputeUnit::getRefCounter(const uint32_t dispatchId,
     return lds.getRefCounter(dispatchId, wgId);
 }
 
+bool
+ComputeUnit::isQuiescent()
+{
+    for (int simd = 0; simd < numVectorALUs; ++simd) {
+        for (Wavefront *w : wfList[simd]) {
+            switch (w->getStatus()) {
+              case Wavefront::S_STOPPED:
+              case Wavefront::S_RETURNING:
+                break;
+              case Wavefront::S_WAITCNT:
+                if (!w->waitCntsPending()) {
+                    return false;
+                }
+                break;
+              case Wavefront::S_BARRIER:
+                if (allAtBarrier(w->barrierId())) {
+                    return false;
+                }
+                break;
+              default:
+                return false;
+            }
+        }
+    }
+
+    return fetchStage.quiescent() && scheduleStage.quiescent() &&
+           globalMemoryPipe.quiescent() && localMemoryPipe.quiescent() &&
+           scalarMemoryPipe.quiescent();
+}
+
+void
+ComputeUnit::wakeUp()
+{
+    if (!quiesced) {
+        return;
+    }
+
+    assert(!tickEvent.scheduled());
+    quiesced = false;
+
+    // If we are exactly on a clock edge, treat this cycle's tick as
+    // having already happened, so the pipeline sees the event next
+    // cycle just as it would had the CU been ticking all along.
+    Cycles resume = curCycle();
+    if (clockEdge() == curTick()) {
+        resume += Cycles(1);
+    }
+
+    assert(resume >= quiesceCycle);
+    Cycles skipped = resume - quiesceCycle;
+    DPRINTF(GPUDisp, "CU%d: Waking up after %d idle cycles\n", cu_id,
+            skipped);
+
+    stats.totalCycles += skipped;
+    stats.skippedIdleCycles += skipped;
+    scoreboardCheckStage.recordIdleCycles(skipped);
+    scheduleStage.recordIdleCycles(skipped);
+    execStage.recordIdleCycles(skipped);
+
+    schedule(tickEvent, clockEdge(resume - curCycle()));
+}
+
 bool
 ComputeUnit::isVectorAluIdle(uint32_t simdId) const
 {
@@ -2215,6 +2312,8 @@ ComputeUnit::vramRequestorId()
 bool
 ComputeUnit::LDSPort::recvTimingResp(PacketPtr packet)
 {
+    computeUnit->wakeUp();
+
     const ComputeUnit::LDSPort::SenderState *senderState =
         dynamic_cast<ComputeUnit::LDSPort::SenderState *>(packet->senderState);
 
@@ -2279,6 +2378,8 @@ ComputeUnit::LDSPort::sendTimingReq(PacketPtr pkt)
 void
 ComputeUnit::LDSPort::recvReqRetry()
 {
+    computeUnit->wakeUp();
+
     auto queueSize = retries.size();
 
     DPRINTF(GPUPort, "CU%d: LDSPort recvReqRetry - %d pending requests\n",
@@ -2464,6 +2565,8 @@ ComputeUnit::ComputeUnitStats::ComputeUnitStats(statistics::Group *parent,
       ADD_STAT(numVecOpsExecutedTwoOpFP,
                "number of two op FP vec ops executed (e.g. WF size/inst)"),
       ADD_STAT(totalCycles, "number of cycles the CU ran for"),
+      ADD_STAT(skippedIdleCycles, "number of cycles the CU was quiescent "
+               "and not ticked"),
       ADD_STAT(vpc, "Vector Operations per cycle (this CU only)"),
       ADD_STAT(vpc_f16, "F16 Vector Operations per cycle (this CU only)"),
       ADD_STAT(vpc_f32, "F32 Vector Operations per cycle (this CU only)"),
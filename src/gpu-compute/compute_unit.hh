@@ -472,6 +472,22 @@ class ComputeUnit : public ClockedObject
     bool isDone() const;
     bool isVectorAluIdle(uint32_t simdId) const;
 
+    /**
+     * True if ticking the pipeline cannot change any state until an
+     * external event arrives: every wave is stopped, waiting at a
+     * barrier that has not been reached by all its members, or waiting
+     * on an s_waitcnt for outstanding memory operations, and no stage
+     * holds work. Only called when skipIdleCycles is set.
+     */
+    bool isQuiescent();
+    /**
+     * Restart the tick event of a CU that stopped ticking because it
+     * was quiescent, accounting the per-cycle stats for the skipped
+     * cycles. Must be called by every event that may make a quiescent
+     * CU runnable before it changes any CU state. A no-op otherwise.
+     */
+    void wakeUp();
+
     void handleSQCReturn(PacketPtr pkt);
 
     void sendInvL2(Addr paddr);
@@ -969,6 +985,15 @@ class ComputeUnit : public ClockedObject
   private:
     const int _cacheLineSize;
     const int _numBarrierSlots;
+
+    /**
+     * Stop ticking while quiescent rather than spinning through
+     * cycles in which nothing can happen. quiesceCycle is the first
+     * cycle that was not ticked.
+     */
+    const bool skipIdleCycles;
+    bool quiesced;
+    Cycles quiesceCycle;
     int cacheLineBits;
     InstSeqNum globalSeqNum;
     int wavefrontSize;
@@ -1150,6 +1175,9 @@ class ComputeUnit : public ClockedObject
         statistics::Scalar numVecOpsExecutedTwoOpFP;
         // Total cycles that something is running on the GPU
         statistics::Scalar totalCycles;
+        // Cycles in totalCycles during which the CU was quiescent and
+        // its pipeline was not ticked
+        statistics::Scalar skippedIdleCycles;
         statistics::Formula vpc; // vector ops per cycle
         statistics::Formula vpc_f16; // vector ops per cycle
         statistics::Formula vpc_f32; // vector ops per cycle
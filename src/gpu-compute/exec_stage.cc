@@ -99,6 +99,27 @@ ExecStage::collectStatistics(enum STAT_STATUS stage, int unitId) {
     }
 }
 
+void
+ExecStage::recordIdleCycles(Cycles n)
+{
+    if (n == 0) {
+        return;
+    }
+
+    for (int unitId = 0; unitId < computeUnit.numExeUnits(); ++unitId) {
+        stats.numCyclesWithNoInstrTypeIssued[unitId] += n;
+    }
+
+    if (lastTimeInstExecuted) {
+        ++stats.numTransActiveIdle;
+    }
+    idle_dur += n;
+    lastTimeInstExecuted = false;
+
+    stats.numCyclesWithNoIssue += n;
+    stats.spc.sample(0, n);
+}
+
 void
 ExecStage::initStatistics()
 {
@@ -39,6 +39,7 @@
 
 #include "base/statistics.hh"
 #include "base/stats/group.hh"
+#include "base/types.hh"
 
 namespace gem5
 {
@@ -78,6 +79,11 @@ class ExecStage
     ~ExecStage() { }
     void init();
     void exec();
+    /**
+     * Account for cycles the CU skipped while quiescent, updating the
+     * stats as n calls to exec() with an empty dispatch list would.
+     */
+    void recordIdleCycles(Cycles n);
 
     std::string dispStatusToStr(int j);
     void dumpDispList();
@@ -69,6 +69,17 @@ FetchStage::exec()
     }
 }
 
+bool
+FetchStage::quiescent() const
+{
+    for (const auto &fetch_unit : _fetchUnit) {
+        if (!fetch_unit.quiescent()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void
 FetchStage::processFetchReturn(PacketPtr pkt)
 {
@@ -58,6 +58,7 @@ class FetchStage
     ~FetchStage();
     void init();
     void exec();
+    bool quiescent() const;
     void processFetchReturn(PacketPtr pkt);
     void fetch(PacketPtr pkt, Wavefront *wave);
 
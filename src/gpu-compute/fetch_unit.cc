@@ -132,6 +132,32 @@ FetchUnit::exec()
     }
 }
 
+bool
+FetchUnit::quiescent() const
+{
+    if (!fetchQueue.empty()) {
+        return false;
+    }
+
+    for (int j = 0; j < computeUnit.shader->n_wf; ++j) {
+        if (!fetchBuf[j].idle()) {
+            return false;
+        }
+
+        // mirrors the fetch eligibility check in exec()
+        Wavefront *wave = fetchStatusQueue[j].first;
+        if (!fetchStatusQueue[j].second &&
+            (wave->getStatus() == Wavefront::S_RUNNING ||
+             wave->getStatus() == Wavefront::S_WAITCNT) &&
+            fetchBuf[j].hasFreeSpace() && !wave->stopFetch() &&
+            !wave->pendingFetch) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void
 FetchUnit::initiateFetch(Wavefront *wavefront)
 {
@@ -659,6 +685,26 @@ FetchUnit::FetchBufDesc::splitDecode() const
     return is_split;
 }
 
+bool
+FetchUnit::FetchBufDesc::idle() const
+{
+    if (hasFetchDataToProcess() &&
+        (splitDecode() || wavefront->instructionBuffer.size() < maxIbSize)) {
+        return false;
+    }
+
+    if (!hasFreeSpace()) {
+        Addr cur_wave_pc = roundDown(wavefront->pc(),
+                                     wavefront->computeUnit->cacheLineSize());
+        if (reservedPCs.find(cur_wave_pc) == reservedPCs.end() &&
+            bufferedPCs.find(cur_wave_pc) != bufferedPCs.begin()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 int
 FetchUnit::FetchBufDesc::fetchBytesRemaining() const
 {
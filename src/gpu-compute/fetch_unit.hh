@@ -64,6 +64,11 @@ class FetchUnit
     void fetch(PacketPtr pkt, Wavefront *wavefront);
     void processFetchReturn(PacketPtr pkt);
     void flushBuf(int wfSlotId);
+    /**
+     * true if exec() would do nothing: no buffer can decode or release
+     * data and no wave is, or could become, ready to fetch.
+     */
+    bool quiescent() const;
     static uint32_t globalFetchUnitID;
 
   private:
@@ -185,6 +190,12 @@ class FetchUnit
          */
         int fetchBytesRemaining() const;
 
+        /**
+         * true if neither decodeInsts() nor checkWaveReleaseBuf()
+         * would make progress on this buffer if called now.
+         */
+        bool idle() const;
+
       private:
         void decodeSplitInst();
 
@@ -63,6 +63,18 @@ class GlobalMemPipeline
     void init();
     void exec();
 
+    /**
+     * True if exec() has nothing to do: no request is waiting to be
+     * issued and the oldest outstanding response has not returned.
+     */
+    bool
+    quiescent() const
+    {
+        return gmIssuedRequests.empty() &&
+               (gmOrderedRespBuffer.empty() ||
+                !gmOrderedRespBuffer.begin()->second.second);
+    }
+
     /**
      * Find the next ready response to service. In order to ensure
      * that no waitcnts are violated, we pop the oldest (in program order)
@@ -59,6 +59,11 @@ class LocalMemPipeline
   public:
     LocalMemPipeline(const ComputeUnitParams &p, ComputeUnit &cu);
     void exec();
+    bool
+    quiescent() const
+    {
+        return lmIssuedRequests.empty() && lmReturnedRequests.empty();
+    }
     std::queue<GPUDynInstPtr> &getLMRespFIFO() { return lmReturnedRequests; }
 
     void issueRequest(GPUDynInstPtr gpuDynInst);
@@ -61,6 +61,12 @@ class ScalarMemPipeline
   public:
     ScalarMemPipeline(const ComputeUnitParams &p, ComputeUnit &cu);
     void exec();
+    bool
+    quiescent() const
+    {
+        return issuedRequests.empty() && returnedLoads.empty() &&
+               returnedStores.empty();
+    }
 
     std::queue<GPUDynInstPtr> &getGMReqFIFO() { return issuedRequests; }
     std::queue<GPUDynInstPtr> &getGMStRespFIFO() { return returnedStores; }
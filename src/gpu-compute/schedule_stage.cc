@@ -210,6 +210,30 @@ ScheduleStage::exec()
     reserveResources();
 }
 
+bool
+ScheduleStage::quiescent()
+{
+    for (int j = 0; j < computeUnit.numExeUnits(); ++j) {
+        if (!fromScoreboardCheck.readyWFs(j).empty() ||
+            !schList.at(j).empty() ||
+            toExecute.dispatchStatus(j) != EMPTY) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+ScheduleStage::recordIdleCycles(Cycles n)
+{
+    // with nothing ready and nothing in flight, every exec() finds an
+    // empty readyList and an empty schList for each resource
+    for (int j = 0; j < computeUnit.numExeUnits(); ++j) {
+        stats.rdyListEmpty[j] += n;
+        stats.schListToDispListStalls[j] += n;
+    }
+}
+
 void
 ScheduleStage::doDispatchListTransition(int unitId, DISPATCH_STATUS s,
                                         const GPUDynInstPtr &gpu_dyn_inst)
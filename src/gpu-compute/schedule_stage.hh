@@ -40,6 +40,7 @@
 
 #include "base/statistics.hh"
 #include "base/stats/group.hh"
+#include "base/types.hh"
 #include "gpu-compute/exec_stage.hh"
 #include "gpu-compute/misc.hh"
 #include "gpu-compute/scheduler.hh"
@@ -69,6 +70,17 @@ class ScheduleStage
     void init();
     void exec();
 
+    /**
+     * True if no wave is on a ready list, the schList or the dispatch
+     * list, i.e., exec() would only update idle stats.
+     */
+    bool quiescent();
+    /**
+     * Account for cycles the CU skipped while quiescent. Updates the
+     * stats exactly as n calls to exec() would have.
+     */
+    void recordIdleCycles(Cycles n);
+
     // Stats related variables and methods
     const std::string& name() const { return _name; }
     enum SchNonRdyType
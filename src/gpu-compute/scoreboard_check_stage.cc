@@ -278,6 +278,32 @@ ScoreboardCheckStage::exec()
     }
 }
 
+void
+ScoreboardCheckStage::recordIdleCycles(Cycles n)
+{
+    for (int simdId = 0; simdId < computeUnit.numVectorALUs; ++simdId) {
+        for (int wfSlot = 0; wfSlot < computeUnit.shader->n_wf; ++wfSlot) {
+            Wavefront *curWave = computeUnit.wfList[simdId][wfSlot];
+            switch (curWave->getStatus()) {
+              case Wavefront::S_WAITCNT:
+                stats.stallCycles[NRDY_WAIT_CNT] += n;
+                break;
+              case Wavefront::S_BARRIER:
+                stats.stallCycles[NRDY_BARRIER_WAIT] += n;
+                break;
+              case Wavefront::S_STOPPED:
+              case Wavefront::S_RETURNING:
+                stats.stallCycles[NRDY_WF_STOP] += n;
+                break;
+              default:
+                panic("CU%d: WF[%d][%d] cannot be idle in status %d\n",
+                      computeUnit.cu_id, simdId, wfSlot,
+                      curWave->getStatus());
+            }
+        }
+    }
+}
+
 ScoreboardCheckStage::
 ScoreboardCheckStageStats::ScoreboardCheckStageStats(statistics::Group *parent)
     : statistics::Group(parent, "ScoreboardCheckStage"),
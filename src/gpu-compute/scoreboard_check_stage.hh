@@ -40,6 +40,7 @@
 
 #include "base/statistics.hh"
 #include "base/stats/group.hh"
+#include "base/types.hh"
 
 namespace gem5
 {
@@ -79,6 +80,12 @@ class ScoreboardCheckStage
                          ScoreboardCheckToSchedule &to_schedule);
     ~ScoreboardCheckStage();
     void exec();
+    /**
+     * Account for cycles the CU skipped while quiescent. Every wave is
+     * stopped or blocked on memory or a barrier, so each skipped cycle
+     * would have recorded the same not-ready reason for every wave.
+     */
+    void recordIdleCycles(Cycles n);
 
     // Stats related variables and methods
     const std::string& name() const { return _name; }
@@ -1314,6 +1314,20 @@ Wavefront::waitCntsSatisfied()
     return true;
 }
 
+bool
+Wavefront::waitCntsPending() const
+{
+    // the s_waitcnt has not executed yet, so the wave is waiting on
+    // the pipeline rather than on memory
+    if (vmWaitCnt == -1 && expWaitCnt == -1 && lgkmWaitCnt == -1) {
+        return false;
+    }
+
+    return (vmWaitCnt != -1 && vmemInstsIssued > vmWaitCnt) ||
+           (expWaitCnt != -1 && expInstsIssued > expWaitCnt) ||
+           (lgkmWaitCnt != -1 && lgkmInstsIssued > lgkmWaitCnt);
+}
+
 bool
 Wavefront::sleepDone()
 {
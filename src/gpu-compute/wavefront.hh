@@ -276,6 +276,12 @@ class Wavefront : public SimObject
     void discardFetch();
 
     bool waitCntsSatisfied();
+    /**
+     * True if an executed s_waitcnt is still waiting on outstanding
+     * memory operations, i.e., only a memory response can unblock this
+     * wave. Unlike waitCntsSatisfied() this does not modify any state.
+     */
+    bool waitCntsPending() const;
     void setWaitCnts(int vm_wait_cnt, int exp_wait_cnt, int lgkm_wait_cnt);
     void clearWaitCnts();
 
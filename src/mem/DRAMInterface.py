@@ -70,6 +70,13 @@ class DRAMInterface(MemInterface):
     # performance being lower when enabled
     enable_dram_powerdown = Param.Bool(False, "Enable powerdown states")
 
+    # Stop the refresh events of ranks while there is no traffic to the
+    # interface and account for the refreshes when traffic resumes or
+    # stats are dumped. Saves simulation time on mostly idle memories.
+    # Has no effect with powerdown enabled, as idle ranks then stop
+    # refreshing in self-refresh.
+    skip_idle_refresh = Param.Bool(False, "Skip refresh events of idle ranks")
+
     # For power modelling we need to know if the DRAM has a DLL or not
     dll = Param.Bool(True, "DRAM has DLL or not")
 
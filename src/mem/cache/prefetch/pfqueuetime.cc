@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Micro-benchmark comparing the sorted std::list the Queued prefetcher
+ * used to keep its prefetch queue in with the PrefetchQueue it uses now.
+ *
+ * Demand accesses are generated from a few interleaved sequential streams
+ * and random accesses. Each access squashes queued prefetches to its
+ * line, then queues the candidates one of the existing prefetchers would
+ * generate for it, filtering those already queued, and finally issues
+ * one prefetch. Both queues must issue the same prefetches in the same
+ * order.
+ *
+ *   bop    one candidate at the current best offset, as BOPPrefetcher
+ *   ampm   up to 16 candidates along the strides of the access map zone,
+ *          as AMPMPrefetcher
+ *   spp    a lookahead path of up to 8 candidates with decreasing
+ *          confidence, as SignaturePathPrefetcherV2 (with the confidence
+ *          used as the priority to exercise reordering)
+ *
+ * usage: pfqueuetime [accesses] [queue_size]
+ */
+
+#include <chrono>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "mem/cache/prefetch/prefetch_queue.hh"
+
+using namespace gem5;
+using namespace gem5::prefetch;
+
+namespace
+{
+
+const int LineBits = 6;
+
+struct Candidate
+{
+    Addr addr;
+    int32_t priority;
+};
+
+struct Access
+{
+    Addr addr;
+    std::vector<Candidate> candidates;
+};
+
+Addr
+line(Addr addr)
+{
+    return addr >> LineBits << LineBits;
+}
+
+std::vector<Access>
+makeStream(const std::string &kind, int num_accesses)
+{
+    std::mt19937_64 rng(1);
+    std::uniform_int_distribution<Addr> random_line(0, 1 << 20);
+    std::vector<Addr> streams(8);
+    for (Addr &s : streams)
+        s = random_line(rng) << LineBits;
+
+    std::vector<Access> accesses(num_accesses);
+    int offset = 1;
+    for (int i = 0; i < num_accesses; ++i) {
+        Access &a = accesses[i];
+        if (rng() % 4) {
+            Addr &s = streams[rng() % streams.size()];
+            s += 1 << LineBits;
+            a.addr = s;
+        } else {
+            a.addr = random_line(rng) << LineBits;
+        }
+
+        if (kind == "bop") {
+            if (i % 4096 == 0)
+                offset = 1 + rng() % 16;
+            a.candidates.push_back({a.addr + (offset << LineBits), 0});
+        } else if (kind == "ampm") {
+            // Strides within the 2kB zone of the access, both directions
+            const Addr zone = a.addr & ~Addr(2047);
+            for (int stride = 1; a.candidates.size() < 16 && stride < 32;
+                 ++stride) {
+                for (int dir : {1, -1}) {
+                    Addr pf = a.addr + dir * (stride << LineBits);
+                    if ((pf & ~Addr(2047)) == zone)
+                        a.candidates.push_back({pf, 0});
+                }
+            }
+        } else {
+            Addr pf = a.addr;
+            const int depth = 1 + rng() % 8;
+            for (int d = 0; d < depth; ++d) {
+                pf += (1 + rng() % 3) << LineBits;
+                a.candidates.push_back({pf, 100 - 12 * d});
+            }
+        }
+    }
+    return accesses;
+}
+
+struct Entry
+{
+    Addr addr;
+    int32_t priority;
+    uint64_t id;
+
+    Addr getAddr() const { return addr; }
+    bool isSecure() const { return false; }
+};
+
+struct Result
+{
+    uint64_t checksum = 0;
+    uint64_t hits = 0;
+    uint64_t dropped = 0;
+    uint64_t squashed = 0;
+    double seconds = 0;
+};
+
+void
+issue(Result &result, const Entry &e)
+{
+    result.checksum = result.checksum * 31 + (e.addr ^ e.id);
+}
+
+Result
+runList(const std::vector<Access> &accesses, size_t queue_size)
+{
+    std::list<Entry> queue;
+    uint64_t next_id = 0;
+
+    Result result;
+    const auto start = std::chrono::steady_clock::now();
+    for (const Access &a : accesses) {
+        for (auto it = queue.begin(); it != queue.end();) {
+            if (it->addr == line(a.addr)) {
+                it = queue.erase(it);
+                result.squashed++;
+            } else {
+                ++it;
+            }
+        }
+
+        for (const Candidate &c : a.candidates) {
+            auto it = queue.begin();
+            while (it != queue.end() && it->addr != c.addr)
+                ++it;
+            if (it != queue.end()) {
+                result.hits++;
+                if (it->priority < c.priority) {
+                    it->priority = c.priority;
+                    auto prev = it;
+                    while (prev != queue.begin()) {
+                        --prev;
+                        if (it->priority > prev->priority) {
+                            std::swap(*it, *prev);
+                            it = prev;
+                        }
+                    }
+                }
+                continue;
+            }
+
+            if (queue.size() == queue_size) {
+                result.dropped++;
+                auto victim = std::prev(queue.end());
+                while (victim != queue.begin() &&
+                       std::prev(victim)->priority == victim->priority) {
+                    --victim;
+                }
+                queue.erase(victim);
+            }
+
+            Entry e{c.addr, c.priority, next_id++};
+            auto pos = queue.end();
+            while (pos != queue.begin() &&
+                   std::prev(pos)->priority < e.priority) {
+                --pos;
+            }
+            queue.insert(pos, e);
+        }
+
+        if (!queue.empty()) {
+            issue(result, queue.front());
+            queue.pop_front();
+        }
+    }
+    result.seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+Result
+runQueue(const std::vector<Access> &accesses, size_t queue_size)
+{
+    PrefetchQueue<Entry> queue(queue_size);
+    uint64_t next_id = 0;
+
+    Result result;
+    const auto start = std::chrono::steady_clock::now();
+    for (const Access &a : accesses) {
+        result.squashed += queue.eraseAll(line(a.addr), false,
+                                          [](Entry &) {});
+
+        for (const Candidate &c : a.candidates) {
+            if (Entry *e = queue.find(c.addr, false)) {
+                result.hits++;
+                if (e->priority < c.priority)
+                    queue.setPriority(*e, c.priority);
+                continue;
+            }
+
+            if (queue.full()) {
+                result.dropped++;
+                queue.erase(queue.lowest());
+            }
+            queue.push(Entry{c.addr, c.priority, next_id++});
+        }
+
+        if (!queue.empty()) {
+            issue(result, queue.front());
+            queue.pop_front();
+        }
+    }
+    result.seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char *argv[])
+{
+    const int num_accesses = argc > 1 ? std::stoi(argv[1]) : 1000000;
+    const int queue_size = argc > 2 ? std::stoi(argv[2]) : 256;
+
+    if (num_accesses <= 0 || queue_size <= 0) {
+        cprintf("usage: %s [accesses] [queue_size]\n", argv[0]);
+        return 1;
+    }
+
+    cprintf("%d accesses, %d entry queue\n", num_accesses, queue_size);
+    for (const std::string kind : {"bop", "ampm", "spp"}) {
+        std::vector<Access> accesses = makeStream(kind, num_accesses);
+        Result list = runList(accesses, queue_size);
+        Result queue = runQueue(accesses, queue_size);
+        if (list.checksum != queue.checksum || list.hits != queue.hits ||
+            list.dropped != queue.dropped ||
+            list.squashed != queue.squashed) {
+            cprintf("%s: mismatch: the queues issued prefetches "
+                    "differently\n", kind);
+            return 1;
+        }
+
+        cprintf("%-5s list %.0f accesses/s, queue %.0f accesses/s "
+                "(%.2fx), %d hits, %d dropped, %d squashed\n", kind,
+                num_accesses / list.seconds, num_accesses / queue.seconds,
+                list.seconds / queue.seconds, list.hits, list.dropped,
+                list.squashed);
+    }
+    return 0;
+}
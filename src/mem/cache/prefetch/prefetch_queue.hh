@@ -0,0 +1,556 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_CACHE_PREFETCH_PREFETCH_QUEUE_HH__
+#define __MEM_CACHE_PREFETCH_PREFETCH_QUEUE_HH__
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+#include "base/intmath.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace prefetch
+{
+
+/**
+ * A fixed capacity queue of prefetch requests ordered by priority.
+ *
+ * Entries are kept highest priority first, and in insertion order within
+ * a priority. All entries live in a pool allocated up front, so an entry
+ * never moves while it is queued and queueing one does not allocate.
+ *
+ * Queues with more than LinearMaxCapacity entries are indexed. Each
+ * priority in use has a level recording the first and last entries with
+ * that priority, and the levels are kept sorted, so an entry is queued
+ * behind the last one of its priority after a binary search over the
+ * levels rather than a scan of the queue. An open addressed table maps
+ * the address and security state of the entries to the entries
+ * themselves, so duplicates are found without a scan either. Smaller
+ * queues are cheaper to scan than to index, so they skip both and scan
+ * the entries instead.
+ *
+ * T must have a public int32_t priority member, which the queue reads
+ * and updates, and getAddr() and isSecure() methods, which must not
+ * change while the entry is queued.
+ */
+template <typename T>
+class PrefetchQueue
+{
+  private:
+    using Index = uint32_t;
+    static constexpr Index Invalid = ~Index(0);
+
+    struct Node
+    {
+        std::optional<T> value;
+        /** Neighbours in queue order, or the next free node. */
+        Index prev = Invalid;
+        Index next = Invalid;
+        /** Next entry with the same address and security state. */
+        Index sameNext = Invalid;
+    };
+
+    /** The first and last entries with one priority. */
+    struct Level
+    {
+        int32_t priority;
+        Index head;
+        Index tail;
+    };
+
+  public:
+    /** Largest capacity for which the queue is scanned, not indexed. */
+    static constexpr size_t LinearMaxCapacity = 8;
+
+    class const_iterator;
+
+    class iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+        iterator() = default;
+
+        T &operator*() const { return *queue->nodes[idx].value; }
+        T *operator->() const { return &*queue->nodes[idx].value; }
+
+        iterator &
+        operator++()
+        {
+            idx = queue->nodes[idx].next;
+            return *this;
+        }
+
+        iterator
+        operator++(int)
+        {
+            iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const iterator &o) const { return idx == o.idx; }
+        bool operator!=(const iterator &o) const { return idx != o.idx; }
+
+      private:
+        friend class PrefetchQueue;
+        friend class const_iterator;
+        iterator(PrefetchQueue *q, Index i) : queue(q), idx(i) {}
+
+        PrefetchQueue *queue = nullptr;
+        Index idx = Invalid;
+    };
+
+    class const_iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        const_iterator() = default;
+        const_iterator(const iterator &it) : queue(it.queue), idx(it.idx) {}
+
+        const T &operator*() const { return *queue->nodes[idx].value; }
+        const T *operator->() const { return &*queue->nodes[idx].value; }
+
+        const_iterator &
+        operator++()
+        {
+            idx = queue->nodes[idx].next;
+            return *this;
+        }
+
+        const_iterator
+        operator++(int)
+        {
+            const_iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool
+        operator==(const const_iterator &o) const
+        {
+            return idx == o.idx;
+        }
+
+        bool
+        operator!=(const const_iterator &o) const
+        {
+            return idx != o.idx;
+        }
+
+      private:
+        friend class PrefetchQueue;
+        const_iterator(const PrefetchQueue *q, Index i) : queue(q), idx(i)
+        {}
+
+        const PrefetchQueue *queue = nullptr;
+        Index idx = Invalid;
+    };
+
+    explicit PrefetchQueue(size_t capacity)
+        : nodes(capacity), indexed(capacity > LinearMaxCapacity)
+    {
+        assert(capacity < Invalid);
+        if (indexed) {
+            // Keep probe runs short; removals walk the run they're in.
+            slots.assign(size_t(1) << ceilLog2(capacity * 8), Invalid);
+            mask = slots.size() - 1;
+            shift = 64 - floorLog2(slots.size());
+            levels.reserve(capacity);
+        }
+        for (Index i = 0; i < capacity; ++i)
+            nodes[i].next = i + 1 < capacity ? i + 1 : Invalid;
+        freeHead = capacity ? 0 : Invalid;
+    }
+
+    PrefetchQueue(const PrefetchQueue &) = delete;
+    PrefetchQueue &operator=(const PrefetchQueue &) = delete;
+
+    size_t size() const { return count; }
+    size_t capacity() const { return nodes.size(); }
+    bool empty() const { return count == 0; }
+    bool full() const { return count == nodes.size(); }
+
+    iterator begin() { return iterator(this, head); }
+    iterator end() { return iterator(this, Invalid); }
+    const_iterator begin() const { return const_iterator(this, head); }
+    const_iterator end() const { return const_iterator(this, Invalid); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    /** @return the oldest entry with the highest priority. */
+    T &front() { assert(!empty()); return *nodes[head].value; }
+    const T &front() const { assert(!empty()); return *nodes[head].value; }
+
+    /** @return the oldest entry with the lowest priority. */
+    T &
+    lowest()
+    {
+        assert(!empty());
+        return *nodes[lowestHead()].value;
+    }
+
+    /**
+     * Find the entry to evict, skipping entries that can't be. Entries
+     * are considered lowest priority first, and oldest first within a
+     * priority.
+     * @param evictable Returns whether an entry may be evicted.
+     * @return the first evictable entry, or nullptr if there is none.
+     */
+    template <typename F>
+    T *
+    lowest(F evictable)
+    {
+        // Walk the runs of equal priority from the back of the queue,
+        // each one from its oldest entry.
+        Index run_tail = tail;
+        while (run_tail != Invalid) {
+            Index run_head = runHead(run_tail);
+            for (Index i = run_head; ; i = nodes[i].next) {
+                if (evictable(*nodes[i].value))
+                    return &*nodes[i].value;
+                if (i == run_tail)
+                    break;
+            }
+            run_tail = nodes[run_head].prev;
+        }
+        return nullptr;
+    }
+
+    void pop_front() { assert(!empty()); remove(head); }
+
+    /**
+     * Queue a copy of t behind the entries with a priority at least as
+     * high. The queue must not be full.
+     * @return the queued copy.
+     */
+    T &
+    push(const T &t)
+    {
+        assert(!full());
+        Index i = freeHead;
+        Node &node = nodes[i];
+        freeHead = node.next;
+        node.value.emplace(t);
+        link(i, t.priority);
+        hashInsert(i);
+        count++;
+        return *node.value;
+    }
+
+    /**
+     * @return an entry with the given address and security state, or
+     * nullptr if there is none.
+     */
+    T *
+    find(Addr addr, bool is_secure)
+    {
+        if (!indexed) {
+            for (Index i = head; i != Invalid; i = nodes[i].next) {
+                T &t = *nodes[i].value;
+                if (t.getAddr() == addr && t.isSecure() == is_secure)
+                    return &t;
+            }
+            return nullptr;
+        }
+        Index i = slots[lookup(addr, is_secure)];
+        return i == Invalid ? nullptr : &*nodes[i].value;
+    }
+
+    /** Remove t, which must be an entry of this queue. */
+    void erase(T &t) { remove(indexOf(t)); }
+
+    /**
+     * Remove every entry with the given address and security state,
+     * calling f on each one before it is removed.
+     * @return the number of entries removed.
+     */
+    template <typename F>
+    size_t
+    eraseAll(Addr addr, bool is_secure, F f)
+    {
+        size_t removed = 0;
+        if (!indexed) {
+            for (Index i = head; i != Invalid;) {
+                Index next = nodes[i].next;
+                T &t = *nodes[i].value;
+                if (t.getAddr() == addr && t.isSecure() == is_secure) {
+                    f(t);
+                    remove(i);
+                    removed++;
+                }
+                i = next;
+            }
+            return removed;
+        }
+        while (T *t = find(addr, is_secure)) {
+            f(*t);
+            erase(*t);
+            removed++;
+        }
+        return removed;
+    }
+
+    /**
+     * Change the priority of t, which must be an entry of this queue. The
+     * entry is moved behind the other entries with the new priority.
+     */
+    void
+    setPriority(T &t, int32_t priority)
+    {
+        Index i = indexOf(t);
+        unlink(i);
+        t.priority = priority;
+        link(i, priority);
+    }
+
+  private:
+    /** @return the slot holding addr, or the empty slot it would use. */
+    size_t
+    lookup(Addr addr, bool is_secure) const
+    {
+        size_t s = home(addr, is_secure);
+        while (slots[s] != Invalid) {
+            const T &t = *nodes[slots[s]].value;
+            if (t.getAddr() == addr && t.isSecure() == is_secure)
+                break;
+            s = (s + 1) & mask;
+        }
+        return s;
+    }
+
+    size_t
+    home(Addr addr, bool is_secure) const
+    {
+        // Fibonacci hashing; the top bits mix in the whole address.
+        return ((addr ^ Addr(is_secure)) * 0x9e3779b97f4a7c15ULL) >> shift;
+    }
+
+    /** @return the node of t, which must be a queued entry. */
+    Index
+    indexOf(const T &t) const
+    {
+        // Values sit at the same offset in every node.
+        const uintptr_t offset = reinterpret_cast<uintptr_t>(&t) -
+            reinterpret_cast<uintptr_t>(&nodes[0]);
+        const Index i = offset / sizeof(Node);
+        assert(offset % sizeof(Node) ==
+               reinterpret_cast<uintptr_t>(&nodes[0].value) -
+               reinterpret_cast<uintptr_t>(&nodes[0]));
+        assert(i < nodes.size() && nodes[i].value);
+        return i;
+    }
+
+    /** @return the oldest entry with the same priority as node i. */
+    Index
+    runHead(Index i) const
+    {
+        const int32_t priority = nodes[i].value->priority;
+        if (indexed) {
+            auto level = std::lower_bound(levels.begin(), levels.end(),
+                priority,
+                [](const Level &l, int32_t p) { return l.priority < p; });
+            assert(level != levels.end() && level->priority == priority);
+            return level->head;
+        }
+        while (nodes[i].prev != Invalid &&
+               nodes[nodes[i].prev].value->priority == priority) {
+            i = nodes[i].prev;
+        }
+        return i;
+    }
+
+    Index
+    lowestHead() const
+    {
+        return indexed ? levels.front().head : runHead(tail);
+    }
+
+    void
+    hashInsert(Index i)
+    {
+        if (!indexed)
+            return;
+        const T &t = *nodes[i].value;
+        size_t s = lookup(t.getAddr(), t.isSecure());
+        nodes[i].sameNext = slots[s];
+        slots[s] = i;
+    }
+
+    void
+    hashRemove(Index i)
+    {
+        if (!indexed)
+            return;
+        const T &t = *nodes[i].value;
+        size_t s = lookup(t.getAddr(), t.isSecure());
+        if (slots[s] != i) {
+            Index prev = slots[s];
+            while (nodes[prev].sameNext != i)
+                prev = nodes[prev].sameNext;
+            nodes[prev].sameNext = nodes[i].sameNext;
+            return;
+        }
+        if (nodes[i].sameNext != Invalid) {
+            slots[s] = nodes[i].sameNext;
+            return;
+        }
+
+        // Empty the slot, moving later members of its probe run back
+        // unless their home lies cyclically in (s, j].
+        for (size_t j = (s + 1) & mask; slots[j] != Invalid;
+             j = (j + 1) & mask) {
+            const T &o = *nodes[slots[j]].value;
+            size_t k = home(o.getAddr(), o.isSecure());
+            if (((j - k) & mask) >= ((j - s) & mask)) {
+                slots[s] = slots[j];
+                s = j;
+            }
+        }
+        slots[s] = Invalid;
+    }
+
+    /** @return the first level with a priority of at least priority. */
+    typename std::vector<Level>::iterator
+    findLevel(int32_t priority)
+    {
+        return std::lower_bound(levels.begin(), levels.end(), priority,
+            [](const Level &l, int32_t p) { return l.priority < p; });
+    }
+
+    /** Put node i behind the other entries with the given priority. */
+    void
+    link(Index i, int32_t priority)
+    {
+        Index prev;
+        if (!indexed) {
+            prev = tail;
+            while (prev != Invalid &&
+                   nodes[prev].value->priority < priority) {
+                prev = nodes[prev].prev;
+            }
+            linkAfter(i, prev);
+            return;
+        }
+
+        auto level = findLevel(priority);
+        if (level != levels.end() && level->priority == priority) {
+            prev = level->tail;
+            level->tail = i;
+        } else {
+            // Levels past this one have higher priorities, and the
+            // nearest of them ends right before where this one starts.
+            prev = level == levels.end() ? Invalid : level->tail;
+            levels.insert(level, Level{priority, i, i});
+        }
+        linkAfter(i, prev);
+    }
+
+    /** Put node i after node prev, or at the head if prev is Invalid. */
+    void
+    linkAfter(Index i, Index prev)
+    {
+        Index next = prev == Invalid ? head : nodes[prev].next;
+        nodes[i].prev = prev;
+        nodes[i].next = next;
+        (prev == Invalid ? head : nodes[prev].next) = i;
+        (next == Invalid ? tail : nodes[next].prev) = i;
+    }
+
+    void
+    unlink(Index i)
+    {
+        Node &node = nodes[i];
+        if (indexed) {
+            auto level = findLevel(node.value->priority);
+            assert(level != levels.end() &&
+                   level->priority == node.value->priority);
+            if (level->head == i && level->tail == i) {
+                levels.erase(level);
+            } else if (level->head == i) {
+                level->head = node.next;
+            } else if (level->tail == i) {
+                level->tail = node.prev;
+            }
+        }
+
+        (node.prev == Invalid ? head : nodes[node.prev].next) = node.next;
+        (node.next == Invalid ? tail : nodes[node.next].prev) = node.prev;
+    }
+
+    void
+    remove(Index i)
+    {
+        unlink(i);
+        hashRemove(i);
+        Node &node = nodes[i];
+        node.value.reset();
+        node.prev = Invalid;
+        node.sameNext = Invalid;
+        node.next = freeHead;
+        freeHead = i;
+        count--;
+    }
+
+    std::vector<Node> nodes;
+    /** Whether the address table and the levels are used. */
+    const bool indexed;
+    /** Address table; each slot heads a chain linked through sameNext. */
+    std::vector<Index> slots;
+    /** Priorities in use, lowest first. */
+    std::vector<Level> levels;
+    Index head = Invalid;
+    Index tail = Invalid;
+    Index freeHead = Invalid;
+    size_t count = 0;
+    size_t mask = 0;
+    int shift = 0;
+};
+
+} // namespace prefetch
+} // namespace gem5
+
+#endif // __MEM_CACHE_PREFETCH_PREFETCH_QUEUE_HH__
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "mem/cache/prefetch/prefetch_queue.hh"
+
+using namespace gem5;
+using namespace gem5::prefetch;
+
+namespace
+{
+
+struct Entry
+{
+    Addr addr;
+    int32_t priority;
+    int id = 0;
+    bool busy = false;
+
+    Addr getAddr() const { return addr; }
+    bool isSecure() const { return addr & 1; }
+};
+
+/** @return the ids of the entries of q, front first. */
+std::vector<int>
+ids(const PrefetchQueue<Entry> &q)
+{
+    std::vector<int> v;
+    for (const Entry &e : q)
+        v.push_back(e.id);
+    return v;
+}
+
+} // anonymous namespace
+
+/** Run every test on a scanned queue and on an indexed one. */
+class PrefetchQueueTest : public testing::TestWithParam<size_t>
+{
+  protected:
+    PrefetchQueueTest() : q(GetParam()) {}
+
+    PrefetchQueue<Entry> q;
+};
+
+INSTANTIATE_TEST_SUITE_P(Capacities, PrefetchQueueTest,
+    testing::Values(PrefetchQueue<Entry>::LinearMaxCapacity,
+                    PrefetchQueue<Entry>::LinearMaxCapacity + 1, 64));
+
+TEST_P(PrefetchQueueTest, Empty)
+{
+    EXPECT_TRUE(q.empty());
+    EXPECT_FALSE(q.full());
+    EXPECT_EQ(q.size(), 0);
+    EXPECT_EQ(q.begin(), q.end());
+    EXPECT_EQ(q.find(0x40, false), nullptr);
+    EXPECT_EQ(q.lowest([](const Entry &) { return true; }), nullptr);
+    EXPECT_EQ(q.eraseAll(0x40, false, [](Entry &) {}), 0);
+}
+
+TEST_P(PrefetchQueueTest, PushOrder)
+{
+    // Higher priorities first, in insertion order within a priority
+    q.push({0x000, 1, 0});
+    q.push({0x040, 5, 1});
+    q.push({0x080, 1, 2});
+    q.push({0x0c0, 3, 3});
+    q.push({0x100, 5, 4});
+    q.push({0x140, -2, 5});
+    EXPECT_EQ(ids(q), std::vector<int>({1, 4, 3, 0, 2, 5}));
+    EXPECT_EQ(q.front().id, 1);
+
+    q.pop_front();
+    EXPECT_EQ(q.front().id, 4);
+    EXPECT_EQ(q.size(), 5);
+}
+
+TEST_P(PrefetchQueueTest, SetPriority)
+{
+    q.push({0x000, 1, 0});
+    q.push({0x040, 3, 1});
+    q.push({0x080, 3, 2});
+    q.push({0x0c0, 1, 3});
+
+    // Moved behind the other entries with its new priority
+    q.setPriority(*q.find(0x0c0, false), 3);
+    EXPECT_EQ(ids(q), std::vector<int>({1, 2, 3, 0}));
+    q.setPriority(*q.find(0x040, false), 0);
+    EXPECT_EQ(ids(q), std::vector<int>({2, 3, 0, 1}));
+}
+
+TEST_P(PrefetchQueueTest, Full)
+{
+    for (size_t i = 0; i < q.capacity(); ++i) {
+        EXPECT_FALSE(q.full());
+        q.push({Addr(i) << 6, int32_t(i % 3), int(i)});
+    }
+    EXPECT_TRUE(q.full());
+    EXPECT_EQ(q.size(), q.capacity());
+
+    q.erase(q.lowest());
+    EXPECT_FALSE(q.full());
+    q.push({0x100000, 7, -1});
+    EXPECT_TRUE(q.full());
+    EXPECT_EQ(q.front().id, -1);
+
+    while (!q.empty())
+        q.pop_front();
+    EXPECT_EQ(q.begin(), q.end());
+    q.push({0x40, 0, 1});
+    EXPECT_EQ(ids(q), std::vector<int>({1}));
+}
+
+TEST_P(PrefetchQueueTest, Lowest)
+{
+    q.push({0x000, 2, 0});
+    q.push({0x040, 1, 1});
+    q.push({0x080, 1, 2});
+    q.push({0x0c0, 4, 3});
+
+    // The oldest entry with the lowest priority
+    EXPECT_EQ(q.lowest().id, 1);
+    q.erase(q.lowest());
+    EXPECT_EQ(q.lowest().id, 2);
+    q.erase(q.lowest());
+    EXPECT_EQ(q.lowest().id, 0);
+    EXPECT_EQ(ids(q), std::vector<int>({3, 0}));
+}
+
+TEST_P(PrefetchQueueTest, LowestSkipsBusy)
+{
+    q.push({0x000, 2, 0});
+    q.push({0x040, 1, 1, true});
+    q.push({0x080, 1, 2});
+    q.push({0x0c0, 4, 3, true});
+
+    auto idle = [](const Entry &e) { return !e.busy; };
+    EXPECT_EQ(q.lowest(idle)->id, 2);
+    q.erase(*q.lowest(idle));
+    // Falls back to higher priorities, but never to a busy entry
+    EXPECT_EQ(q.lowest(idle)->id, 0);
+    q.erase(*q.lowest(idle));
+    EXPECT_EQ(q.lowest(idle), nullptr);
+    EXPECT_EQ(ids(q), std::vector<int>({3, 1}));
+}
+
+TEST_P(PrefetchQueueTest, EraseAll)
+{
+    q.push({0x040, 1, 0});
+    q.push({0x080, 1, 1});
+    q.push({0x040, 3, 2});
+    q.push({0x041, 1, 3});
+    q.push({0x040, 0, 4});
+
+    std::vector<int> seen;
+    EXPECT_EQ(q.eraseAll(0x040, false,
+                         [&](Entry &e) { seen.push_back(e.id); }), 3);
+    std::sort(seen.begin(), seen.end());
+    EXPECT_EQ(seen, std::vector<int>({0, 2, 4}));
+    EXPECT_EQ(ids(q), std::vector<int>({1, 3}));
+    EXPECT_EQ(q.find(0x040, false), nullptr);
+
+    // Same address, other security state
+    ASSERT_NE(q.find(0x041, true), nullptr);
+    EXPECT_EQ(q.find(0x041, true)->id, 3);
+    EXPECT_EQ(q.eraseAll(0x040, false, [](Entry &) {}), 0);
+}
+
+/** Random operations must match a sorted list. */
+TEST_P(PrefetchQueueTest, MatchesList)
+{
+    std::mt19937 rng(GetParam());
+    std::list<Entry> ref;
+    int next_id = 0;
+
+    for (int op = 0; op < 20000; ++op) {
+        const Addr addr = Addr(rng() % (2 * q.capacity())) << 6;
+        switch (rng() % 4) {
+          case 0:
+          case 1:
+            if (ref.size() == q.capacity()) {
+                auto victim = std::prev(ref.end());
+                while (victim != ref.begin() &&
+                       std::prev(victim)->priority == victim->priority) {
+                    --victim;
+                }
+                ASSERT_EQ(q.lowest().id, victim->id);
+                q.erase(q.lowest());
+                ref.erase(victim);
+            } else {
+                Entry e{addr, int32_t(rng() % 4), next_id++};
+                auto pos = ref.end();
+                while (pos != ref.begin() &&
+                       std::prev(pos)->priority < e.priority) {
+                    --pos;
+                }
+                ref.insert(pos, e);
+                q.push(e);
+            }
+            break;
+          case 2:
+            if (!ref.empty()) {
+                ASSERT_EQ(q.front().id, ref.front().id);
+                ref.pop_front();
+                q.pop_front();
+            }
+            break;
+          case 3:
+            ref.remove_if([&](const Entry &e) { return e.addr == addr; });
+            q.eraseAll(addr, false, [](Entry &) {});
+            break;
+        }
+
+        ASSERT_EQ(q.size(), ref.size());
+        std::vector<int> ref_ids;
+        for (const Entry &e : ref)
+            ref_ids.push_back(e.id);
+        ASSERT_EQ(ids(q), ref_ids);
+    }
+}
@@ -39,13 +39,13 @@
 #define __MEM_CACHE_PREFETCH_QUEUED_HH__
 
 #include <cstdint>
-#include <list>
 #include <utility>
 
 #include "arch/generic/mmu.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/cache/prefetch/base.hh"
+#include "mem/cache/prefetch/prefetch_queue.hh"
 #include "mem/packet.hh"
 
 namespace gem5
@@ -105,6 +105,10 @@ class Queued : public Base
             return !(*this > that);
         }
 
+        /** Address and security state the prefetch queues are keyed by */
+        Addr getAddr() const { return pfInfo.getAddr(); }
+        bool isSecure() const { return pfInfo.isSecure(); }
+
         /**
          * Create the associated memory packet
          * @param paddr physical address of this packet
@@ -141,11 +145,13 @@ class Queued : public Base
         void startTranslation(BaseMMU *mmu);
     };
 
-    std::list<DeferredPacket> pfq;
-    std::list<DeferredPacket> pfqMissingTranslation;
+    using DeferredQueue = PrefetchQueue<DeferredPacket>;
+
+    DeferredQueue pfq;
+    DeferredQueue pfqMissingTranslation;
 
-    using const_iterator = std::list<DeferredPacket>::const_iterator;
-    using iterator = std::list<DeferredPacket>::iterator;
+    using const_iterator = DeferredQueue::const_iterator;
+    using iterator = DeferredQueue::iterator;
 
     // PARAMETERS
 
@@ -210,16 +216,17 @@ class Queued : public Base
         return pfq.empty() ? MaxTick : pfq.front().tick;
     }
 
-    void printQueue(const std::list<DeferredPacket> &queue) const;
+    void printQueue(const DeferredQueue &queue) const;
 
   private:
 
     /**
-     * Adds a DeferredPacket to the specified queue
+     * Adds a DeferredPacket to the specified queue, making room for it by
+     * dropping the oldest of the lowest priority packets if it is full
      * @param queue selected queue to use
      * @param dpp DeferredPacket to add
      */
-    void addToQueue(std::list<DeferredPacket> &queue, DeferredPacket &dpp);
+    void addToQueue(DeferredQueue &queue, DeferredPacket &dpp);
 
     /**
      * Starts the translations of the queued prefetches with a
@@ -249,8 +256,8 @@ class Queued : public Base
      * @param priority priority of the prefetch request to be added
      * @return True if the prefetch request was found in the queue
      */
-    bool alreadyInQueue(std::list<DeferredPacket> &queue,
-                        const PrefetchInfo &pfi, int32_t priority);
+    bool alreadyInQueue(DeferredQueue &queue, const PrefetchInfo &pfi,
+                        int32_t priority);
 
     /**
      * Returns the maxmimum number of prefetch requests that are allowed
@@ -40,11 +40,6 @@
 namespace gem5
 {
 
-/**
- * Replacement candidates as chosen by the indexing policy.
- */
-typedef std::vector<ReplaceableEntry*> ReplacementCandidates;
-
 namespace replacement_policy
 {
 
@@ -29,11 +29,14 @@
 #ifndef __MEM_CACHE_REPLACEMENT_POLICIES_REPLACEABLE_ENTRY_HH__
 #define __MEM_CACHE_REPLACEMENT_POLICIES_REPLACEABLE_ENTRY_HH__
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "base/compiler.hh"
 #include "base/cprintf.hh"
+#include "base/logging.hh"
 
 namespace gem5
 {
@@ -121,6 +124,53 @@ class ReplaceableEntry
     }
 };
 
+/**
+ * Replacement candidates as chosen by the indexing policy.
+ *
+ * This is a view of an array of entries owned by someone else, usually
+ * the ways of a set kept by the indexing policy, so it is cheap to create
+ * and copy, but must not outlive the array it refers to.
+ */
+class ReplacementCandidates
+{
+  public:
+    using value_type = ReplaceableEntry*;
+    using const_iterator = ReplaceableEntry* const*;
+    using iterator = const_iterator;
+
+    ReplacementCandidates() = default;
+
+    ReplacementCandidates(ReplaceableEntry* const* entries, size_t size)
+      : _entries(entries), _size(size)
+    {}
+
+    ReplacementCandidates(const std::vector<ReplaceableEntry*> &entries)
+      : _entries(entries.data()), _size(entries.size())
+    {}
+
+    /** A temporary vector would be gone before the view is used. */
+    ReplacementCandidates(std::vector<ReplaceableEntry*> &&entries) = delete;
+
+    iterator begin() const { return _entries; }
+    iterator end() const { return _entries + _size; }
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    ReplaceableEntry* operator[](size_t i) const { return _entries[i]; }
+
+    ReplaceableEntry*
+    at(size_t i) const
+    {
+        panic_if(i >= _size, "Replacement candidate %d out of range", i);
+        return _entries[i];
+    }
+
+  private:
+    ReplaceableEntry* const* _entries = nullptr;
+    size_t _size = 0;
+};
+
 } // namespace gem5
 
 #endif // __MEM_CACHE_REPLACEMENT_POLICIES_REPLACEABLE_ENTRY_HH_
@@ -39,3 +39,41 @@ TEST(ReplaceableEntryTest, SetPosition)
     ASSERT_EQ(entry.getSet(), set);
     ASSERT_EQ(entry.getWay(), way);
 }
+
+TEST(ReplacementCandidatesTest, ViewOfVector)
+{
+    ReplaceableEntry entries[3];
+    std::vector<ReplaceableEntry*> ways = {
+        &entries[0], &entries[1], &entries[2]};
+    const ReplacementCandidates candidates(ways);
+
+    ASSERT_EQ(candidates.size(), ways.size());
+    ASSERT_FALSE(candidates.empty());
+    size_t i = 0;
+    for (const auto candidate : candidates) {
+        ASSERT_EQ(candidate, &entries[i]);
+        ASSERT_EQ(candidates[i], &entries[i]);
+        ASSERT_EQ(candidates.at(i), &entries[i]);
+        i++;
+    }
+    ASSERT_EQ(i, ways.size());
+
+    // The view follows updates of the underlying storage
+    ways[1] = &entries[2];
+    ASSERT_EQ(candidates[1], &entries[2]);
+}
+
+TEST(ReplacementCandidatesTest, Empty)
+{
+    const ReplacementCandidates candidates;
+    ASSERT_TRUE(candidates.empty());
+    ASSERT_EQ(candidates.begin(), candidates.end());
+}
+
+TEST(ReplacementCandidatesDeathTest, OutOfRange)
+{
+    ReplaceableEntry entry;
+    ReplaceableEntry *ways[] = {&entry};
+    const ReplacementCandidates candidates(ways, 1);
+    ASSERT_ANY_THROW(candidates.at(1));
+}
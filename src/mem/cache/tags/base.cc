@@ -51,6 +51,7 @@
 #include "mem/cache/replacement_policies/replaceable_entry.hh"
 #include "mem/cache/tags/indexing_policies/base.hh"
 #include "mem/cache/tags/partitioning_policies/partition_manager.hh"
+#include "mem/cache/tags/tagged_entry.hh"
 #include "mem/request.hh"
 #include "sim/core.hh"
 #include "sim/sim_exit.hh"
@@ -69,9 +70,37 @@ BaseTags::BaseTags(const Params &p)
       dataBlks(new uint8_t[p.size]), // Allocate data storage in one big chunk
       stats(*this)
 {
+    if (indexingPolicy) {
+        packedTags.init(indexingPolicy->getNumSets(),
+                        indexingPolicy->getAssoc());
+    }
+
     registerExitCallback([this]() { cleanupRefs(); });
 }
 
+void
+BaseTags::linkEntry(TaggedEntry *entry, uint64_t index)
+{
+    indexingPolicy->setEntry(entry, index);
+    entry->setPackedKey(packedTags.slot(entry->getSet(), entry->getWay()));
+}
+
+ReplacementCandidates
+BaseTags::getVictimCandidates(Addr addr, uint64_t partition_id)
+{
+    const ReplacementCandidates entries =
+        indexingPolicy->getPossibleEntries(addr);
+    if (!partitionManager) {
+        return entries;
+    }
+
+    // Filter entries based on PartitionID. The storage is reused, so this
+    // only allocates until it has grown to the associativity
+    partitionCandidates.assign(entries.begin(), entries.end());
+    partitionManager->filterByPartition(partitionCandidates, partition_id);
+    return partitionCandidates;
+}
+
 ReplaceableEntry*
 BaseTags::findBlockBySetAndWay(int set, int way) const
 {
@@ -84,8 +113,17 @@ BaseTags::findBlock(Addr addr, bool is_secure) const
     // Extract block tag
     Addr tag = extractTag(addr);
 
+    // If the address maps to a single set, compare its tag against the
+    // packed tags of the set instead of visiting the blocks
+    if (const auto set = indexingPolicy->findSet(addr)) {
+        const int way =
+            packedTags.findWay(*set, PackedTags::key(tag, is_secure));
+        return way < 0 ? nullptr :
+            static_cast<CacheBlk*>(indexingPolicy->getEntry(*set, way));
+    }
+
     // Find possible entries that may contain the given address
-    const std::vector<ReplaceableEntry*> entries =
+    const ReplacementCandidates entries =
         indexingPolicy->getPossibleEntries(addr);
 
     // Search for block
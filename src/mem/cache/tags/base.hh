@@ -56,6 +56,7 @@
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/cache/cache_blk.hh"
+#include "mem/cache/tags/packed_tags.hh"
 #include "mem/packet.hh"
 #include "params/BaseTags.hh"
 #include "sim/clocked_object.hh"
@@ -66,6 +67,7 @@ namespace gem5
 class System;
 class IndexingPolicy;
 class ReplaceableEntry;
+class TaggedEntry;
 
 /**
  * A common base class of Cache tagstore objects.
@@ -105,6 +107,35 @@ class BaseTags : public ClockedObject
     /** The data blocks, 1 per cache block. */
     std::unique_ptr<uint8_t[]> dataBlks;
 
+    /**
+     * Packed copy of the tags of the entries linked to the indexing
+     * policy, by set and way.
+     */
+    PackedTags packedTags;
+
+    /**
+     * Link an entry to the indexing policy, and keep its tag in the packed
+     * tags.
+     *
+     * @param entry The entry.
+     * @param index An unique index for the entry.
+     */
+    void linkEntry(TaggedEntry *entry, uint64_t index);
+
+    /**
+     * Get the possible entries of an address that belong to a partition,
+     * to choose a victim from.
+     *
+     * @param addr The address to find the possible entries of.
+     * @param partition_id The partition the entries must belong to.
+     * @return A view of the entries, valid until the next call.
+     */
+    ReplacementCandidates getVictimCandidates(Addr addr,
+                                              uint64_t partition_id);
+
+    /** Storage for the possible entries left after partitioning. */
+    std::vector<ReplaceableEntry*> partitionCandidates;
+
     /**
      * TODO: It would be good if these stats were acquired after warmup.
      */
@@ -75,7 +75,7 @@ BaseSetAssoc::tagsInit()
         CacheBlk* blk = &blks[blk_index];
 
         // Link block to indexing policy
-        indexingPolicy->setEntry(blk, blk_index);
+        linkEntry(blk, blk_index);
 
         // Associate a data chunk to the block
         blk->data = &dataBlks[blkSize*blk_index];
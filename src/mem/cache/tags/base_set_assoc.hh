@@ -172,14 +172,9 @@ class BaseSetAssoc : public BaseTags
                          std::vector<CacheBlk*>& evict_blks,
                          const uint64_t partition_id=0) override
     {
-        // Get possible entries to be victimized
-        std::vector<ReplaceableEntry*> entries =
-            indexingPolicy->getPossibleEntries(addr);
-
-        // Filter entries based on PartitionID
-        if (partitionManager) {
-            partitionManager->filterByPartition(entries, partition_id);
-        }
+        // Get possible entries to be victimized, filtered by PartitionID
+        const ReplacementCandidates entries =
+            getVictimCandidates(addr, partition_id);
 
         // Choose replacement victim from replacement candidates
         CacheBlk* victim = entries.empty() ? nullptr :
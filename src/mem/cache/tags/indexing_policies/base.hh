@@ -47,16 +47,16 @@
 #ifndef __MEM_CACHE_INDEXING_POLICIES_BASE_HH__
 #define __MEM_CACHE_INDEXING_POLICIES_BASE_HH__
 
+#include <optional>
 #include <vector>
 
+#include "mem/cache/replacement_policies/replaceable_entry.hh"
 #include "params/BaseIndexingPolicy.hh"
 #include "sim/sim_object.hh"
 
 namespace gem5
 {
 
-class ReplaceableEntry;
-
 /**
  * A common base class for indexing table locations. Classes that inherit
  * from it determine hash functions that should be applied based on the set
@@ -130,6 +130,26 @@ class BaseIndexingPolicy : public SimObject
      */
     ReplaceableEntry* getEntry(const uint32_t set, const uint32_t way) const;
 
+    /** @return the associativity. */
+    unsigned getAssoc() const { return assoc; }
+
+    /** @return the number of sets. */
+    uint32_t getNumSets() const { return numSets; }
+
+    /**
+     * Find the set of an address, for policies that place all the
+     * possible entries of an address in the ways of a single set.
+     *
+     * @param addr The address to find the set of.
+     * @return The set, or nothing if the possible entries of the address
+     *         are not all in one set.
+     */
+    virtual std::optional<uint32_t>
+    findSet(const Addr addr) const
+    {
+        return std::nullopt;
+    }
+
     /**
      * Generate the tag from the given address.
      *
@@ -144,9 +164,10 @@ class BaseIndexingPolicy : public SimObject
      * not to break cache resizing.
      *
      * @param addr The addr to a find possible entries for.
-     * @return The possible entries.
+     * @return A view of the possible entries, which may only be valid
+     *         until the next call.
      */
-    virtual std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr)
+    virtual ReplacementCandidates getPossibleEntries(const Addr addr)
                                                                     const = 0;
 
     /**
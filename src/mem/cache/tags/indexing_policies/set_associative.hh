@@ -47,6 +47,7 @@
 #ifndef __MEM_CACHE_INDEXING_POLICIES_SET_ASSOCIATIVE_HH__
 #define __MEM_CACHE_INDEXING_POLICIES_SET_ASSOCIATIVE_HH__
 
+#include <optional>
 #include <vector>
 
 #include "mem/cache/tags/indexing_policies/base.hh"
@@ -113,11 +114,17 @@ class SetAssociative : public BaseIndexingPolicy
      * Returns entries in all ways belonging to the set of the address.
      *
      * @param addr The addr to a find possible entries for.
-     * @return The possible entries.
+     * @return A view of the ways of the set of the address.
      */
-    std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr) const
+    ReplacementCandidates getPossibleEntries(const Addr addr) const
                                                                      override;
 
+    std::optional<uint32_t>
+    findSet(const Addr addr) const override
+    {
+        return extractSet(addr);
+    }
+
     /**
      * Regenerate an entry's address from its tag and assigned set and way.
      *
@@ -85,6 +85,13 @@ class SkewedAssociative : public BaseIndexingPolicy
      */
     const int msbShift;
 
+    /**
+     * The possible entries of the last address looked up. The entries of
+     * an address are spread over several sets, so they are gathered here
+     * to be returned without allocating.
+     */
+    mutable std::vector<ReplaceableEntry*> candidates;
+
     /**
      * The hash function itself. Uses the hash function H, as described in
      * "Skewed-Associative Caches", from Seznec et al. (section 3.3): It
@@ -158,9 +165,9 @@ class SkewedAssociative : public BaseIndexingPolicy
      * not to break cache resizing.
      *
      * @param addr The addr to a find possible entries for.
-     * @return The possible entries.
+     * @return A view of the possible entries, valid until the next call.
      */
-    std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr) const
+    ReplacementCandidates getPossibleEntries(const Addr addr) const
                                                                    override;
 
     /**
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_CACHE_TAGS_PACKED_TAGS_HH__
+#define __MEM_CACHE_TAGS_PACKED_TAGS_HH__
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * A structure of arrays copy of the tags of a set associative tag store.
+ *
+ * Each entry is represented by a single word, its key, which packs its tag
+ * and secure bit, or is InvalidKey if the entry is not valid. The keys of
+ * a set are contiguous, so a lookup compares the key of the address being
+ * looked up against every way without touching the entries themselves.
+ *
+ * Rows are padded to a multiple of ChunkWays ways, and a chunk of ways is
+ * compared without branches, which compilers turn into vector compares
+ * when the host supports them.
+ */
+class PackedTags
+{
+  public:
+    /** Key of an invalid entry. Never matches the key of a valid tag. */
+    static constexpr uint64_t InvalidKey = ~uint64_t(0);
+
+    /**
+     * @param tag The tag. Tags are shifted addresses, so the top bit is
+     *            never set.
+     * @param is_secure Whether the tag belongs to the secure space.
+     * @return the key of a valid entry with the given tag.
+     */
+    static uint64_t
+    key(Addr tag, bool is_secure)
+    {
+        return tag << 1 | uint64_t(is_secure);
+    }
+
+    PackedTags() = default;
+
+    /** Make room for num_sets sets of assoc ways, all of them invalid. */
+    void
+    init(uint32_t num_sets, unsigned assoc)
+    {
+        rowWays = roundUp(assoc, ChunkWays);
+        keys.assign(size_t(num_sets) * rowWays, InvalidKey);
+    }
+
+    /** @return where the key of the entry at set and way is kept. */
+    uint64_t *
+    slot(uint32_t set, uint32_t way)
+    {
+        assert(size_t(set) * rowWays + way < keys.size());
+        return &keys[size_t(set) * rowWays + way];
+    }
+
+    /**
+     * Find the first way of a set, starting at way from, whose key is key.
+     *
+     * @return the way, or -1 if no way from there on has that key.
+     */
+    int
+    findWay(uint32_t set, uint64_t key, unsigned from = 0) const
+    {
+        const uint64_t *row = &keys[size_t(set) * rowWays];
+        for (unsigned base = from - from % ChunkWays; base < rowWays;
+             base += ChunkWays) {
+            uint32_t mask = 0;
+            for (unsigned w = 0; w < ChunkWays; ++w)
+                mask |= uint32_t(row[base + w] == key) << w;
+            mask &= ~uint32_t(0) << (from > base ? from - base : 0);
+            if (mask)
+                return base + ctz32(mask);
+        }
+        return -1;
+    }
+
+  private:
+    /** Ways compared at once. */
+    static constexpr unsigned ChunkWays = 8;
+
+    std::vector<uint64_t> keys;
+
+    /** Ways per set, including padding. */
+    unsigned rowWays = 0;
+};
+
+} // namespace gem5
+
+#endif //__MEM_CACHE_TAGS_PACKED_TAGS_HH__
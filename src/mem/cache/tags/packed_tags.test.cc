@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "mem/cache/tags/packed_tags.hh"
+#include "mem/cache/tags/tagged_entry.hh"
+
+using namespace gem5;
+
+/** Every way of every set is found, and only in its own set. */
+TEST(PackedTagsTest, FindWay)
+{
+    // An associativity that is not a multiple of the chunk size
+    const unsigned num_sets = 4;
+    const unsigned assoc = 12;
+    PackedTags tags;
+    tags.init(num_sets, assoc);
+
+    for (unsigned set = 0; set < num_sets; set++) {
+        for (unsigned way = 0; way < assoc; way++) {
+            ASSERT_EQ(tags.findWay(set, PackedTags::key(way, false)), -1);
+            *tags.slot(set, way) = PackedTags::key(set * assoc + way, false);
+        }
+    }
+
+    for (unsigned set = 0; set < num_sets; set++) {
+        for (unsigned way = 0; way < assoc; way++) {
+            const uint64_t key = PackedTags::key(set * assoc + way, false);
+            for (unsigned other = 0; other < num_sets; other++) {
+                ASSERT_EQ(tags.findWay(other, key),
+                          other == set ? int(way) : -1);
+            }
+            ASSERT_EQ(tags.findWay(set,
+                PackedTags::key(set * assoc + way, true)), -1);
+        }
+    }
+}
+
+/** Lookups can resume after a way, so that every match can be visited. */
+TEST(PackedTagsTest, FindFrom)
+{
+    const unsigned assoc = 20;
+    PackedTags tags;
+    tags.init(1, assoc);
+
+    const uint64_t key = PackedTags::key(0x1234, true);
+    const std::vector<int> matches = {0, 7, 8, 15, 19};
+    for (int way : matches) {
+        *tags.slot(0, way) = key;
+    }
+
+    std::vector<int> found;
+    for (int way = tags.findWay(0, key); way >= 0;
+         way = tags.findWay(0, key, way + 1)) {
+        found.push_back(way);
+    }
+    ASSERT_EQ(found, matches);
+    ASSERT_EQ(tags.findWay(0, key, 9), 15);
+    ASSERT_EQ(tags.findWay(0, key, assoc), -1);
+}
+
+/** Entries keep their packed keys up to date. */
+TEST(PackedTagsTest, TaggedEntry)
+{
+    PackedTags tags;
+    tags.init(1, 2);
+    TaggedEntry entries[2];
+    entries[0].setPackedKey(tags.slot(0, 0));
+    entries[1].setPackedKey(tags.slot(0, 1));
+    ASSERT_EQ(*tags.slot(0, 0), PackedTags::InvalidKey);
+    ASSERT_EQ(*tags.slot(0, 1), PackedTags::InvalidKey);
+
+    entries[1].insert(0x40, true);
+    ASSERT_EQ(tags.findWay(0, PackedTags::key(0x40, true)), 1);
+    ASSERT_EQ(tags.findWay(0, PackedTags::key(0x40, false)), -1);
+
+    entries[0].insert(0x40, false);
+    ASSERT_EQ(tags.findWay(0, PackedTags::key(0x40, false)), 0);
+
+    entries[1].invalidate();
+    ASSERT_EQ(*tags.slot(0, 1), PackedTags::InvalidKey);
+    ASSERT_EQ(tags.findWay(0, PackedTags::key(0x40, true)), -1);
+    ASSERT_EQ(tags.findWay(0, PackedTags::key(0x40, false)), 0);
+}
@@ -132,7 +132,9 @@ SectorBlk::getNumValid() const
 void
 SectorBlk::validateSubBlk()
 {
+    // The sector becomes valid with its first valid block
     _validCounter++;
+    updatePackedKey();
 }
 
 void
@@ -126,7 +126,7 @@ SectorTags::tagsInit()
         }
 
         // Link block to indexing policy
-        indexingPolicy->setEntry(sec_blk, sec_blk_index);
+        linkEntry(sec_blk, sec_blk_index);
     }
 }
 
@@ -271,8 +271,23 @@ SectorTags::findBlock(Addr addr, bool is_secure) const
     // due to sectors being composed of contiguous-address entries
     const Addr offset = extractSectorOffset(addr);
 
+    // If the address maps to a single set, only visit the blocks of the
+    // sectors whose packed tags match
+    if (const auto set = indexingPolicy->findSet(addr)) {
+        const uint64_t key = PackedTags::key(tag, is_secure);
+        for (int way = packedTags.findWay(*set, key); way >= 0;
+             way = packedTags.findWay(*set, key, way + 1)) {
+            auto sector = indexingPolicy->getEntry(*set, way);
+            auto blk = static_cast<SectorBlk*>(sector)->blks[offset];
+            if (blk->matchTag(tag, is_secure)) {
+                return blk;
+            }
+        }
+        return nullptr;
+    }
+
     // Find all possible sector entries that may contain the given address
-    const std::vector<ReplaceableEntry*> entries =
+    const ReplacementCandidates entries =
         indexingPolicy->getPossibleEntries(addr);
 
     // Search for block
@@ -292,13 +307,9 @@ SectorTags::findVictim(Addr addr, const bool is_secure, const std::size_t size,
                        std::vector<CacheBlk*>& evict_blks,
                        const uint64_t partition_id)
 {
-    // Get possible entries to be victimized
-    std::vector<ReplaceableEntry*> sector_entries =
-        indexingPolicy->getPossibleEntries(addr);
-
-    // Filter entries based on PartitionID
-    if (partitionManager)
-        partitionManager->filterByPartition(sector_entries, partition_id);
+    // Get possible entries to be victimized, filtered by PartitionID
+    const ReplacementCandidates sector_entries =
+        getVictimCandidates(addr, partition_id);
 
     // Check if the sector this address belongs to has been allocated
     Addr tag = extractTag(addr);
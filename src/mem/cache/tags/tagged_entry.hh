@@ -36,6 +36,7 @@
 #include "base/logging.hh"
 #include "base/types.hh"
 #include "mem/cache/replacement_policies/replaceable_entry.hh"
+#include "mem/cache/tags/packed_tags.hh"
 
 namespace gem5
 {
@@ -48,7 +49,7 @@ namespace gem5
 class TaggedEntry : public CacheEntry
 {
   public:
-    TaggedEntry() : CacheEntry(), _secure(false) {}
+    TaggedEntry() : CacheEntry(), _secure(false), _packedKey(nullptr) {}
     ~TaggedEntry() = default;
 
     /**
@@ -85,6 +86,7 @@ class TaggedEntry : public CacheEntry
         if (is_secure) {
             setSecure();
         }
+        updatePackedKey();
     }
 
     /** Invalidate the block. Its contents are no longer valid. */
@@ -93,6 +95,20 @@ class TaggedEntry : public CacheEntry
     {
         CacheEntry::invalidate();
         clearSecure();
+        updatePackedKey();
+    }
+
+    /**
+     * Keep the key of this entry in a packed copy of the tags of its tag
+     * store. Only tag stores do this, and their entries cannot be copied.
+     *
+     * @param packed_key Where the key is kept.
+     */
+    void
+    setPackedKey(uint64_t *packed_key)
+    {
+        _packedKey = packed_key;
+        updatePackedKey();
     }
 
     std::string
@@ -119,6 +135,19 @@ class TaggedEntry : public CacheEntry
     /** Set secure bit. */
     virtual void setSecure() { _secure = true; }
 
+    /**
+     * Update the packed copy of the key of this entry, if any. Must be
+     * called whenever its validity, tag or secure bit change.
+     */
+    void
+    updatePackedKey() const
+    {
+        if (_packedKey) {
+            *_packedKey = isValid() ?
+                PackedTags::key(getTag(), isSecure()) : PackedTags::InvalidKey;
+        }
+    }
+
   private:
     /**
      * Secure bit. Marks whether this entry refers to an address in the secure
@@ -126,6 +155,9 @@ class TaggedEntry : public CacheEntry
      */
     bool _secure;
 
+    /** Packed copy of the key of this entry. */
+    uint64_t *_packedKey;
+
     /** Clear secure bit. Should be only used by the invalidation function. */
     void clearSecure() { _secure = false; }
 
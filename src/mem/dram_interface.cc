@@ -40,6 +40,8 @@
 
 #include "mem/dram_interface.hh"
 
+#include <algorithm>
+
 #include "base/bitfield.hh"
 #include "base/cprintf.hh"
 #include "base/trace.hh"
@@ -59,116 +61,108 @@ namespace memory
 std::pair<MemPacketQueue::iterator, Tick>
 DRAMInterface::chooseNextFRFCFS(MemPacketQueue& queue, Tick min_col_at) const
 {
-    std::vector<uint32_t> earliest_banks(ranksPerChannel, 0);
+    // In order of preference, FR-FCFS selects:
+    // 1) the oldest row hit that can issue seamlessly
+    // 2) the oldest packet to one of the earliest banks to prepare, as
+    //    determined by minBankPrep, if the PRE/ACT can be hidden
+    // 3) the oldest row hit that is prepped but cannot issue seamlessly
+    // 4) the oldest packet to one of the earliest banks to prepare
+    // Only the oldest row hit and the oldest row miss of each bank can
+    // be selected, so look at those rather than at every packet
+    const MemPacketQueue::Entry *seamless_hit = nullptr;
+    const MemPacketQueue::Entry *prepped_hit = nullptr;
+    bool got_row_miss = false;
+
+    auto older = [](const MemPacketQueue::Entry *entry,
+                    const MemPacketQueue::Entry *than) {
+        return entry && (!than || entry->seq < than->seq);
+    };
+
+    auto col_allowed_at = [this](const MemPacketQueue::Entry *entry) {
+        const MemPacket *pkt = *entry->pkt;
+        const Bank& bank = ranks[pkt->rank]->banks[pkt->bank];
+        return pkt->isRead() ? bank.rdAllowedAt : bank.wrAllowedAt;
+    };
+
+    for (const auto& bank_queue : queue.banks()) {
+        if (bank_queue.empty() || !bank_queue.dram ||
+            bank_queue.pseudoChannel != pseudoChannel) {
+            continue;
+        }
+
+        // check if rank is not doing a refresh and thus is available,
+        // if not, jump to the next bank
+        if (!ranks[bank_queue.rank]->inRefIdleState()) {
+            DPRINTF(DRAM, "%s bank %d - Rank %d not available\n", __func__,
+                    bank_queue.bank, bank_queue.rank);
+            continue;
+        }
 
-    // Has minBankPrep been called to populate earliest_banks?
-    bool filled_earliest_banks = false;
+        const Bank& bank = ranks[bank_queue.rank]->banks[bank_queue.bank];
+        const MemPacketQueue::Entry *hit = bank_queue.oldestTo(bank.openRow);
+        if (hit) {
+            // no additional rank-to-rank or same bank-group delays, or
+            // we switched read/write and might as well go for the row hit
+            if (col_allowed_at(hit) <= min_col_at) {
+                if (older(hit, seamless_hit))
+                    seamless_hit = hit;
+            } else if (older(hit, prepped_hit)) {
+                prepped_hit = hit;
+            }
+        }
+
+        got_row_miss |= bank_queue.size() > bank_queue.rowSize(bank.openRow);
+    }
+
+    if (seamless_hit) {
+        DPRINTF(DRAM, "%s Seamless buffer hit\n", __func__);
+        return std::make_pair(seamless_hit->pkt,
+                              col_allowed_at(seamless_hit));
+    }
+
+    const MemPacketQueue::Entry *earliest_pkt = nullptr;
     // can the PRE/ACT sequence be done without impacting utlization?
     bool hidden_bank_prep = false;
 
-    // search for seamless row hits first, if no seamless row hit is
-    // found then determine if there are other packets that can be issued
-    // without incurring additional bus delay due to bank timing
-    // Will select closed rows first to enable more open row possibilies
-    // in future selections
-    bool found_hidden_bank = false;
-
-    // remember if we found a row hit, not seamless, but bank prepped
-    // and ready
-    bool found_prepped_pkt = false;
-
-    // if we have no row hit, prepped or not, and no seamless packet,
-    // just go for the earliest possible
-    bool found_earliest_pkt = false;
-
-    Tick selected_col_at = MaxTick;
-    auto selected_pkt_it = queue.end();
-
-    for (auto i = queue.begin(); i != queue.end() ; ++i) {
-        MemPacket* pkt = *i;
-
-        // select optimal DRAM packet in Q
-        if (pkt->isDram() && (pkt->pseudoChannel == pseudoChannel)) {
-            const Bank& bank = ranks[pkt->rank]->banks[pkt->bank];
-            const Tick col_allowed_at = pkt->isRead() ? bank.rdAllowedAt :
-                                                        bank.wrAllowedAt;
-
-            DPRINTF(DRAM, "%s checking DRAM packet in bank %d, row %d\n",
-                    __func__, pkt->bank, pkt->row);
-
-            // check if rank is not doing a refresh and thus is available,
-            // if not, jump to the next packet
-            if (burstReady(pkt)) {
-
-                DPRINTF(DRAM,
-                        "%s bank %d - Rank %d available\n", __func__,
-                        pkt->bank, pkt->rank);
-
-                // check if it is a row hit
-                if (bank.openRow == pkt->row) {
-                    // no additional rank-to-rank or same bank-group
-                    // delays, or we switched read/write and might as well
-                    // go for the row hit
-                    if (col_allowed_at <= min_col_at) {
-                        // FCFS within the hits, giving priority to
-                        // commands that can issue seamlessly, without
-                        // additional delay, such as same rank accesses
-                        // and/or different bank-group accesses
-                        DPRINTF(DRAM, "%s Seamless buffer hit\n", __func__);
-                        selected_pkt_it = i;
-                        selected_col_at = col_allowed_at;
-                        // no need to look through the remaining queue entries
-                        break;
-                    } else if (!found_hidden_bank && !found_prepped_pkt) {
-                        // if we did not find a packet to a closed row that can
-                        // issue the bank commands without incurring delay, and
-                        // did not yet find a packet to a prepped row, remember
-                        // the current one
-                        selected_pkt_it = i;
-                        selected_col_at = col_allowed_at;
-                        found_prepped_pkt = true;
-                        DPRINTF(DRAM, "%s Prepped row buffer hit\n", __func__);
-                    }
-                } else if (!found_earliest_pkt) {
-                    // if we have not initialised the bank status, do it
-                    // now, and only once per scheduling decisions
-                    if (!filled_earliest_banks) {
-                        // determine entries with earliest bank delay
-                        std::tie(earliest_banks, hidden_bank_prep) =
-                            minBankPrep(queue, min_col_at);
-                        filled_earliest_banks = true;
-                    }
-
-                    // bank is amongst first available banks
-                    // minBankPrep will give priority to packets that can
-                    // issue seamlessly
-                    if (bits(earliest_banks[pkt->rank],
-                             pkt->bank, pkt->bank)) {
-                        found_earliest_pkt = true;
-                        found_hidden_bank = hidden_bank_prep;
-
-                        // give priority to packets that can issue
-                        // bank commands 'behind the scenes'
-                        // any additional delay if any will be due to
-                        // col-to-col command requirements
-                        if (hidden_bank_prep || !found_prepped_pkt) {
-                            selected_pkt_it = i;
-                            selected_col_at = col_allowed_at;
-                        }
-                    }
-                }
-            } else {
-                DPRINTF(DRAM, "%s bank %d - Rank %d not available\n", __func__,
-                        pkt->bank, pkt->rank);
+    if (got_row_miss) {
+        // determine entries with earliest bank delay, minBankPrep will
+        // give priority to banks that can issue seamlessly
+        std::vector<uint32_t> earliest_banks;
+        std::tie(earliest_banks, hidden_bank_prep) =
+            minBankPrep(queue, min_col_at);
+
+        for (const auto& bank_queue : queue.banks()) {
+            if (bank_queue.empty() || !bank_queue.dram ||
+                bank_queue.pseudoChannel != pseudoChannel ||
+                !bits(earliest_banks[bank_queue.rank],
+                      bank_queue.bank, bank_queue.bank)) {
+                continue;
             }
+
+            const Bank& bank = ranks[bank_queue.rank]->banks[bank_queue.bank];
+            const MemPacketQueue::Entry *miss =
+                bank_queue.oldestNotTo(bank.openRow);
+            if (older(miss, earliest_pkt))
+                earliest_pkt = miss;
         }
     }
 
-    if (selected_pkt_it == queue.end()) {
+    // give priority to packets that can issue bank commands 'behind the
+    // scenes', any additional delay if any will be due to col-to-col
+    // command requirements, and otherwise prefer prepped row hits
+    const MemPacketQueue::Entry *selected = prepped_hit;
+    if (earliest_pkt && (hidden_bank_prep || !prepped_hit)) {
+        selected = earliest_pkt;
+    } else if (prepped_hit) {
+        DPRINTF(DRAM, "%s Prepped row buffer hit\n", __func__);
+    }
+
+    if (!selected) {
         DPRINTF(DRAM, "%s no available DRAM ranks found\n", __func__);
+        return std::make_pair(queue.end(), MaxTick);
     }
 
-    return std::make_pair(selected_pkt_it, selected_col_at);
+    return std::make_pair(selected->pkt, col_allowed_at(selected));
 }
 
 void
@@ -508,32 +502,25 @@ DRAMInterface::doBurstAccess(MemPacket* mem_pkt, Tick next_burst_at,
         bool got_bank_conflict = false;
 
         for (uint8_t i = 0; i < ctrl->numPriorities(); ++i) {
-            auto p = queue[i].begin();
-            // keep on looking until we find a hit or reach the end of the
-            // queue
+            // look at the queued packets to the same rank and bank
             // 1) if a hit is found, then both open and close adaptive
             //    policies keep the page open
             // 2) if no hit is found, got_bank_conflict is set to true if a
             //    bank conflict request is waiting in the queue
             // 3) make sure we are not considering the packet that we are
             //    currently dealing with
-            while (!got_more_hits && p != queue[i].end()) {
-
-                if ((*p)->pseudoChannel != pseudoChannel) {
-                    // only consider if this pkt belongs to this interface
-                    ++p;
+            // Packets are only told apart by pseudo channel here, so
+            // look at the banks of both media types
+            for (bool is_dram : {true, false}) {
+                const auto *bank_queue = queue[i].findBank(is_dram,
+                    pseudoChannel, mem_pkt->rank, mem_pkt->bank);
+                if (!bank_queue)
                     continue;
-                }
-
-                if (mem_pkt != (*p)) {
-                    bool same_rank_bank = (mem_pkt->rank == (*p)->rank) &&
-                                          (mem_pkt->bank == (*p)->bank);
 
-                    bool same_row = mem_pkt->row == (*p)->row;
-                    got_more_hits |= same_rank_bank && same_row;
-                    got_bank_conflict |= same_rank_bank && !same_row;
-                }
-                ++p;
+                got_more_hits |= bank_queue->hasOthersTo(mem_pkt->row,
+                                                         mem_pkt);
+                got_bank_conflict |=
+                    bank_queue->size() > bank_queue->rowSize(mem_pkt->row);
             }
 
             if (got_more_hits)
@@ -657,6 +644,7 @@ DRAMInterface::DRAMInterface(const DRAMInterfaceParams &_p)
       maxAccessesPerRow(_p.max_accesses_per_row),
       timeStampOffset(0), activeRank(0),
       enableDRAMPowerdown(_p.enable_dram_powerdown),
+      skipIdleRefresh(_p.skip_idle_refresh),
       lastStatsResetTick(0),
       stats(*this)
 {
@@ -919,6 +907,10 @@ DRAMInterface::decodePacket(const PacketPtr pkt, Addr pkt_addr,
 
 void DRAMInterface::setupRank(const uint8_t rank, const bool is_read)
 {
+    // the interface is no longer idle, bring the refresh state of all
+    // ranks up to date
+    catchUpRefresh();
+
     // increment entry count of the rank based on packet type
     if (is_read) {
         ++ranks[rank]->readEntries;
@@ -1041,11 +1033,13 @@ DRAMInterface::minBankPrep(const MemPacketQueue& queue,
     // determine if we have queued transactions targetting the
     // bank in question
     std::vector<bool> got_waiting(ranksPerChannel * banksPerRank, false);
-    for (const auto& p : queue) {
-        if (p->pseudoChannel != pseudoChannel)
-            continue;
-        if (p->isDram() && ranks[p->rank]->inRefIdleState())
-            got_waiting[p->bankId] = true;
+    for (const auto& bank_queue : queue.banks()) {
+        if (!bank_queue.empty() && bank_queue.dram &&
+            bank_queue.pseudoChannel == pseudoChannel &&
+            ranks[bank_queue.rank]->inRefIdleState()) {
+            got_waiting[bank_queue.rank * banksPerRank + bank_queue.bank] =
+                true;
+        }
     }
 
     // Find command with optimal bank timing
@@ -1119,7 +1113,8 @@ DRAMInterface::Rank::Rank(const DRAMInterfaceParams &_p,
                          int _rank, DRAMInterface& _dram)
     : EventManager(&_dram), dram(_dram),
       pwrStateTrans(PWR_IDLE), pwrStatePostRefresh(PWR_IDLE),
-      pwrStateTick(0), refreshDueAt(0), pwrState(PWR_IDLE),
+      pwrStateTick(0), refreshDueAt(0), refreshSkipped(false),
+      refreshSkippedAt(0), refreshDoneAt(0), pwrState(PWR_IDLE),
       refreshState(REF_IDLE), inLowPowerState(false), rank(_rank),
       readEntries(0), writeEntries(0), outstandingEvents(0),
       wakeUpAllowedAt(0), power(_p, false), banks(_p.banks_per_rank),
@@ -1168,6 +1163,8 @@ DRAMInterface::Rank::startup(Tick ref_tick)
 void
 DRAMInterface::Rank::suspend()
 {
+    catchUpRefresh();
+
     deschedule(refreshEvent);
 
     // Update the stats
@@ -1286,6 +1283,33 @@ DRAMInterface::Rank::processWriteDoneEvent()
 void
 DRAMInterface::Rank::processRefreshEvent()
 {
+    // if nothing is going on, stop the refresh event loop and only
+    // account for the refreshes once traffic resumes
+    if (canSkipRefresh()) {
+        DPRINTF(DRAMState, "Rank %d idle, skipping refreshes from %llu\n",
+                rank, curTick());
+        refreshSkipped = true;
+        refreshSkippedAt = curTick();
+
+        // Keep the skipped ranks in the order their refresh events would
+        // run in without skipping. Events due at the same tick run latest
+        // scheduled first, and the ranks that stopped earlier and refresh
+        // in step with this one would have scheduled their refresh when
+        // their last one completed, tRFC after it started.
+        const Tick ref_period = dram.tREFI - dram.tRP;
+        auto &skipped = dram.skippedRanks;
+        auto pos = skipped.end();
+        if (refreshDoneAt + ref_period > curTick() + dram.tRFC) {
+            pos = std::find_if(skipped.begin(), skipped.end(),
+                [this, ref_period](const Rank *r) {
+                    return r->refreshSkippedAt < curTick() &&
+                        (curTick() - r->refreshSkippedAt) % ref_period == 0;
+                });
+        }
+        skipped.insert(pos, this);
+        return;
+    }
+
     // when first preparing the refresh, remember when it was due
     if ((refreshState == REF_IDLE) || (refreshState == REF_SREF_EXIT)) {
         // remember when the refresh is due
@@ -1482,12 +1506,162 @@ DRAMInterface::Rank::processRefreshEvent()
         // Compensate for the delay in actually performing the refresh
         // when scheduling the next one
         schedule(refreshEvent, refreshDueAt - dram.tRP);
+        refreshDoneAt = curTick();
 
         DPRINTF(DRAMState, "Refresh done at %llu and next refresh"
                 " at %llu\n", curTick(), refreshDueAt);
     }
 }
 
+bool
+DRAMInterface::Rank::canSkipRefresh() const
+{
+    // nothing queued or in flight to any rank of the interface, all
+    // banks closed, and no power state transition pending, so that the
+    // refresh event loop would keep cycling through refreshes without
+    // interacting with anything else until traffic resumes. With
+    // powerdown enabled an idle rank instead goes from the refresh into
+    // precharge powerdown and self-refresh, which stops the refresh
+    // events on its own.
+    return dram.skipIdleRefresh && !dram.enableDRAMPowerdown &&
+        refreshState == REF_IDLE &&
+        pwrState == PWR_IDLE && pwrStatePostRefresh == PWR_IDLE &&
+        !inLowPowerState && numBanksActive == 0 && outstandingEvents == 0 &&
+        readEntries == 0 && writeEntries == 0 &&
+        dram.readQueueSize == 0 && dram.writeQueueSize == 0 &&
+        !powerEvent.scheduled() && !wakeUpEvent.scheduled() &&
+        !activateEvent.scheduled() && !prechargeEvent.scheduled() &&
+        !dram.ctrl->requestEventScheduled(dram.pseudoChannel) &&
+        dram.ctrl->drainState() == DrainState::Running;
+}
+
+void
+DRAMInterface::catchUpRefresh()
+{
+    if (skippedRanks.empty())
+        return;
+
+    // Events due at the same tick run in the reverse order they were
+    // scheduled in, so the refresh events of ranks refreshing in step
+    // swap order when a refresh completes, and swap back when the next
+    // one starts. Restart the ranks that are still refreshing in the
+    // order they stopped, and the others in the reverse order, to keep
+    // the order the controller sees them become available in.
+    std::vector<Rank*> skipped;
+    skipped.swap(skippedRanks);
+
+    for (auto r : skipped) {
+        if (r->skippedRefreshRunning())
+            r->replaySkippedRefreshes();
+    }
+    for (auto r = skipped.rbegin(); r != skipped.rend(); ++r) {
+        if (!(*r)->skippedRefreshRunning())
+            (*r)->replaySkippedRefreshes();
+    }
+
+    // a rank that kept refreshing and whose event is due together with
+    // a restarted one, but would have been scheduled after it, goes
+    // back in front of it
+    for (auto r : ranks) {
+        if (!r->refreshEvent.scheduled() ||
+            std::find(skipped.begin(), skipped.end(), r) != skipped.end()) {
+            continue;
+        }
+        for (auto s : skipped) {
+            if (s->refreshEvent.when() == r->refreshEvent.when() &&
+                s->refreshScheduledAt() < r->refreshScheduledAt()) {
+                r->reschedule(r->refreshEvent, r->refreshEvent.when());
+                break;
+            }
+        }
+    }
+}
+
+void
+DRAMInterface::Rank::catchUpRefresh()
+{
+    if (refreshSkipped)
+        dram.catchUpRefresh();
+}
+
+bool
+DRAMInterface::Rank::skippedRefreshRunning() const
+{
+    // the skipped refreshes start every tREFI - tRP and take tRFC each,
+    // see replaySkippedRefreshes
+    return refreshSkipped &&
+        (curTick() - refreshSkippedAt) % (dram.tREFI - dram.tRP) <
+        dram.tRFC;
+}
+
+Tick
+DRAMInterface::Rank::refreshScheduledAt() const
+{
+    // a refresh schedules its completion when it starts, and the next
+    // refresh when it completes
+    return refreshState == REF_RUN ? refreshEvent.when() - dram.tRFC :
+        refreshDoneAt;
+}
+
+void
+DRAMInterface::Rank::replaySkippedRefreshes()
+{
+    if (!refreshSkipped)
+        return;
+
+    refreshSkipped = false;
+
+    // everything issued before the rank went idle is in the past, so
+    // the skipped refreshes can go straight to DRAMPower after it
+    flushCmdList();
+
+    // An idle refresh completes at refreshDueAt - tRP + tRFC and the
+    // next one is scheduled to start tREFI - tRP after it started
+    Tick ref_at = refreshSkippedAt;
+    while (true) {
+        stats.pwrStateTime[PWR_IDLE] += ref_at - pwrStateTick;
+        pwrStateTick = ref_at;
+
+        power.powerlib.doCommand(MemCommand::REF, 0,
+                                 divCeil(ref_at, dram.tCK) -
+                                 dram.timeStampOffset);
+        DPRINTF(DRAMPower, "%llu,REF,0,%d\n", divCeil(ref_at, dram.tCK) -
+                dram.timeStampOffset, rank);
+
+        const Tick ref_done_at = ref_at + dram.tRFC;
+        for (auto &b : banks) {
+            b.actAllowedAt = ref_done_at;
+        }
+
+        if (ref_done_at > curTick()) {
+            // the refresh is still running, pick up the event loop where
+            // processRefreshEvent would be at this point
+            DPRINTF(DRAMState, "Rank %d resuming refresh in progress\n",
+                    rank);
+            pwrState = PWR_REF;
+            refreshState = REF_RUN;
+            refreshDueAt = ref_at + dram.tREFI;
+            ++outstandingEvents;
+            schedule(refreshEvent, ref_done_at);
+            break;
+        }
+
+        stats.pwrStateTime[PWR_REF] += dram.tRFC;
+        pwrStateTick = ref_done_at;
+        refreshDoneAt = ref_done_at;
+
+        ref_at += dram.tREFI - dram.tRP;
+        if (ref_at > curTick()) {
+            DPRINTF(DRAMState, "Rank %d resuming refresh, next at %llu\n",
+                    rank, ref_at);
+            schedule(refreshEvent, ref_at);
+            break;
+        }
+    }
+
+    updatePowerStats();
+}
+
 void
 DRAMInterface::Rank::schedulePowerEvent(PowerState pwr_state, Tick tick)
 {
@@ -1811,6 +1985,8 @@ DRAMInterface::Rank::computeStats()
 {
     DPRINTF(DRAM,"Computing stats due to a dump callback\n");
 
+    catchUpRefresh();
+
     // Update the stats
     updatePowerStats();
 
@@ -2016,6 +2192,9 @@ DRAMInterface::RankStats::regStats()
 void
 DRAMInterface::RankStats::resetStats()
 {
+    // account for skipped refreshes before the stats are cleared
+    rank.catchUpRefresh();
+
     statistics::Group::resetStats();
 
     rank.resetStats();
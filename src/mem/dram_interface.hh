@@ -256,11 +256,35 @@ class DRAMInterface : public MemInterface
          */
         Tick refreshDueAt;
 
+        /**
+         * Set while the refresh event loop is stopped because the rank
+         * and its interface are idle. The refreshes that fall due in the
+         * meantime are accounted for by catchUpRefresh.
+         */
+        bool refreshSkipped;
+
+        /**
+         * When the first of the skipped refreshes was due
+         */
+        Tick refreshSkippedAt;
+
+        /**
+         * When the last refresh completed, and so when the event for the
+         * next one was scheduled
+         */
+        Tick refreshDoneAt;
+
         /**
          * Function to update Power Stats
          */
         void updatePowerStats();
 
+        /**
+         * Check if the rank, and the interface it belongs to, are idle
+         * enough for the refreshes to be skipped until traffic resumes.
+         */
+        bool canSkipRefresh() const;
+
         /**
          * Schedule a power state transition in the future, and
          * potentially override an already scheduled transition.
@@ -427,6 +451,33 @@ class DRAMInterface : public MemInterface
          */
         void flushCmdList();
 
+        /**
+         * Account for the refreshes that were skipped while the rank was
+         * idle, leaving the rank in the state the refresh event loop
+         * would have put it in by now, and restart the refresh events.
+         * The other ranks of the interface catch up as well, see
+         * DRAMInterface::catchUpRefresh. Does nothing unless refreshes
+         * are being skipped.
+         */
+        void catchUpRefresh();
+
+        /**
+         * Catch up on the skipped refreshes of this rank only
+         */
+        void replaySkippedRefreshes();
+
+        /**
+         * Check if, had the skipped refreshes been issued, one of them
+         * would still be in progress now.
+         */
+        bool skippedRefreshRunning() const;
+
+        /**
+         * When the pending refresh event was scheduled, or would have
+         * been had the skipped refreshes been issued
+         */
+        Tick refreshScheduledAt() const;
+
         /**
          * Computes stats just prior to dump event
          */
@@ -544,6 +595,9 @@ class DRAMInterface : public MemInterface
     /** Enable or disable DRAM powerdown states. */
     bool enableDRAMPowerdown;
 
+    /** Skip the refresh events of ranks while the interface is idle. */
+    const bool skipIdleRefresh;
+
     /** The time when stats were last reset used to calculate average power */
     Tick lastStatsResetTick;
 
@@ -631,6 +685,19 @@ class DRAMInterface : public MemInterface
       */
     std::vector<Rank*> ranks;
 
+    /**
+     * Ranks whose refresh events are stopped, in the order their refresh
+     * events would run in
+     */
+    std::vector<Rank*> skippedRanks;
+
+    /**
+     * Catch up on the skipped refreshes of all ranks, restarting their
+     * refresh events so that they run in the same order, relative to
+     * each other and to the other ranks, as without skipping.
+     */
+    void catchUpRefresh();
+
     /*
      * @return delay between write and read commands
      */
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2010-2020 ARM Limited
+ * All rights reserved
+ *
+ * The license below extends only to copyright in the software and shall
+ * not be construed as granting a license to any other intellectual
+ * property including but not limited to intellectual property relating
+ * to a hardware implementation of the functionality of the software
+ * licensed hereunder.  You may use the software subject to the license
+ * terms below provided that you ensure that this notice is replicated
+ * unmodified and in its entirety in all distributions of the software,
+ * modified or unmodified, in source code or in binary form.
+ *
+ * Copyright (c) 2013 Amin Farmahini-Farahani
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/mem_packet_queue.hh"
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+size_t
+MemPacketQueue::BankQueue::rowSize(uint32_t row) const
+{
+    auto it = rows.find(row);
+    return it == rows.end() ? 0 : it->second.size();
+}
+
+const MemPacketQueue::Entry *
+MemPacketQueue::BankQueue::oldestTo(uint32_t row) const
+{
+    auto it = rows.find(row);
+    return it == rows.end() ? nullptr : &it->second.front();
+}
+
+const MemPacketQueue::Entry *
+MemPacketQueue::BankQueue::oldestNotTo(uint32_t row) const
+{
+    for (const auto &entry : packets) {
+        if ((*entry.pkt)->row != row)
+            return &entry;
+    }
+    return nullptr;
+}
+
+bool
+MemPacketQueue::BankQueue::hasOthersTo(uint32_t row,
+                                       const MemPacket *pkt) const
+{
+    auto it = rows.find(row);
+    if (it == rows.end())
+        return false;
+    return it->second.size() > 1 || *it->second.front().pkt != pkt;
+}
+
+void
+MemPacketQueue::push_back(MemPacket *pkt)
+{
+    assert(packets.empty() || packets.front()->isRead() == pkt->isRead());
+
+    const uint32_t key = bankKey(pkt->isDram(), pkt->pseudoChannel,
+                                 pkt->rank, pkt->bank);
+    auto [index_it, inserted] = bankIndex.emplace(key, bankQueues.size());
+    if (inserted) {
+        bankQueues.emplace_back(pkt->isDram(), pkt->pseudoChannel,
+                                pkt->rank, pkt->bank);
+    }
+    BankQueue &bank_queue = bankQueues[index_it->second];
+
+    const Entry entry{nextSeq++, packets.insert(packets.end(), pkt)};
+    bank_queue.packets.push_back(entry);
+    bank_queue.rows[pkt->row].push_back(entry);
+}
+
+void
+MemPacketQueue::removeEntry(std::deque<Entry> &entries, iterator it)
+{
+    // Packets mostly leave their bank in order, so start at the front
+    for (auto e = entries.begin(); e != entries.end(); ++e) {
+        if (e->pkt == it) {
+            entries.erase(e);
+            return;
+        }
+    }
+    panic("Memory packet missing from its bank queue\n");
+}
+
+MemPacketQueue::iterator
+MemPacketQueue::erase(iterator it)
+{
+    const MemPacket *pkt = *it;
+    BankQueue &bank_queue = bankQueues[bankIndex.at(
+        bankKey(pkt->isDram(), pkt->pseudoChannel, pkt->rank, pkt->bank))];
+
+    removeEntry(bank_queue.packets, it);
+    auto row_it = bank_queue.rows.find(pkt->row);
+    assert(row_it != bank_queue.rows.end());
+    removeEntry(row_it->second, it);
+    if (row_it->second.empty())
+        bank_queue.rows.erase(row_it);
+
+    return packets.erase(it);
+}
+
+const MemPacketQueue::BankQueue *
+MemPacketQueue::findBank(bool is_dram, uint8_t pseudo_channel, uint8_t rank,
+                         uint8_t bank) const
+{
+    auto it = bankIndex.find(bankKey(is_dram, pseudo_channel, rank, bank));
+    return it == bankIndex.end() ? nullptr : &bankQueues[it->second];
+}
+
+} // namespace memory
+} // namespace gem5
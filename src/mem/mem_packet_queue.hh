@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2012-2020 ARM Limited
+ * All rights reserved
+ *
+ * The license below extends only to copyright in the software and shall
+ * not be construed as granting a license to any other intellectual
+ * property including but not limited to intellectual property relating
+ * to a hardware implementation of the functionality of the software
+ * licensed hereunder.  You may use the software subject to the license
+ * terms below provided that you ensure that this notice is replicated
+ * unmodified and in its entirety in all distributions of the software,
+ * modified or unmodified, in source code or in binary form.
+ *
+ * Copyright (c) 2013 Amin Farmahini-Farahani
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * MemPacket and MemPacketQueue declarations
+ */
+
+#ifndef __MEM_MEM_PACKET_QUEUE_HH__
+#define __MEM_MEM_PACKET_QUEUE_HH__
+
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/packet.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * A burst helper helps organize and manage a packet that is larger than
+ * the memory burst size. A system packet that is larger than the burst size
+ * is split into multiple packets and all those packets point to
+ * a single burst helper such that we know when the whole packet is served.
+ */
+class BurstHelper
+{
+  public:
+
+    /** Number of bursts requred for a system packet **/
+    const unsigned int burstCount;
+
+    /** Number of bursts serviced so far for a system packet **/
+    unsigned int burstsServiced;
+
+    BurstHelper(unsigned int _burstCount)
+        : burstCount(_burstCount), burstsServiced(0)
+    { }
+};
+
+/**
+ * A memory packet stores packets along with the timestamp of when
+ * the packet entered the queue, and also the decoded address.
+ */
+class MemPacket
+{
+  public:
+
+    /** When did request enter the controller */
+    const Tick entryTime;
+
+    /** When will request leave the controller */
+    Tick readyTime;
+
+    /** This comes from the outside world */
+    const PacketPtr pkt;
+
+    /** RequestorID associated with the packet */
+    const RequestorID _requestorId;
+
+    const bool read;
+
+    /** Does this packet access DRAM?*/
+    const bool dram;
+
+    /** pseudo channel num*/
+    const uint8_t pseudoChannel;
+
+    /** Will be populated by address decoder */
+    const uint8_t rank;
+    const uint8_t bank;
+    const uint32_t row;
+
+    /**
+     * Bank id is calculated considering banks in all the ranks
+     * eg: 2 ranks each with 8 banks, then bankId = 0 --> rank0, bank0 and
+     * bankId = 8 --> rank1, bank0
+     */
+    const uint16_t bankId;
+
+    /**
+     * The starting address of the packet.
+     * This address could be unaligned to burst size boundaries. The
+     * reason is to keep the address offset so we can accurately check
+     * incoming read packets with packets in the write queue.
+     */
+    Addr addr;
+
+    /**
+     * The size of this dram packet in bytes
+     * It is always equal or smaller than the burst size
+     */
+    unsigned int size;
+
+    /**
+     * A pointer to the BurstHelper if this MemPacket is a split packet
+     * If not a split packet (common case), this is set to NULL
+     */
+    BurstHelper* burstHelper;
+
+    /**
+     * QoS value of the encapsulated packet read at queuing time
+     */
+    uint8_t _qosValue;
+
+    /**
+     * Set the packet QoS value
+     * (interface compatibility with Packet)
+     */
+    inline void qosValue(const uint8_t qv) { _qosValue = qv; }
+
+    /**
+     * Get the packet QoS value
+     * (interface compatibility with Packet)
+     */
+    inline uint8_t qosValue() const { return _qosValue; }
+
+    /**
+     * Get the packet RequestorID
+     * (interface compatibility with Packet)
+     */
+    inline RequestorID requestorId() const { return _requestorId; }
+
+    /**
+     * Get the packet size
+     * (interface compatibility with Packet)
+     */
+    inline unsigned int getSize() const { return size; }
+
+    /**
+     * Get the packet address
+     * (interface compatibility with Packet)
+     */
+    inline Addr getAddr() const { return addr; }
+
+    /**
+     * Return true if its a read packet
+     * (interface compatibility with Packet)
+     */
+    inline bool isRead() const { return read; }
+
+    /**
+     * Return true if its a write packet
+     * (interface compatibility with Packet)
+     */
+    inline bool isWrite() const { return !read; }
+
+    /**
+     * Return true if its a DRAM access
+     */
+    inline bool isDram() const { return dram; }
+
+    MemPacket(PacketPtr _pkt, bool is_read, bool is_dram, uint8_t _channel,
+               uint8_t _rank, uint8_t _bank, uint32_t _row, uint16_t bank_id,
+               Addr _addr, unsigned int _size)
+        : entryTime(curTick()), readyTime(curTick()), pkt(_pkt),
+          _requestorId(pkt->requestorId()),
+          read(is_read), dram(is_dram), pseudoChannel(_channel), rank(_rank),
+          bank(_bank), row(_row), bankId(bank_id), addr(_addr), size(_size),
+          burstHelper(NULL), _qosValue(_pkt->qosValue())
+    { }
+
+};
+
+/**
+ * A queue of memory packets in arrival order. The memory packets are
+ * stored in multiple such queues, based on their QoS priority.
+ *
+ * On top of the plain FIFO, the packets are indexed by the bank and
+ * the row they target, so that the FR-FCFS schedulers can find the
+ * oldest row hit and the oldest packet of each bank without walking
+ * the whole queue. Iterators remain valid until the packet they refer
+ * to is erased. All the packets in a queue are either reads or
+ * writes.
+ */
+class MemPacketQueue
+{
+  private:
+    typedef std::list<MemPacket*> PacketList;
+
+  public:
+    typedef PacketList::iterator iterator;
+    typedef PacketList::const_iterator const_iterator;
+
+    /** A queued packet along with its age; lower is older */
+    struct Entry
+    {
+        uint64_t seq;
+        iterator pkt;
+    };
+
+    /** The packets queued for one bank of one memory interface */
+    class BankQueue
+    {
+      public:
+        BankQueue(bool is_dram, uint8_t pseudo_channel, uint8_t _rank,
+                  uint8_t _bank)
+            : dram(is_dram), pseudoChannel(pseudo_channel), rank(_rank),
+              bank(_bank)
+        { }
+
+        const bool dram;
+        const uint8_t pseudoChannel;
+        const uint8_t rank;
+        const uint8_t bank;
+
+        bool empty() const { return packets.empty(); }
+        size_t size() const { return packets.size(); }
+
+        /** All the packets queued for the bank, oldest first */
+        const std::deque<Entry> &entries() const { return packets; }
+
+        /** @return the number of packets to the given row */
+        size_t rowSize(uint32_t row) const;
+
+        /** @return the oldest packet to the row, nullptr if none */
+        const Entry *oldestTo(uint32_t row) const;
+
+        /** @return the oldest packet to another row, nullptr if none */
+        const Entry *oldestNotTo(uint32_t row) const;
+
+        /**
+         * @return true if there are packets to the row besides the
+         * given one
+         */
+        bool hasOthersTo(uint32_t row, const MemPacket *pkt) const;
+
+      private:
+        friend class MemPacketQueue;
+
+        std::deque<Entry> packets;
+        std::unordered_map<uint32_t, std::deque<Entry>> rows;
+    };
+
+    iterator begin() { return packets.begin(); }
+    iterator end() { return packets.end(); }
+    const_iterator begin() const { return packets.begin(); }
+    const_iterator end() const { return packets.end(); }
+
+    bool empty() const { return packets.empty(); }
+    size_t size() const { return packets.size(); }
+    MemPacket *front() const { return packets.front(); }
+
+    void push_back(MemPacket *pkt);
+    iterator erase(iterator it);
+
+    /**
+     * All the banks that have had packets queued, including the ones
+     * that are empty by now. The order is not meaningful.
+     */
+    const std::vector<BankQueue> &banks() const { return bankQueues; }
+
+    /** @return the queue of the given bank, nullptr if never used */
+    const BankQueue *findBank(bool is_dram, uint8_t pseudo_channel,
+                              uint8_t rank, uint8_t bank) const;
+
+  private:
+    static uint32_t
+    bankKey(bool is_dram, uint8_t pseudo_channel, uint8_t rank,
+            uint8_t bank)
+    {
+        return uint32_t(is_dram) << 24 | uint32_t(pseudo_channel) << 16 |
+            uint32_t(rank) << 8 | bank;
+    }
+
+    static void removeEntry(std::deque<Entry> &entries, iterator it);
+
+    PacketList packets;
+
+    /** Age of the next packet pushed to the queue */
+    uint64_t nextSeq = 0;
+
+    std::vector<BankQueue> bankQueues;
+    std::unordered_map<uint32_t, size_t> bankIndex;
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif //__MEM_MEM_PACKET_QUEUE_HH__
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "base/gtest/cur_tick_fake.hh"
+#include "mem/mem_packet_queue.hh"
+#include "mem/packet.hh"
+#include "mem/request.hh"
+
+using namespace gem5;
+using namespace gem5::memory;
+
+// Instantiate the fake class to have a valid curTick of 0
+GTestTickHandler tickHandler;
+
+namespace
+{
+
+/** A bank of a memory interface, as the queue indexes it */
+struct BankId
+{
+    bool dram;
+    uint8_t channel;
+    uint8_t rank;
+    uint8_t bank;
+
+    bool
+    operator<(const BankId &other) const
+    {
+        return std::tie(dram, channel, rank, bank) <
+            std::tie(other.dram, other.channel, other.rank, other.bank);
+    }
+};
+
+BankId
+bankOf(const MemPacket *pkt)
+{
+    return {pkt->isDram(), pkt->pseudoChannel, pkt->rank, pkt->bank};
+}
+
+class MemPacketQueueTest : public testing::Test
+{
+  protected:
+    MemPacketQueue queue;
+
+    /** The queued packets in arrival order, as a plain list */
+    std::vector<MemPacket *> fifo;
+
+    std::vector<std::unique_ptr<Packet>> packets;
+    std::vector<std::unique_ptr<MemPacket>> memPackets;
+
+    MemPacket *
+    makePacket(const BankId &bank, uint32_t row)
+    {
+        auto req = std::make_shared<Request>(row * 0x1000, 64, 0, 0);
+        packets.emplace_back(new Packet(req, MemCmd::ReadReq));
+        memPackets.emplace_back(new MemPacket(packets.back().get(), true,
+            bank.dram, bank.channel, bank.rank, bank.bank, row,
+            bank.rank * 8 + bank.bank, row * 0x1000, 64));
+        return memPackets.back().get();
+    }
+
+    void
+    push(const BankId &bank, uint32_t row)
+    {
+        MemPacket *pkt = makePacket(bank, row);
+        queue.push_back(pkt);
+        fifo.push_back(pkt);
+    }
+
+    void
+    erase(size_t index)
+    {
+        auto it = queue.begin();
+        std::advance(it, index);
+        ASSERT_EQ(*it, fifo[index]);
+        auto next = queue.erase(it);
+        fifo.erase(fifo.begin() + index);
+        if (index < fifo.size())
+            EXPECT_EQ(*next, fifo[index]);
+        else
+            EXPECT_EQ(next, queue.end());
+    }
+
+    /** Check the queue and its indexes against the plain list */
+    void
+    check()
+    {
+        ASSERT_EQ(queue.size(), fifo.size());
+        ASSERT_EQ(queue.empty(), fifo.empty());
+        size_t i = 0;
+        for (MemPacket *pkt : queue)
+            ASSERT_EQ(pkt, fifo[i++]);
+
+        std::map<BankId, std::vector<MemPacket *>> by_bank;
+        for (MemPacket *pkt : fifo)
+            by_bank[bankOf(pkt)].push_back(pkt);
+
+        for (const auto &bank_queue : queue.banks()) {
+            const BankId id{bank_queue.dram, bank_queue.pseudoChannel,
+                            bank_queue.rank, bank_queue.bank};
+            EXPECT_EQ(queue.findBank(id.dram, id.channel, id.rank, id.bank),
+                      &bank_queue);
+            if (!by_bank.count(id)) {
+                EXPECT_TRUE(bank_queue.empty());
+            }
+        }
+
+        for (const auto &[id, pkts] : by_bank) {
+            const MemPacketQueue::BankQueue *bank_queue =
+                queue.findBank(id.dram, id.channel, id.rank, id.bank);
+            ASSERT_NE(bank_queue, nullptr);
+
+            // The bank holds its packets oldest first
+            ASSERT_EQ(bank_queue->size(), pkts.size());
+            uint64_t last_seq = 0;
+            for (size_t j = 0; j < pkts.size(); j++) {
+                const MemPacketQueue::Entry &entry =
+                    bank_queue->entries()[j];
+                EXPECT_EQ(*entry.pkt, pkts[j]);
+                if (j > 0) {
+                    EXPECT_GT(entry.seq, last_seq);
+                }
+                last_seq = entry.seq;
+            }
+
+            std::map<uint32_t, std::vector<MemPacket *>> by_row;
+            for (MemPacket *pkt : pkts)
+                by_row[pkt->row].push_back(pkt);
+
+            for (const auto &[row, row_pkts] : by_row) {
+                EXPECT_EQ(bank_queue->rowSize(row), row_pkts.size());
+                ASSERT_NE(bank_queue->oldestTo(row), nullptr);
+                EXPECT_EQ(*bank_queue->oldestTo(row)->pkt, row_pkts[0]);
+                EXPECT_EQ(bank_queue->hasOthersTo(row, row_pkts[0]),
+                          row_pkts.size() > 1);
+
+                MemPacket *not_to = nullptr;
+                for (MemPacket *pkt : pkts) {
+                    if (pkt->row != row) {
+                        not_to = pkt;
+                        break;
+                    }
+                }
+                const MemPacketQueue::Entry *entry =
+                    bank_queue->oldestNotTo(row);
+                EXPECT_EQ(entry ? *entry->pkt : nullptr, not_to);
+            }
+        }
+    }
+
+    /**
+     * Pick a packet the way the FR-FCFS schedulers do from the indexes:
+     * the oldest hit to an open row, or else the oldest packet.
+     */
+    MemPacket *
+    chooseIndexed(const std::map<BankId, uint32_t> &open_rows)
+    {
+        const MemPacketQueue::Entry *hit = nullptr;
+        const MemPacketQueue::Entry *miss = nullptr;
+        for (const auto &bank_queue : queue.banks()) {
+            if (bank_queue.empty())
+                continue;
+            auto open = open_rows.find({bank_queue.dram,
+                bank_queue.pseudoChannel, bank_queue.rank, bank_queue.bank});
+            const MemPacketQueue::Entry *entry = nullptr;
+            if (open != open_rows.end())
+                entry = bank_queue.oldestTo(open->second);
+            if (entry && (!hit || entry->seq < hit->seq))
+                hit = entry;
+
+            entry = open == open_rows.end() ? &bank_queue.entries().front() :
+                bank_queue.oldestNotTo(open->second);
+            if (entry && (!miss || entry->seq < miss->seq))
+                miss = entry;
+        }
+        if (hit)
+            return *hit->pkt;
+        return miss ? *miss->pkt : nullptr;
+    }
+
+    /** The same choice made by walking the whole queue */
+    MemPacket *
+    chooseLinear(const std::map<BankId, uint32_t> &open_rows)
+    {
+        for (MemPacket *pkt : queue) {
+            auto open = open_rows.find(bankOf(pkt));
+            if (open != open_rows.end() && open->second == pkt->row)
+                return pkt;
+        }
+        return queue.empty() ? nullptr : queue.front();
+    }
+};
+
+} // anonymous namespace
+
+TEST_F(MemPacketQueueTest, Empty)
+{
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.begin(), queue.end());
+    EXPECT_TRUE(queue.banks().empty());
+    EXPECT_EQ(queue.findBank(true, 0, 0, 0), nullptr);
+}
+
+TEST_F(MemPacketQueueTest, PushAndErase)
+{
+    const BankId a{true, 0, 0, 1};
+    const BankId b{true, 0, 1, 1};
+    push(a, 5);
+    push(b, 5);
+    push(a, 7);
+    push(a, 5);
+    check();
+
+    // Erase from the middle, the front and the back
+    erase(2);
+    check();
+    erase(0);
+    check();
+    erase(1);
+    check();
+    erase(0);
+    check();
+
+    // Banks that ran empty stay listed
+    EXPECT_EQ(queue.banks().size(), 2);
+    push(b, 3);
+    check();
+}
+
+TEST_F(MemPacketQueueTest, BanksOfOtherInterfaces)
+{
+    // Same rank and bank, but another channel or an NVM interface
+    push({true, 0, 0, 0}, 1);
+    push({true, 1, 0, 0}, 1);
+    push({false, 0, 0, 0}, 1);
+    check();
+    EXPECT_EQ(queue.banks().size(), 3);
+    for (const auto &bank_queue : queue.banks())
+        EXPECT_EQ(bank_queue.size(), 1);
+}
+
+TEST_F(MemPacketQueueTest, RandomAgainstLinearScan)
+{
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> coin(0, 99);
+    std::uniform_int_distribution<int> small(0, 3);
+
+    std::map<BankId, uint32_t> open_rows;
+    for (int step = 0; step < 2000; step++) {
+        if (fifo.empty() || coin(rng) < 55) {
+            const BankId bank{small(rng) != 0, 0, uint8_t(small(rng) % 2),
+                              uint8_t(small(rng))};
+            push(bank, small(rng));
+        } else {
+            // Mostly serve the packet FR-FCFS would pick
+            MemPacket *chosen = chooseIndexed(open_rows);
+            ASSERT_EQ(chosen, chooseLinear(open_rows));
+            size_t index = 0;
+            if (coin(rng) < 80) {
+                while (fifo[index] != chosen)
+                    index++;
+                open_rows[bankOf(chosen)] = chosen->row;
+            } else {
+                index = std::uniform_int_distribution<size_t>(
+                    0, fifo.size() - 1)(rng);
+            }
+            erase(index);
+        }
+        if (step % 16 == 0)
+            check();
+    }
+    check();
+
+    while (!fifo.empty()) {
+        ASSERT_EQ(chooseIndexed(open_rows), chooseLinear(open_rows));
+        erase(0);
+    }
+    check();
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/mem_pool.hh"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+/** The free lists of all live threads, and the counts of dead ones. */
+struct Registry
+{
+    std::mutex mutex;
+    std::vector<const void *> lists;
+    uint64_t retiredAllocs = 0;
+    uint64_t retiredHits = 0;
+    int64_t retiredPeaks[MemPool::MaxUsages] = {};
+    unsigned usages = 0;
+};
+
+Registry &
+registry()
+{
+    static Registry reg;
+    return reg;
+}
+
+} // anonymous namespace
+
+thread_local MemPool::FreeLists MemPool::freeLists;
+
+MemPool::FreeLists::FreeLists()
+{
+    Registry &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.lists.push_back(this);
+}
+
+MemPool::FreeLists::~FreeLists()
+{
+    for (Block *&head : heads) {
+        while (head) {
+            Block *next = head->next;
+            ::operator delete(head);
+            head = next;
+        }
+    }
+
+    Registry &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.lists.erase(std::find(reg.lists.begin(), reg.lists.end(), this));
+    reg.retiredAllocs += allocs.load(std::memory_order_relaxed);
+    reg.retiredHits += hits.load(std::memory_order_relaxed);
+    for (unsigned i = 0; i < MaxUsages; i++)
+        reg.retiredPeaks[i] += usage[i].peak.load(std::memory_order_relaxed);
+}
+
+uint64_t
+MemPool::allocs()
+{
+    Registry &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    uint64_t total = reg.retiredAllocs;
+    for (const void *p : reg.lists) {
+        total += static_cast<const FreeLists *>(p)->allocs.load(
+            std::memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t
+MemPool::hits()
+{
+    Registry &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    uint64_t total = reg.retiredHits;
+    for (const void *p : reg.lists) {
+        total += static_cast<const FreeLists *>(p)->hits.load(
+            std::memory_order_relaxed);
+    }
+    return total;
+}
+
+PoolUsage::PoolUsage()
+    : id([]() {
+          Registry &reg = registry();
+          std::lock_guard<std::mutex> lock(reg.mutex);
+          panic_if(reg.usages == MemPool::MaxUsages,
+                   "Too many PoolUsage instances.");
+          return reg.usages++;
+      }())
+{
+}
+
+uint64_t
+PoolUsage::highWaterMark() const
+{
+    Registry &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    int64_t total = reg.retiredPeaks[id];
+    for (const void *p : reg.lists) {
+        total += static_cast<const MemPool::FreeLists *>(p)->usage[id].peak
+            .load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+} // namespace gem5
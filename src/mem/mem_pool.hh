@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_MEM_POOL_HH__
+#define __MEM_MEM_POOL_HH__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "config/mem_pools.hh"
+
+namespace gem5
+{
+
+/**
+ * A kind of object allocated from the MemPool, whose number of live
+ * objects is tracked. Each thread counts the objects it allocates and
+ * frees, and the most it had live at once, so that tracking does not
+ * share any state between threads. The per-thread counts are only
+ * combined when highWaterMark() is read.
+ */
+class PoolUsage
+{
+  public:
+    PoolUsage();
+
+    /**
+     * Most objects of this kind that were live at once, summed over the
+     * threads of the process. This is exact when objects are freed on the
+     * thread that allocated them, and an approximation otherwise.
+     */
+    uint64_t highWaterMark() const;
+
+  private:
+    friend class MemPool;
+
+    /** Slot of this usage in the per-thread counters. */
+    const unsigned id;
+};
+
+/**
+ * Per-thread free lists for short-lived, frequently allocated objects:
+ * packets, requests and small payload buffers in the memory system, and
+ * flits, credits and protocol messages in Ruby. Blocks come in size
+ * classes of Granularity bytes up to MaxBlockSize, and a block released
+ * by deallocate() is handed out again by the next allocate() of the same
+ * class on the same thread. Larger allocations go straight to the heap,
+ * as do blocks released while a thread already holds MaxFreeBlocks of
+ * their class, so a thread that frees objects allocated elsewhere (e.g.
+ * the consumer side of a partitioned network) does not accumulate them.
+ *
+ * Building with MEM_POOLS disabled turns allocate() and deallocate()
+ * into plain operator new/delete, which keeps tools such as ASan and
+ * valgrind useful.
+ */
+class MemPool
+{
+  public:
+    /** Block sizes are rounded up to a multiple of this. */
+    static constexpr std::size_t Granularity = 16;
+    /** Largest allocation served from the free lists. */
+    static constexpr std::size_t MaxBlockSize = 512;
+    /** Free blocks of one size class a thread holds on to. */
+    static constexpr uint32_t MaxFreeBlocks = 4096;
+
+    /**
+     * @param size Size of the allocation in bytes.
+     * @param usage Optional usage to count the allocation in. It must be
+     *        passed to deallocate() as well.
+     */
+    static void *
+    allocate(std::size_t size, PoolUsage *usage = nullptr)
+    {
+#if MEM_POOLS
+        FreeLists &lists = freeLists;
+        if (usage)
+            lists.usage[usage->id].add();
+        if (size <= MaxBlockSize) {
+            const std::size_t cls = sizeClass(size);
+            bump(lists.allocs);
+            if (Block *block = lists.heads[cls]) {
+                lists.heads[cls] = block->next;
+                --lists.lengths[cls];
+                bump(lists.hits);
+                return block;
+            }
+            return ::operator new((cls + 1) * Granularity);
+        }
+#endif
+        return ::operator new(size);
+    }
+
+    /**
+     * Release a block from allocate(). The size and usage must be the
+     * ones it was allocated with.
+     */
+    static void
+    deallocate(void *p, std::size_t size, PoolUsage *usage = nullptr)
+    {
+#if MEM_POOLS
+        FreeLists &lists = freeLists;
+        if (usage)
+            lists.usage[usage->id].remove();
+        if (size <= MaxBlockSize) {
+            const std::size_t cls = sizeClass(size);
+            if (lists.lengths[cls] < MaxFreeBlocks) {
+                Block *block = static_cast<Block *>(p);
+                block->next = lists.heads[cls];
+                lists.heads[cls] = block;
+                ++lists.lengths[cls];
+                return;
+            }
+        }
+#endif
+        ::operator delete(p);
+    }
+
+    /** Allocations that were eligible for the pool, over all threads. */
+    static uint64_t allocs();
+
+    /** Allocations served from a free list, over all threads. */
+    static uint64_t hits();
+
+    /** Number of PoolUsage instances the process can have. */
+    static constexpr unsigned MaxUsages = 16;
+
+  private:
+    friend class PoolUsage;
+
+    struct Block
+    {
+        Block *next;
+    };
+
+    static constexpr std::size_t NumClasses = MaxBlockSize / Granularity;
+
+    static std::size_t
+    sizeClass(std::size_t size)
+    {
+        return size ? (size - 1) / Granularity : 0;
+    }
+
+    /**
+     * Counters are only written by their own thread, but are read by
+     * whichever thread dumps the stats.
+     */
+    static void
+    bump(std::atomic<uint64_t> &counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+    }
+
+    /**
+     * Live objects of one PoolUsage on one thread. This goes negative on
+     * a thread that frees more objects than it allocates.
+     */
+    struct UsageCounts
+    {
+        int64_t live = 0;
+        std::atomic<int64_t> peak{0};
+
+        void
+        add()
+        {
+            if (++live > peak.load(std::memory_order_relaxed))
+                peak.store(live, std::memory_order_relaxed);
+        }
+
+        void remove() { --live; }
+    };
+
+    struct FreeLists
+    {
+        Block *heads[NumClasses] = {};
+        uint32_t lengths[NumClasses] = {};
+        std::atomic<uint64_t> allocs{0};
+        std::atomic<uint64_t> hits{0};
+        UsageCounts usage[MaxUsages];
+
+        FreeLists();
+        ~FreeLists();
+    };
+
+    static thread_local FreeLists freeLists;
+};
+
+/**
+ * Standard allocator backed by MemPool, for use with std::allocate_shared
+ * so that an object and its shared_ptr control block come from the same
+ * pooled block.
+ */
+template <typename T>
+class MemPoolAllocator
+{
+  public:
+    typedef T value_type;
+
+    /** @param _usage Optional usage to count the allocations in. */
+    MemPoolAllocator(PoolUsage *_usage = nullptr) : usage(_usage) {}
+    template <typename U>
+    MemPoolAllocator(const MemPoolAllocator<U> &other) : usage(other.usage)
+    {}
+
+    T *
+    allocate(std::size_t n)
+    {
+        return static_cast<T *>(MemPool::allocate(n * sizeof(T), usage));
+    }
+
+    void
+    deallocate(T *p, std::size_t n)
+    {
+        MemPool::deallocate(p, n * sizeof(T), usage);
+    }
+
+    template <typename U>
+    bool
+    operator==(const MemPoolAllocator<U> &other) const
+    {
+        return usage == other.usage;
+    }
+
+    template <typename U>
+    bool
+    operator!=(const MemPoolAllocator<U> &other) const
+    {
+        return usage != other.usage;
+    }
+
+  private:
+    template <typename U>
+    friend class MemPoolAllocator;
+
+    PoolUsage *usage;
+};
+
+} // namespace gem5
+
+#endif // __MEM_MEM_POOL_HH__
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "mem/mem_pool.hh"
+
+using namespace gem5;
+
+#if MEM_POOLS
+
+TEST(MemPoolTest, ReuseSameClass)
+{
+    const uint64_t allocs = MemPool::allocs();
+    const uint64_t hits = MemPool::hits();
+
+    void *a = MemPool::allocate(40);
+    std::memset(a, 0xa5, 40);
+    MemPool::deallocate(a, 40);
+
+    // Any size in the same class gets the block back
+    void *b = MemPool::allocate(48);
+    EXPECT_EQ(a, b);
+    MemPool::deallocate(b, 48);
+
+    EXPECT_EQ(MemPool::allocs() - allocs, 2);
+    EXPECT_EQ(MemPool::hits() - hits, 1);
+}
+
+TEST(MemPoolTest, SeparateClasses)
+{
+    void *small = MemPool::allocate(8);
+    MemPool::deallocate(small, 8);
+
+    void *large = MemPool::allocate(MemPool::MaxBlockSize);
+    EXPECT_NE(small, large);
+    MemPool::deallocate(large, MemPool::MaxBlockSize);
+
+    EXPECT_EQ(MemPool::allocate(8), small);
+    MemPool::deallocate(small, 8);
+}
+
+TEST(MemPoolTest, OversizedBypassesPool)
+{
+    const uint64_t allocs = MemPool::allocs();
+
+    void *p = MemPool::allocate(MemPool::MaxBlockSize + 1);
+    MemPool::deallocate(p, MemPool::MaxBlockSize + 1);
+
+    EXPECT_EQ(MemPool::allocs(), allocs);
+}
+
+TEST(MemPoolTest, CountersSurviveThreadExit)
+{
+    const uint64_t allocs = MemPool::allocs();
+    const uint64_t hits = MemPool::hits();
+
+    std::thread worker([]() {
+        for (int i = 0; i < 10; i++)
+            MemPool::deallocate(MemPool::allocate(64), 64);
+    });
+    worker.join();
+
+    EXPECT_EQ(MemPool::allocs() - allocs, 10);
+    EXPECT_EQ(MemPool::hits() - hits, 9);
+}
+
+TEST(MemPoolTest, FreeListIsBounded)
+{
+    const std::size_t size = 200;
+    const uint64_t extra = 10;
+    const uint64_t count = MemPool::MaxFreeBlocks + extra;
+
+    std::vector<void *> blocks;
+    for (uint64_t i = 0; i < count; i++)
+        blocks.push_back(MemPool::allocate(size));
+
+    // Only MaxFreeBlocks of these are kept, the rest go to the heap
+    for (void *p : blocks)
+        MemPool::deallocate(p, size);
+    blocks.clear();
+
+    const uint64_t hits = MemPool::hits();
+    for (uint64_t i = 0; i < count; i++)
+        blocks.push_back(MemPool::allocate(size));
+    EXPECT_EQ(MemPool::hits() - hits, MemPool::MaxFreeBlocks);
+
+    for (void *p : blocks)
+        MemPool::deallocate(p, size);
+}
+
+TEST(MemPoolTest, FreedOnAnotherThread)
+{
+    const std::size_t size = 232;
+    const uint64_t count = 2 * MemPool::MaxFreeBlocks;
+
+    // The consumer frees everything the producer allocates. Its free list
+    // is bounded, and the producer keeps allocating from the heap.
+    uint64_t hits = 0;
+    for (int round = 0; round < 2; round++) {
+        hits = MemPool::hits();
+        std::vector<void *> blocks;
+        for (uint64_t i = 0; i < count; i++)
+            blocks.push_back(MemPool::allocate(size));
+        std::thread consumer([&blocks, size]() {
+            for (void *p : blocks)
+                MemPool::deallocate(p, size);
+        });
+        consumer.join();
+    }
+
+    EXPECT_EQ(MemPool::hits(), hits);
+}
+
+TEST(MemPoolTest, HighWaterMark)
+{
+    PoolUsage usage;
+    const uint64_t count = 2 * MemPool::MaxFreeBlocks;
+
+    // Churn past the free list bound, which sends blocks back to the heap
+    // but never has more than count objects allocated at once.
+    for (int round = 0; round < 3; round++) {
+        std::vector<void *> blocks;
+        for (uint64_t i = 0; i < count; i++)
+            blocks.push_back(MemPool::allocate(64, &usage));
+        for (void *p : blocks)
+            MemPool::deallocate(p, 64, &usage);
+    }
+    EXPECT_EQ(usage.highWaterMark(), count);
+
+    // Oversized allocations count as well
+    void *a = MemPool::allocate(MemPool::MaxBlockSize + 1, &usage);
+    MemPool::deallocate(a, MemPool::MaxBlockSize + 1, &usage);
+    EXPECT_EQ(usage.highWaterMark(), count);
+}
+
+TEST(MemPoolTest, SharedUsage)
+{
+    // Objects of different sizes counted together
+    PoolUsage usage;
+    void *a = MemPool::allocate(32, &usage);
+    void *b = MemPool::allocate(96, &usage);
+    MemPool::deallocate(a, 32, &usage);
+    void *c = MemPool::allocate(32, &usage);
+    MemPool::deallocate(c, 32, &usage);
+    MemPool::deallocate(b, 96, &usage);
+
+    EXPECT_EQ(usage.highWaterMark(), 2);
+}
+
+TEST(MemPoolTest, HighWaterMarkOfThreads)
+{
+    // Each thread counts its own objects, and the marks add up
+    PoolUsage usage;
+    std::thread worker([&usage]() {
+        std::vector<void *> blocks;
+        for (int i = 0; i < 5; i++)
+            blocks.push_back(MemPool::allocate(64, &usage));
+        for (void *p : blocks)
+            MemPool::deallocate(p, 64, &usage);
+    });
+    worker.join();
+
+    void *a = MemPool::allocate(64, &usage);
+    void *b = MemPool::allocate(64, &usage);
+    MemPool::deallocate(a, 64, &usage);
+    MemPool::deallocate(b, 64, &usage);
+
+    EXPECT_EQ(usage.highWaterMark(), 7);
+}
+
+#endif // MEM_POOLS
+
+TEST(MemPoolTest, AllocateShared)
+{
+    struct Payload
+    {
+        uint64_t a = 1;
+        uint64_t b = 2;
+    };
+
+    PoolUsage usage;
+    std::weak_ptr<Payload> weak;
+    {
+        auto p = std::allocate_shared<Payload>(
+            MemPoolAllocator<Payload>(&usage));
+        EXPECT_EQ(p->a, 1);
+        EXPECT_EQ(p->b, 2);
+        weak = p;
+        EXPECT_FALSE(weak.expired());
+    }
+    EXPECT_TRUE(weak.expired());
+#if MEM_POOLS
+    EXPECT_EQ(usage.highWaterMark(), 1);
+#endif
+}
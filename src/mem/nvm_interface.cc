@@ -207,57 +207,68 @@ NVMInterface::decodePacket(const PacketPtr pkt, Addr pkt_addr,
 std::pair<MemPacketQueue::iterator, Tick>
 NVMInterface::chooseNextFRFCFS(MemPacketQueue& queue, Tick min_col_at) const
 {
-    // remember if we found a hit, but one that cannit issue seamlessly
-    bool found_prepped_pkt = false;
+    // FCFS within entries that can issue without additional delay, such
+    // as same rank accesses or media delay requirements, and otherwise
+    // FCFS within the entries that are ready. Whether a packet can issue
+    // seamlessly only depends on its bank, so the oldest ready packet of
+    // each bank is the only candidate from that bank
+    const MemPacketQueue::Entry *seamless_pkt = nullptr;
+    const MemPacketQueue::Entry *prepped_pkt = nullptr;
+    Tick seamless_col_at = MaxTick;
+    Tick prepped_col_at = MaxTick;
+
+    for (const auto& bank_queue : queue.banks()) {
+        // select optimal NVM packet in Q
+        if (bank_queue.empty() || bank_queue.dram)
+            continue;
+
+        // find the oldest packet of the bank that is ready to burst
+        const MemPacketQueue::Entry *ready = nullptr;
+        for (const auto& entry : bank_queue.entries()) {
+            if (burstReady(*entry.pkt)) {
+                ready = &entry;
+                break;
+            }
+        }
 
-    auto selected_pkt_it = queue.end();
-    Tick selected_col_at = MaxTick;
+        if (!ready) {
+            DPRINTF(NVM, "%s bank %d - Rank %d not available\n", __func__,
+                    bank_queue.bank, bank_queue.rank);
+            continue;
+        }
 
-    for (auto i = queue.begin(); i != queue.end() ; ++i) {
-        MemPacket* pkt = *i;
+        DPRINTF(NVM, "%s bank %d - Rank %d available\n", __func__,
+                bank_queue.bank, bank_queue.rank);
 
-        // select optimal NVM packet in Q
-        if (!pkt->isDram()) {
-            const Bank& bank = ranks[pkt->rank]->banks[pkt->bank];
-            const Tick col_allowed_at = pkt->isRead() ? bank.rdAllowedAt :
-                                                        bank.wrAllowedAt;
-
-            // check if rank is not doing a refresh and thus is available,
-            // if not, jump to the next packet
-            if (burstReady(pkt)) {
-                DPRINTF(NVM, "%s bank %d - Rank %d available\n", __func__,
-                        pkt->bank, pkt->rank);
-
-                // no additional rank-to-rank or media delays
-                if (col_allowed_at <= min_col_at) {
-                    // FCFS within entries that can issue without
-                    // additional delay, such as same rank accesses
-                    // or media delay requirements
-                    selected_pkt_it = i;
-                    selected_col_at = col_allowed_at;
-                    // no need to look through the remaining queue entries
-                    DPRINTF(NVM, "%s Seamless buffer hit\n", __func__);
-                    break;
-                } else if (!found_prepped_pkt) {
-                    // packet is to prepped region but cannnot issue
-                    // seamlessly; remember this one and continue
-                    selected_pkt_it = i;
-                    selected_col_at = col_allowed_at;
-                    DPRINTF(NVM, "%s Prepped packet found \n", __func__);
-                    found_prepped_pkt = true;
-                }
-            } else {
-                DPRINTF(NVM, "%s bank %d - Rank %d not available\n", __func__,
-                        pkt->bank, pkt->rank);
+        const Bank& bank = ranks[bank_queue.rank]->banks[bank_queue.bank];
+        const Tick col_allowed_at = (*ready->pkt)->isRead() ?
+            bank.rdAllowedAt : bank.wrAllowedAt;
+
+        // no additional rank-to-rank or media delays
+        if (col_allowed_at <= min_col_at) {
+            if (!seamless_pkt || ready->seq < seamless_pkt->seq) {
+                seamless_pkt = ready;
+                seamless_col_at = col_allowed_at;
             }
+        } else if (!prepped_pkt || ready->seq < prepped_pkt->seq) {
+            // packet is to prepped region but cannot issue seamlessly
+            prepped_pkt = ready;
+            prepped_col_at = col_allowed_at;
         }
     }
 
-    if (selected_pkt_it == queue.end()) {
-        DPRINTF(NVM, "%s no available NVM ranks found\n", __func__);
+    if (seamless_pkt) {
+        DPRINTF(NVM, "%s Seamless buffer hit\n", __func__);
+        return std::make_pair(seamless_pkt->pkt, seamless_col_at);
+    }
+
+    if (prepped_pkt) {
+        DPRINTF(NVM, "%s Prepped packet found \n", __func__);
+        return std::make_pair(prepped_pkt->pkt, prepped_col_at);
     }
 
-    return std::make_pair(selected_pkt_it, selected_col_at);
+    DPRINTF(NVM, "%s no available NVM ranks found\n", __func__);
+    return std::make_pair(queue.end(), MaxTick);
 }
 
 void
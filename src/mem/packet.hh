@@ -61,6 +61,7 @@
 #include "base/printable.hh"
 #include "base/types.hh"
 #include "mem/htm.hh"
+#include "mem/mem_pool.hh"
 #include "mem/request.hh"
 #include "sim/byteswap.hh"
 
@@ -346,6 +347,9 @@ class Packet : public Printable, public Extensible<Packet>
         VALID_ADDR             = 0x00000100,
         VALID_SIZE             = 0x00000200,
 
+        /// The dynamic data lives in the packet itself (inlineData), and
+        /// goes away with it
+        INLINE_DATA            = 0x00000800,
         /// Is the data pointer set to a value that shouldn't be freed
         /// when the packet is destroyed?
         STATIC_DATA            = 0x00001000,
@@ -353,6 +357,9 @@ class Packet : public Printable, public Extensible<Packet>
         /// the packet is destroyed. The pointer is assumed to be pointing
         /// to an array, and delete [] is consequently called
         DYNAMIC_DATA           = 0x00002000,
+        /// The dynamic data came from the memory pool rather than new [],
+        /// and goes back to it when the packet is destroyed
+        POOLED_DATA            = 0x00004000,
 
         /// suppress the error if this packet encounters a functional
         /// access failure.
@@ -419,6 +426,17 @@ class Packet : public Printable, public Extensible<Packet>
      */
     uint64_t htmTransactionUid;
 
+  public:
+    /** Largest payload that allocate() keeps inside the packet. */
+    static constexpr unsigned InlineDataSize = 64;
+
+  private:
+    /**
+     * Storage for payloads of up to a cache line, so that most packets
+     * need no separate data buffer.
+     */
+    alignas(8) uint8_t inlineData[InlineDataSize];
+
   public:
 
     /**
@@ -1054,6 +1072,19 @@ class Packet : public Printable, public Extensible<Packet>
         deleteData();
     }
 
+    /** Packets are allocated from the memory pool. */
+    static void *
+    operator new(std::size_t size)
+    {
+        return MemPool::allocate(size);
+    }
+
+    static void
+    operator delete(void *p, std::size_t size)
+    {
+        MemPool::deallocate(p, size);
+    }
+
     /**
      * Take a request packet and modify it in place to be suitable for
      * returning as a response to that request.
@@ -1355,10 +1386,12 @@ class Packet : public Printable, public Extensible<Packet>
     void
     deleteData()
     {
-        if (flags.isSet(DYNAMIC_DATA))
+        if (flags.isSet(POOLED_DATA))
+            MemPool::deallocate(data, size);
+        else if (flags.isSet(DYNAMIC_DATA) && !flags.isSet(INLINE_DATA))
             delete [] data;
 
-        flags.clear(STATIC_DATA|DYNAMIC_DATA);
+        flags.clear(STATIC_DATA|DYNAMIC_DATA|POOLED_DATA|INLINE_DATA);
         data = NULL;
     }
 
@@ -1371,7 +1404,17 @@ class Packet : public Printable, public Extensible<Packet>
         if (hasData() || hasRespData()) {
             assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA));
             flags.set(DYNAMIC_DATA);
-            data = new uint8_t[getSize()];
+            if (getSize() <= InlineDataSize) {
+                // accesses of up to a cache line carry their payload
+                flags.set(INLINE_DATA);
+                data = inlineData;
+            } else if (getSize() <= MemPool::MaxBlockSize) {
+                // larger payloads, e.g. 128 byte lines, are recycled
+                flags.set(POOLED_DATA);
+                data = static_cast<uint8_t *>(MemPool::allocate(getSize()));
+            } else {
+                data = new uint8_t[getSize()];
+            }
         }
     }
 
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "base/gtest/cur_tick_fake.hh"
+#include "mem/mem_pool.hh"
+#include "mem/packet.hh"
+#include "mem/packet_access.hh"
+#include "mem/request.hh"
+
+using namespace gem5;
+
+// Instantiate the fake class to have a valid curTick of 0
+GTestTickHandler tickHandler;
+
+namespace
+{
+
+RequestPtr
+makeReq(unsigned size)
+{
+    return makeRequest(0x1000, size, 0, 0);
+}
+
+/** Check if a data pointer points into the packet object itself. */
+bool
+isInline(const Packet *pkt, const uint8_t *data)
+{
+    auto *begin = reinterpret_cast<const uint8_t *>(pkt);
+    return data >= begin && data < begin + sizeof(Packet);
+}
+
+} // anonymous namespace
+
+/** Payloads of up to a cache line live inside the packet. */
+TEST(PacketTest, InlineData)
+{
+    PacketPtr pkt = new Packet(makeReq(Packet::InlineDataSize),
+                               MemCmd::ReadReq);
+    pkt->allocate();
+    uint8_t *data = pkt->getPtr<uint8_t>();
+    EXPECT_TRUE(isInline(pkt, data));
+    std::memset(data, 0xa5, Packet::InlineDataSize);
+
+    // deleteData() leaves the packet free to take other data
+    pkt->deleteData();
+    uint8_t buf[8] = {};
+    pkt->dataStatic(buf);
+    EXPECT_EQ(pkt->getConstPtr<uint8_t>(), buf);
+    pkt->deleteData();
+
+    uint8_t *dynamic = new uint8_t[8];
+    pkt->dataDynamic(dynamic);
+    EXPECT_EQ(pkt->getConstPtr<uint8_t>(), dynamic);
+
+    // Frees the dynamic data with delete []
+    delete pkt;
+}
+
+/** Payloads larger than the pool's blocks come from new []. */
+TEST(PacketTest, LargeData)
+{
+    const unsigned size = MemPool::MaxBlockSize + 64;
+    PacketPtr pkt = new Packet(makeReq(size), MemCmd::ReadReq);
+    pkt->allocate();
+    uint8_t *data = pkt->getPtr<uint8_t>();
+    EXPECT_FALSE(isInline(pkt, data));
+    std::memset(data, 0xa5, size);
+
+    pkt->deleteData();
+    pkt->allocate();
+    std::memset(pkt->getPtr<uint8_t>(), 0x5a, size);
+    delete pkt;
+}
+
+/** A copy of a packet with inline data gets its own payload. */
+TEST(PacketTest, CopyInlineData)
+{
+    PacketPtr pkt = new Packet(makeReq(8), MemCmd::ReadReq);
+    pkt->allocate();
+    pkt->setRaw<uint64_t>(1);
+
+    PacketPtr copy = new Packet(pkt, false, true);
+    const uint8_t *data = copy->getConstPtr<uint8_t>();
+    EXPECT_TRUE(isInline(copy, data));
+    EXPECT_NE(data, pkt->getConstPtr<uint8_t>());
+
+    copy->setRaw<uint64_t>(2);
+    EXPECT_EQ(pkt->getRaw<uint64_t>(), 1);
+
+    // The copy's payload outlives the original
+    delete pkt;
+    EXPECT_EQ(copy->getRaw<uint64_t>(), 2);
+    delete copy;
+}
+
+#if MEM_POOLS
+
+/** Packets themselves are recycled through the memory pool. */
+TEST(PacketTest, PacketFromPool)
+{
+    RequestPtr req = makeReq(8);
+    PacketPtr pkt = new Packet(req, MemCmd::ReadReq);
+    const void *block = pkt;
+    delete pkt;
+
+    const uint64_t hits = MemPool::hits();
+    pkt = new Packet(req, MemCmd::ReadReq);
+    EXPECT_EQ(pkt, block);
+    EXPECT_EQ(MemPool::hits() - hits, 1);
+    delete pkt;
+}
+
+/** Payloads the pool can hold are allocated from it and go back to it. */
+TEST(PacketTest, PooledData)
+{
+    const unsigned size = 128;
+    RequestPtr req = makeReq(size);
+
+    PacketPtr pkt = new Packet(req, MemCmd::ReadReq);
+    pkt->allocate();
+    const uint8_t *data = pkt->getConstPtr<uint8_t>();
+    ASSERT_NE(data, nullptr);
+
+    // deleteData() hands the payload back to the pool
+    pkt->deleteData();
+    void *block = MemPool::allocate(size);
+    EXPECT_EQ(block, data);
+    MemPool::deallocate(block, size);
+
+    // and so does destroying the packet
+    pkt->allocate();
+    data = pkt->getConstPtr<uint8_t>();
+    delete pkt;
+    block = MemPool::allocate(size);
+    EXPECT_EQ(block, data);
+    MemPool::deallocate(block, size);
+}
+
+#endif // MEM_POOLS
@@ -45,7 +45,6 @@
 #include <zlib.h>
 
 #include <cerrno>
-#include <climits>
 #include <cstdio>
 #include <iostream>
 #include <string>
@@ -55,6 +54,7 @@
 #include "debug/AddrRanges.hh"
 #include "debug/Checkpoint.hh"
 #include "mem/abstract_mem.hh"
+#include "mem/store_checkpoint.hh"
 #include "sim/serialize.hh"
 #include "sim/sim_exit.hh"
 
@@ -80,10 +80,14 @@ PhysicalMemory::PhysicalMemory(const std::string& _name,
                                const std::vector<AbstractMemory*>& _memories,
                                bool mmap_using_noreserve,
                                const std::string& shared_backstore,
-                               bool auto_unlink_shared_backstore) :
+                               bool auto_unlink_shared_backstore,
+                               unsigned checkpoint_threads,
+                               bool checkpoint_compress,
+                               bool checkpoint_mmap) :
     _name(_name), size(0), mmapUsingNoReserve(mmap_using_noreserve),
     sharedBackstore(shared_backstore), sharedBackstoreSize(0),
-    pageSize(sysconf(_SC_PAGE_SIZE))
+    pageSize(sysconf(_SC_PAGE_SIZE)), checkpointThreads(checkpoint_threads),
+    checkpointCompress(checkpoint_compress), checkpointMmap(checkpoint_mmap)
 {
     // Register cleanup callback if requested.
     if (auto_unlink_shared_backstore && !sharedBackstore.empty()) {
@@ -376,34 +380,13 @@ PhysicalMemory::serializeStore(CheckpointOut &cp, unsigned int store_id,
     SERIALIZE_SCALAR(filename);
     SERIALIZE_SCALAR(range_size);
 
+    std::string format = "chunked";
+    SERIALIZE_SCALAR(format);
+
     // write memory file
     std::string filepath = CheckpointIn::dir() + "/" + filename.c_str();
-    gzFile compressed_mem = gzopen(filepath.c_str(), "wb");
-    if (compressed_mem == NULL)
-        fatal("Can't open physical memory checkpoint file '%s'\n",
-              filename);
-
-    uint64_t pass_size = 0;
-
-    // gzwrite fails if (int)len < 0 (gzwrite returns int)
-    for (uint64_t written = 0; written < range.size();
-         written += pass_size) {
-        pass_size = (uint64_t)INT_MAX < (range.size() - written) ?
-            (uint64_t)INT_MAX : (range.size() - written);
-
-        if (gzwrite(compressed_mem, pmem + written,
-                    (unsigned int) pass_size) != (int) pass_size) {
-            fatal("Write failed on physical memory checkpoint file '%s'\n",
-                  filename);
-        }
-    }
-
-    // close the compressed stream and check that the exit status
-    // is zero
-    if (gzclose(compressed_mem))
-        fatal("Close failed on physical memory checkpoint file '%s'\n",
-              filename);
-
+    store_checkpoint::save(filepath, pmem, range.size(), checkpointThreads,
+                           checkpointCompress);
 }
 
 void
@@ -443,11 +426,6 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(filename);
     std::string filepath = cp.getCptDir() + "/" + filename;
 
-    // mmap memoryfile
-    gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
-    if (compressed_mem == NULL)
-        fatal("Can't open physical memory checkpoint file '%s'", filename);
-
     // we've already got the actual backing store mapped
     uint8_t* pmem = backingStore[store_id].pmem;
     AddrRange range = backingStore[store_id].range;
@@ -462,6 +440,34 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
         fatal("Memory range size has changed! Saw %lld, expected %lld\n",
               range_size, range.size());
 
+    // checkpoints from before the chunked format are a gzip stream
+    std::string format = "gzip";
+    UNSERIALIZE_OPT_SCALAR(format);
+
+    if (format == "chunked") {
+        // a shared backstore has to stay the shared memory segment
+        const bool map = checkpointMmap && sharedBackstore.empty();
+        warn_if(checkpointMmap && !map, "Not mapping physical memory "
+                "checkpoint file '%s' over a shared backstore\n", filename);
+
+        if (store_checkpoint::restore(filepath, pmem, range.size(),
+                                      checkpointThreads, map)) {
+            DPRINTF(Checkpoint, "Mapped physical memory %s\n", filename);
+        } else {
+            warn_if(map, "Physical memory checkpoint file '%s' is not a "
+                    "flat image, only mapping its uncompressed chunks\n",
+                    filename);
+        }
+        return;
+    }
+
+    fatal_if(format != "gzip", "Unknown format '%s' of physical memory "
+             "checkpoint file '%s'\n", format, filename);
+
+    gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
+    if (compressed_mem == NULL)
+        fatal("Can't open physical memory checkpoint file '%s'", filename);
+
     uint64_t curr_size = 0;
     long* temp_page = new long[chunk_size];
     long* pmem_current;
@@ -158,6 +158,16 @@ class PhysicalMemory : public Serializable
 
     long pageSize;
 
+    // Threads used to save and restore the backing stores, 0 for one
+    // per host core
+    const unsigned checkpointThreads;
+
+    // Compress the backing stores in checkpoints, or write flat images
+    const bool checkpointCompress;
+
+    // Map flat images copy-on-write over the backing stores on restore
+    const bool checkpointMmap;
+
     // The physical memory used to provide the memory in the simulated
     // system
     std::vector<BackingStoreEntry> backingStore;
@@ -191,7 +201,10 @@ class PhysicalMemory : public Serializable
                    const std::vector<AbstractMemory*>& _memories,
                    bool mmap_using_noreserve,
                    const std::string& shared_backstore,
-                   bool auto_unlink_shared_backstore);
+                   bool auto_unlink_shared_backstore,
+                   unsigned checkpoint_threads = 0,
+                   bool checkpoint_compress = true,
+                   bool checkpoint_mmap = false);
 
     /**
      * Unmap all the backing store we have used.
@@ -54,6 +54,7 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "base/amo.hh"
@@ -63,6 +64,7 @@
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
 #include "mem/htm.hh"
+#include "mem/mem_pool.hh"
 #include "sim/cur_tick.hh"
 
 namespace gem5
@@ -94,6 +96,9 @@ class ThreadContext;
 typedef std::shared_ptr<Request> RequestPtr;
 typedef uint16_t RequestorID;
 
+template <typename... Args>
+RequestPtr makeRequest(Args&&... args);
+
 class Request : public Extensible<Request>
 {
   public:
@@ -530,7 +535,7 @@ class Request : public Extensible<Request>
     static RequestPtr
     createMemManagement(Flags flags, RequestorID id)
     {
-        auto mgmt_req = std::make_shared<Request>();
+        auto mgmt_req = makeRequest();
         mgmt_req->_flags.set(flags);
         mgmt_req->_requestorId = id;
         mgmt_req->_time = curTick();
@@ -612,8 +617,8 @@ class Request : public Extensible<Request>
         assert(hasVaddr());
         assert(!hasPaddr());
         assert(split_addr > _vaddr && split_addr < _vaddr + _size);
-        req1 = std::make_shared<Request>(*this);
-        req2 = std::make_shared<Request>(*this);
+        req1 = makeRequest(*this);
+        req2 = makeRequest(*this);
         req1->_size = split_addr - _vaddr;
         req2->_vaddr = split_addr;
         req2->_size = _size - req1->_size;
@@ -1122,6 +1127,20 @@ class Request : public Extensible<Request>
     /** @} */
 };
 
+/**
+ * Create a request like std::make_shared, with the request and its
+ * reference count in a single block, but taking that block from the
+ * memory pool. Requests live as long as their packets, so they are as
+ * worth recycling.
+ */
+template <typename... Args>
+RequestPtr
+makeRequest(Args&&... args)
+{
+    return std::allocate_shared<Request>(MemPoolAllocator<Request>(),
+                                         std::forward<Args>(args)...);
+}
+
 } // namespace gem5
 
 #endif // __MEM_REQUEST_HH__
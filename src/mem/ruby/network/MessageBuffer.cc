@@ -48,6 +48,7 @@
 #include "base/stl_helpers.hh"
 #include "debug/RubyQueue.hh"
 #include "mem/ruby/system/RubySystem.hh"
+#include "sim/eventq.hh"
 
 namespace gem5
 {
@@ -214,19 +215,83 @@ random_time()
     return time;
 }
 
+bool
+MessageBuffer::isRemoteEnqueue() const
+{
+    assert(m_consumer != NULL);
+    return inParallelMode &&
+        m_consumer->getObject()->eventQueue() != curEventQueue();
+}
+
+void
+MessageBuffer::enqueueRemote(MsgPtr message, Tick current_time, Tick delta,
+                             bool bypassStrictFIFO)
+{
+    // The consumer of this buffer is simulated by another event queue
+    // (thread). None of the buffer state may be touched from here, so the
+    // message is handed over through an event on the consumer's queue. That
+    // event is merged into the consumer's queue at the next quantum
+    // boundary, so the message cannot arrive before curTick() + simQuantum.
+    // The quantum is chosen from the link latencies between partitions to
+    // keep this bound from changing the timing of most messages.
+    fatal_if(m_max_size > 0,
+             "%s: finite buffers cannot cross Ruby partitions, set "
+             "buffer_size to 0 or keep producer and consumer on the same "
+             "event queue.", name());
+    fatal_if(m_randomization == MessageRandomization::enabled ||
+             (m_randomization == MessageRandomization::ruby_system &&
+              RubySystem::getRandomization()),
+             "%s: randomization is not supported across Ruby partitions.",
+             name());
+    panic_if((delta == 0) && !m_allow_zero_latency,
+           "Delta equals zero and allow_zero_latency is false during enqueue");
+
+    Tick arrival_time = std::max(current_time + delta,
+                                 curTick() + simQuantum);
+
+    DPRINTF(RubyQueue, "Remote enqueue arrival_time: %lld, Message: %s\n",
+            arrival_time, *(message.get()));
+
+    {
+        std::lock_guard<std::mutex> lock(m_remote_mutex);
+        m_remote_inbox.push_back({arrival_time, message, bypassStrictFIFO});
+    }
+
+    auto *deliver = new EventFunctionWrapper(
+        [this]{ deliverRemoteMessages(); }, name() + ".remoteDeliver", true);
+    m_consumer->getObject()->eventQueue()->schedule(deliver, arrival_time);
+}
+
+void
+MessageBuffer::deliverRemoteMessages()
+{
+    // Several delivery events may fire in the same tick. Draining the
+    // inbox in production order, rather than relying on the order of the
+    // events, keeps ordered buffers ordered and the simulation
+    // deterministic.
+    std::lock_guard<std::mutex> lock(m_remote_mutex);
+    auto it = m_remote_inbox.begin();
+    while (it != m_remote_inbox.end()) {
+        if (it->arrival > curTick()) {
+            ++it;
+            continue;
+        }
+        insertMessage(it->msg, curTick(), it->arrival, it->bypassStrictFIFO);
+        it = m_remote_inbox.erase(it);
+    }
+}
+
 void
 MessageBuffer::enqueue(MsgPtr message, Tick current_time, Tick delta,
                        bool bypassStrictFIFO)
 {
-    // record current time incase we have a pop that also adjusts my size
-    if (m_time_last_time_enqueue < current_time) {
-        m_msgs_this_cycle = 0;  // first msg this cycle
-        m_time_last_time_enqueue = current_time;
+    // messages produced by another Ruby partition are delivered through
+    // the consumer's event queue
+    if (isRemoteEnqueue()) {
+        enqueueRemote(message, current_time, delta, bypassStrictFIFO);
+        return;
     }
 
-    m_msg_counter++;
-    m_msgs_this_cycle++;
-
     // Calculate the arrival time of the message, that is, the first
     // cycle the message can be dequeued.
     panic_if((delta == 0) && !m_allow_zero_latency,
@@ -252,14 +317,30 @@ MessageBuffer::enqueue(MsgPtr message, Tick current_time, Tick delta,
         }
     }
 
+    insertMessage(message, current_time, arrival_time, bypassStrictFIFO);
+}
+
+void
+MessageBuffer::insertMessage(MsgPtr message, Tick current_time,
+                             Tick arrival_time, bool bypassStrictFIFO)
+{
+    // record current time incase we have a pop that also adjusts my size
+    if (m_time_last_time_enqueue < current_time) {
+        m_msgs_this_cycle = 0;  // first msg this cycle
+        m_time_last_time_enqueue = current_time;
+    }
+
+    m_msg_counter++;
+    m_msgs_this_cycle++;
+
     // Check the arrival time
     assert(arrival_time >= current_time);
     if (m_strict_fifo &&
         !(bypassStrictFIFO || m_last_message_strict_fifo_bypassed)) {
         if (arrival_time < m_last_arrival_time) {
             panic("FIFO ordering violated: %s name: %s current time: %d "
-                  "delta: %d arrival_time: %d last arrival_time: %d\n",
-                  *this, name(), current_time, delta, arrival_time,
+                  "arrival_time: %d last arrival_time: %d\n",
+                  *this, name(), current_time, arrival_time,
                   m_last_arrival_time);
         }
     }
@@ -577,6 +658,18 @@ MessageBuffer::functionalAccess(Packet *pkt, bool is_read, WriteMask *mask)
         }
     }
 
+    // Messages from other partitions that have not been delivered yet
+    std::lock_guard<std::mutex> lock(m_remote_mutex);
+    for (auto &remote : m_remote_inbox) {
+        Message *msg = remote.msg.get();
+        if (is_read && !mask && msg->functionalRead(pkt))
+            return 1;
+        else if (is_read && mask && msg->functionalRead(pkt, *mask))
+            num_functional_accesses++;
+        else if (!is_read && msg->functionalWrite(pkt))
+            num_functional_accesses++;
+    }
+
     return num_functional_accesses;
 }
 
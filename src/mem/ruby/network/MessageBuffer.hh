@@ -50,6 +50,8 @@
 #include <cassert>
 #include <functional>
 #include <iostream>
+#include <list>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -196,6 +198,24 @@ class MessageBuffer : public SimObject
   private:
     void reanalyzeList(std::list<MsgPtr> &, Tick);
 
+    //! True if the consumer runs on a different event queue than the
+    //! caller, i.e. the buffer crosses a Ruby partition boundary.
+    bool isRemoteEnqueue() const;
+
+    //! Hand a message produced in another partition over to the
+    //! consumer's event queue. It is inserted no earlier than the next
+    //! quantum boundary.
+    void enqueueRemote(MsgPtr message, Tick current_time, Tick delta,
+                       bool bypassStrictFIFO);
+
+    //! Move messages from the remote inbox that are due into the buffer.
+    void deliverRemoteMessages();
+
+    //! Insert a message that becomes ready at arrival_time. Must be
+    //! called from the thread that owns the consumer's event queue.
+    void insertMessage(MsgPtr message, Tick current_time,
+                       Tick arrival_time, bool bypassStrictFIFO);
+
     uint32_t functionalAccess(Packet *pkt, bool is_read, WriteMask *mask);
 
   private:
@@ -206,6 +226,21 @@ class MessageBuffer : public SimObject
 
     std::function<void()> m_dequeue_callback;
 
+    struct RemoteMessage
+    {
+        Tick arrival;
+        MsgPtr msg;
+        bool bypassStrictFIFO;
+    };
+
+    /**
+     * Messages enqueued by a producer running on another event queue.
+     * They are moved into m_prio_heap by the consumer's thread once they
+     * are due.
+     */
+    std::mutex m_remote_mutex;
+    std::list<RemoteMessage> m_remote_inbox;
+
     // use a std::map for the stalled messages as this container is
     // sorted and ensures a well-defined iteration order
     typedef std::map<Addr, std::list<MsgPtr> > StallMsgMapType;
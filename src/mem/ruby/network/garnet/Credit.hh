@@ -64,6 +64,21 @@ class Credit : public flit
 
     ~Credit() {};
 
+    /** Usage of the memory pool by credits. */
+    static inline PoolUsage poolUsage;
+
+    static void *
+    operator new(std::size_t size)
+    {
+        return MemPool::allocate(size, &poolUsage);
+    }
+
+    static void
+    operator delete(void *p, std::size_t size)
+    {
+        MemPool::deallocate(p, size, &poolUsage);
+    }
+
     bool is_free_signal() { return m_is_free_signal; }
 
   private:
@@ -55,6 +55,9 @@ class NetworkLink(ClockedObject):
         Parent.supported_vnets, "Vnets supported"
     )
     width = Param.UInt32(Parent.width, "bit-width of the link")
+    skip_idle_wakeups = Param.Bool(
+        Parent.skip_idle_wakeups, "sleep until the next flit is ready"
+    )
 
 
 class CreditLink(NetworkLink):
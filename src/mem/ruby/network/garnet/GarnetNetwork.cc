@@ -39,6 +39,7 @@
 #include "mem/ruby/common/NetDest.hh"
 #include "mem/ruby/network/MessageBuffer.hh"
 #include "mem/ruby/network/garnet/CommonTypes.hh"
+#include "mem/ruby/network/garnet/Credit.hh"
 #include "mem/ruby/network/garnet/CreditLink.hh"
 #include "mem/ruby/network/garnet/GarnetLink.hh"
 #include "mem/ruby/network/garnet/NetworkInterface.hh"
@@ -70,6 +71,7 @@ GarnetNetwork::GarnetNetwork(const Params &p)
     m_buffers_per_data_vc = p.buffers_per_data_vc;
     m_buffers_per_ctrl_vc = p.buffers_per_ctrl_vc;
     m_routing_algorithm = p.routing_algorithm;
+    m_skip_idle_wakeups = p.skip_idle_wakeups;
     m_next_packet_id = 0;
 
     m_enable_fault_model = p.enable_fault_model;
@@ -512,6 +514,19 @@ GarnetNetwork::regStats()
     m_avg_hops.name(name() + ".average_hops");
     m_avg_hops = m_total_hops / sum(m_flits_received);
 
+    // Wakeups skipped by routers, NIs and links with nothing to do
+    m_wakeups_avoided
+        .name(name() + ".wakeups_avoided")
+        .flags(statistics::nozero);
+
+    // Object pools, counted over the whole process
+    m_flit_pool_high_water
+        .name(name() + ".flit_pool_high_water")
+        .flags(statistics::nozero);
+    m_credit_pool_high_water
+        .name(name() + ".credit_pool_high_water")
+        .flags(statistics::nozero);
+
     // Links
     m_total_ext_in_link_utilization
         .name(name() + ".ext_in_link_utilization");
@@ -574,11 +589,25 @@ GarnetNetwork::collateStats()
         for (int j = 0; j < vc_load.size(); j++) {
             m_average_vc_load[j] += ((double)vc_load[j] / time_delta);
         }
+
+        m_wakeups_avoided += m_networklinks[i]->getWakeupsAvoided();
+    }
+
+    for (int i = 0; i < m_creditlinks.size(); i++) {
+        m_wakeups_avoided += m_creditlinks[i]->getWakeupsAvoided();
+    }
+
+    for (int i = 0; i < m_nis.size(); i++) {
+        m_wakeups_avoided += m_nis[i]->getWakeupsAvoided();
     }
 
+    m_flit_pool_high_water = flit::poolUsage.highWaterMark();
+    m_credit_pool_high_water = Credit::poolUsage.highWaterMark();
+
     // Ask the routers to collate their statistics
     for (int i = 0; i < m_routers.size(); i++) {
         m_routers[i]->collateStats();
+        m_wakeups_avoided += m_routers[i]->getWakeupsAvoided();
     }
 }
 
@@ -594,6 +623,9 @@ GarnetNetwork::resetStats()
     for (int i = 0; i < m_creditlinks.size(); i++) {
         m_creditlinks[i]->resetStats();
     }
+    for (int i = 0; i < m_nis.size(); i++) {
+        m_nis[i]->resetStats();
+    }
 }
 
 void
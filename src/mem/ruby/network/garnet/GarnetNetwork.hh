@@ -82,6 +82,7 @@ class GarnetNetwork : public Network
     int getRoutingAlgorithm() const { return m_routing_algorithm; }
 
     bool isFaultModelEnabled() const { return m_enable_fault_model; }
+    bool skipIdleWakeups() const { return m_skip_idle_wakeups; }
     FaultModel* fault_model;
 
 
@@ -167,6 +168,7 @@ class GarnetNetwork : public Network
     uint32_t m_buffers_per_data_vc;
     int m_routing_algorithm;
     bool m_enable_fault_model;
+    bool m_skip_idle_wakeups;
 
     // Statistical variables
     statistics::Vector m_packets_received;
@@ -200,6 +202,13 @@ class GarnetNetwork : public Network
     statistics::Scalar  m_total_hops;
     statistics::Formula m_avg_hops;
 
+    statistics::Scalar m_wakeups_avoided;
+
+    // Most objects of the flit and credit pools live at once, over the
+    // whole process; the pools aren't owned by this network.
+    statistics::Scalar m_flit_pool_high_water;
+    statistics::Scalar m_credit_pool_high_water;
+
     std::vector<std::vector<statistics::Scalar *>> m_data_traffic_distribution;
     std::vector<std::vector<statistics::Scalar *>> m_ctrl_traffic_distribution;
 
@@ -52,6 +52,11 @@ class GarnetNetwork(RubyNetwork):
     garnet_deadlock_threshold = Param.UInt32(
         50000, "network-level deadlock threshold"
     )
+    skip_idle_wakeups = Param.Bool(
+        False,
+        "only wake routers and network interfaces that can make progress "
+        "and let links sleep until their next flit is ready",
+    )
 
 
 class GarnetNetworkInterface(ClockedObject):
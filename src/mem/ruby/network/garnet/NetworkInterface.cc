@@ -56,7 +56,8 @@ NetworkInterface::NetworkInterface(const Params &p)
     m_virtual_networks(p.virt_nets), m_vc_per_vnet(0),
     m_vc_allocator(m_virtual_networks, 0),
     m_deadlock_threshold(p.garnet_deadlock_threshold),
-    vc_busy_counter(m_virtual_networks, 0)
+    vc_busy_counter(m_virtual_networks, 0), m_quiesced_at(MaxTick),
+    m_wakeups_avoided(0)
 {
     m_stall_count.resize(m_virtual_networks);
     niOutVcs.resize(0);
@@ -198,6 +199,12 @@ NetworkInterface::wakeup()
             "woke up. Period: %ld\n", m_id, oss.str(), clockPeriod());
 
     assert(curTick() == clockEdge());
+
+    if (m_quiesced_at != MaxTick) {
+        m_wakeups_avoided += (clockEdge() - m_quiesced_at) / clockPeriod();
+        m_quiesced_at = MaxTick;
+    }
+
     MsgPtr msg_ptr;
     Tick curTime = clockEdge();
 
@@ -621,6 +628,8 @@ NetworkInterface::get_vnet(int vc)
 // output VC buffer.
 // Also check if we have to reschedule because of a clock period
 // difference.
+// With skip_idle_wakeups, output VCs without credits do not keep the NI
+// awake; the credit link wakes it when a credit comes back.
 void
 NetworkInterface::checkReschedule()
 {
@@ -635,10 +644,15 @@ NetworkInterface::checkReschedule()
         }
     }
 
-    for (auto& ni_out_vc : niOutVcs) {
-        if (ni_out_vc.isReady(clockEdge(Cycles(1)))) {
-            scheduleEvent(Cycles(1));
-            return;
+    bool blocked = false;
+    for (int vc = 0; vc < niOutVcs.size(); vc++) {
+        if (niOutVcs[vc].isReady(clockEdge(Cycles(1)))) {
+            if (!m_net_ptr->skipIdleWakeups() ||
+                outVcState[vc].has_credit()) {
+                scheduleEvent(Cycles(1));
+                return;
+            }
+            blocked = true;
         }
     }
 
@@ -660,6 +674,19 @@ NetworkInterface::checkReschedule()
             return;
         }
     }
+
+    if (blocked) {
+        // Stalled ejections are retried on every wakeup, so they still
+        // need the NI to run each cycle.
+        for (auto &iPort : inPorts) {
+            if (!iPort->m_stall_queue.empty()) {
+                scheduleEvent(Cycles(1));
+                return;
+            }
+        }
+
+        m_quiesced_at = clockEdge(Cycles(1));
+    }
 }
 
 void
@@ -82,6 +82,9 @@ class NetworkInterface : public ClockedObject, public Consumer
     bool functionalRead(Packet *pkt, WriteMask &mask);
     uint32_t functionalWrite(Packet *);
 
+    uint64_t getWakeupsAvoided() const { return m_wakeups_avoided; }
+    void resetStats() { m_wakeups_avoided = 0; }
+
     void scheduleFlit(flit *t_flit);
 
     int get_router_id(int vnet)
@@ -293,6 +296,10 @@ class NetworkInterface : public ClockedObject, public Consumer
     // When a vc stays busy for a long time, it indicates a deadlock
     std::vector<int> vc_busy_counter;
 
+    // First cycle skipped while flits wait for credits, or MaxTick
+    Tick m_quiesced_at;
+    uint64_t m_wakeups_avoided;
+
     void checkStallQueue();
     bool flitisizeMessage(MsgPtr msg_ptr, int vnet);
     int calculateVC(int vnet);
@@ -48,7 +48,8 @@ namespace garnet
 NetworkLink::NetworkLink(const Params &p)
     : ClockedObject(p), Consumer(this), m_id(p.link_id),
       m_type(NUM_LINK_TYPES_),
-      m_latency(p.link_latency), m_link_utilized(0),
+      m_latency(p.link_latency), m_skip_idle_wakeups(p.skip_idle_wakeups),
+      m_link_utilized(0), m_wakeups_avoided(0),
       m_virt_nets(p.virt_nets), linkBuffer(),
       link_consumer(nullptr), link_srcQueue(nullptr)
 {
@@ -105,7 +106,18 @@ NetworkLink::wakeup()
     }
 
     if (!link_srcQueue->isEmpty()) {
-        scheduleEvent(Cycles(1));
+        if (m_skip_idle_wakeups) {
+            // The source queue is FIFO, so nothing can leave before the
+            // flit at its head. Sleep until that flit is ready instead
+            // of polling every cycle.
+            Tick next_cycle = clockEdge(Cycles(1));
+            Tick ready = std::max(next_cycle,
+                                  link_srcQueue->peekTopFlit()->get_time());
+            m_wakeups_avoided += ticksToCycles(ready - next_cycle);
+            scheduleEventAbsolute(ready);
+        } else {
+            scheduleEvent(Cycles(1));
+        }
     }
 }
 
@@ -117,6 +129,7 @@ NetworkLink::resetStats()
     }
 
     m_link_utilized = 0;
+    m_wakeups_avoided = 0;
 }
 
 bool
@@ -71,6 +71,7 @@ class NetworkLink : public ClockedObject, public Consumer
     virtual void wakeup();
 
     unsigned int getLinkUtilization() const { return m_link_utilized; }
+    uint64_t getWakeupsAvoided() const { return m_wakeups_avoided; }
     const std::vector<unsigned int> & getVcLoad() const { return m_vc_load; }
 
     inline bool isReady(Tick curTime)
@@ -92,11 +93,13 @@ class NetworkLink : public ClockedObject, public Consumer
     const int m_id;
     link_type m_type;
     const Cycles m_latency;
+    const bool m_skip_idle_wakeups;
 
     ClockedObject *src_object;
 
     // Statistical variables
     unsigned int m_link_utilized;
+    uint64_t m_wakeups_avoided;
     std::vector<unsigned int> m_vc_load;
 
   protected:
@@ -92,6 +92,12 @@ OutputUnit::has_credit(int out_vc)
     return outVcState[out_vc].has_credit();
 }
 
+// Check if a credit from the downstream router is waiting to be read.
+bool
+OutputUnit::has_pending_credit(Tick time)
+{
+    return m_credit_link->isReady(time);
+}
 
 // Check if the output port (i.e., input port at next router) has free VCs.
 bool
@@ -67,6 +67,7 @@ class OutputUnit : public Consumer
     void decrement_credit(int out_vc);
     void increment_credit(int out_vc);
     bool has_credit(int out_vc);
+    bool has_pending_credit(Tick time);
     bool has_free_vc(int vnet);
     int select_free_vc(int vnet);
 
@@ -53,7 +53,7 @@ Router::Router(const Params &p)
     m_virtual_networks(p.virt_nets), m_vc_per_vnet(p.vcs_per_vnet),
     m_num_vcs(m_virtual_networks * m_vc_per_vnet), m_bit_width(p.width),
     m_network_ptr(nullptr), routingUnit(this), switchAllocator(this),
-    crossbarSwitch(this)
+    crossbarSwitch(this), m_quiesced_at(MaxTick), m_wakeups_avoided(0)
 {
     m_input_unit.clear();
     m_output_unit.clear();
@@ -74,6 +74,11 @@ Router::wakeup()
     DPRINTF(RubyNetwork, "Router %d woke up\n", m_id);
     assert(clockEdge() == curTick());
 
+    if (m_quiesced_at != MaxTick) {
+        m_wakeups_avoided += (clockEdge() - m_quiesced_at) / clockPeriod();
+        m_quiesced_at = MaxTick;
+    }
+
     // check for incoming flits
     for (int inport = 0; inport < m_input_unit.size(); inport++) {
         m_input_unit[inport]->wakeup();
@@ -177,6 +182,16 @@ Router::schedule_wakeup(Cycles time)
     scheduleEvent(time);
 }
 
+// Called instead of schedule_wakeup() when every buffered flit is waiting
+// on a credit or a free VC downstream. The credit link wakes the router
+// when that changes, so the cycles in between are not simulated.
+void
+Router::quiesce()
+{
+    if (m_quiesced_at == MaxTick)
+        m_quiesced_at = clockEdge(Cycles(1));
+}
+
 std::string
 Router::getPortDirectionName(PortDirection direction)
 {
@@ -243,6 +258,7 @@ Router::resetStats()
 
     crossbarSwitch.resetStats();
     switchAllocator.resetStats();
+    m_wakeups_avoided = 0;
 }
 
 void
@@ -119,6 +119,7 @@ class Router : public BasicRouter, public Consumer
     int route_compute(RouteInfo route, int inport, PortDirection direction);
     void grant_switch(int inport, flit *t_flit);
     void schedule_wakeup(Cycles time);
+    void quiesce();
 
     std::string getPortDirectionName(PortDirection direction);
     void printFaultVector(std::ostream& out);
@@ -127,6 +128,7 @@ class Router : public BasicRouter, public Consumer
     void regStats();
     void collateStats();
     void resetStats();
+    uint64_t getWakeupsAvoided() const { return m_wakeups_avoided; }
 
     // For Fault Model:
     bool get_fault_vector(int temperature, float fault_vector[]) {
@@ -155,6 +157,11 @@ class Router : public BasicRouter, public Consumer
     std::vector<std::shared_ptr<InputUnit>> m_input_unit;
     std::vector<std::shared_ptr<OutputUnit>> m_output_unit;
 
+    // First cycle the router skipped while flits were blocked, or
+    // MaxTick if it is running normally
+    Tick m_quiesced_at;
+    uint64_t m_wakeups_avoided;
+
     // Statistical variables required for power computations
     statistics::Scalar m_buffer_reads;
     statistics::Scalar m_buffer_writes;
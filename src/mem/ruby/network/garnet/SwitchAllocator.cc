@@ -353,6 +353,9 @@ SwitchAllocator::vc_allocate(int outport, int inport, int invc)
 
 // Wakeup the router next cycle to perform SA again
 // if there are flits ready.
+// With skip_idle_wakeups, flits that cannot be sent until a credit or a
+// free VC comes back do not keep the router awake; the credit link wakes
+// it when that happens.
 void
 SwitchAllocator::check_for_wakeup()
 {
@@ -362,14 +365,39 @@ SwitchAllocator::check_for_wakeup()
         return;
     }
 
+    bool skip_idle = m_router->get_net_ptr()->skipIdleWakeups();
+    bool blocked = false;
+
     for (int i = 0; i < m_num_inports; i++) {
+        auto input_unit = m_router->getInputUnit(i);
         for (int j = 0; j < m_num_vcs; j++) {
-            if (m_router->getInputUnit(i)->need_stage(j, SA_, nextCycle)) {
+            if (!input_unit->need_stage(j, SA_, nextCycle)) {
+                continue;
+            }
+
+            if (!skip_idle || send_allowed(i, j, input_unit->get_outport(j),
+                                           input_unit->get_outvc(j))) {
                 m_router->schedule_wakeup(Cycles(1));
                 return;
             }
+            blocked = true;
+        }
+    }
+
+    if (!blocked) {
+        return;
+    }
+
+    // Credits that arrived together are read one per cycle by the
+    // OutputUnit itself; keep the router in step with them.
+    for (int o = 0; o < m_num_outports; o++) {
+        if (m_router->getOutputUnit(o)->has_pending_credit(nextCycle)) {
+            m_router->schedule_wakeup(Cycles(1));
+            return;
         }
     }
+
+    m_router->quiesce();
 }
 
 int
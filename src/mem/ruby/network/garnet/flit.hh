@@ -35,6 +35,7 @@
 #include <iostream>
 
 #include "base/types.hh"
+#include "mem/mem_pool.hh"
 #include "mem/ruby/network/garnet/CommonTypes.hh"
 #include "mem/ruby/slicc_interface/Message.hh"
 
@@ -56,6 +57,23 @@ class flit
 
     virtual ~flit(){};
 
+    /** Usage of the memory pool by flits, not counting credits. */
+    static inline PoolUsage poolUsage;
+
+    // Flits are created and destroyed at every NI and SerDes unit, so
+    // recycle their storage instead of going to the heap each time.
+    static void *
+    operator new(std::size_t size)
+    {
+        return MemPool::allocate(size, &poolUsage);
+    }
+
+    static void
+    operator delete(void *p, std::size_t size)
+    {
+        MemPool::deallocate(p, size, &poolUsage);
+    }
+
     int get_outport() {return m_outport; }
     int get_size() { return m_size; }
     Tick get_enqueue_time() { return m_enqueue_time; }
@@ -120,7 +120,10 @@ ProfilerStats::ProfilerStats(statistics::Group *parent, Profiler *profiler)
       ADD_STAT(m_latencyHistCoalsr, ""),
       ADD_STAT(m_hitLatencyHistSeqr, ""),
       ADD_STAT(m_missLatencyHistSeqr, ""),
-      ADD_STAT(m_missLatencyHistCoalsr, "")
+      ADD_STAT(m_missLatencyHistCoalsr, ""),
+      ADD_STAT(m_msgPoolHighWater, statistics::units::Count::get(),
+               "Most protocol messages allocated at once, over the whole "
+               "process")
 {
     delayHistogram
         .init(10)
@@ -370,6 +373,8 @@ PerRequestTypeMachineTypeStats(statistics::Group *parent)
 void
 Profiler::collateStats()
 {
+    rubyProfilerStats.m_msgPoolHighWater = Message::poolUsage.highWaterMark();
+
     if (!m_all_instructions) {
         m_address_profiler_ptr->collateStats();
     }
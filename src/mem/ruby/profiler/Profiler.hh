@@ -187,6 +187,10 @@ class Profiler
         //! miss in the controller connected to this sequencer.
         statistics::Histogram m_missLatencyHistSeqr;
         statistics::Histogram m_missLatencyHistCoalsr;
+
+        //! Most objects of the message pool live at once, over the
+        //! whole process, so this covers every Ruby system in it.
+        statistics::Scalar m_msgPoolHighWater;
     };
 
     //added by SS
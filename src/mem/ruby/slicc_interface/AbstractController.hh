@@ -161,6 +161,14 @@ class AbstractController : public ClockedObject, public Consumer
                                  const bool& was_miss)
     { }
 
+    //! Installs a line recorded in a checkpoint trace directly into the
+    //! controller's cache, without going through the sequencer. Protocols
+    //! opt in by defining warmupInstall() in their state machine. Returning
+    //! false makes RubySystem replay the record as a timing request.
+    virtual bool warmupInstall(const Addr &addr, const RubyRequestType &type,
+                               const DataBlock &data)
+    { return false; }
+
     //! Function for collating statistics from all the controllers of this
     //! particular type. This function should only be called from the
     //! version 0 of this controller type.
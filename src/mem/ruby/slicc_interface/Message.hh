@@ -45,6 +45,7 @@
 #include <memory>
 #include <stack>
 
+#include "mem/mem_pool.hh"
 #include "mem/packet.hh"
 #include "mem/ruby/common/NetDest.hh"
 #include "mem/ruby/common/WriteMask.hh"
@@ -72,6 +73,9 @@ class Message
 
     virtual ~Message() { }
 
+    /** Usage of the memory pool by protocol messages of all types. */
+    static inline PoolUsage poolUsage;
+
     virtual MsgPtr clone() const = 0;
     virtual void print(std::ostream& out) const = 0;
 
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_STRUCTURES_INSTSEQTABLE_HH__
+#define __MEM_RUBY_STRUCTURES_INSTSEQTABLE_HH__
+
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "base/intmath.hh"
+#include "cpu/inst_seq.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * Table of in-flight instructions keyed by sequence number and kept in
+ * sequence number order in a ring buffer.
+ *
+ * Instructions normally arrive in increasing order, so an insert is an
+ * append and the i-th oldest entry is found by indexing. Slots are reused
+ * rather than freed, so containers inside T keep their capacity and a
+ * steady stream of instructions does not allocate. T must provide clear(),
+ * which is called on a slot before it is handed out again.
+ */
+template <typename T>
+class InstSeqTable
+{
+  public:
+    struct Entry
+    {
+        InstSeqNum seqNum;
+        T value;
+    };
+
+    explicit InstSeqTable(size_t capacity = 16)
+        : m_ring(size_t(1) << ceilLog2(capacity))
+    {}
+
+    size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+
+    /** @return the i-th oldest entry. */
+    Entry &at(size_t i) { return slot(i); }
+    const Entry &at(size_t i) const { return slot(i); }
+
+    /** @return the value for seq_num, or nullptr if it is not present. */
+    T *
+    find(InstSeqNum seq_num)
+    {
+        size_t i = lowerBound(seq_num);
+        if (i < m_count && slot(i).seqNum == seq_num)
+            return &slot(i).value;
+        return nullptr;
+    }
+
+    /**
+     * @return the value for seq_num, adding a cleared entry in sequence
+     * number order if it is not present.
+     */
+    T &
+    insert(InstSeqNum seq_num)
+    {
+        size_t pos = lowerBound(seq_num);
+        if (pos < m_count && slot(pos).seqNum == seq_num)
+            return slot(pos).value;
+
+        if (m_count == m_ring.size())
+            grow();
+
+        // Bubble the free slot behind the newest entry down to pos, which
+        // only happens when an instruction arrives out of order.
+        for (size_t i = m_count; i > pos; --i)
+            std::swap(slot(i), slot(i - 1));
+        m_count++;
+
+        Entry &entry = slot(pos);
+        entry.seqNum = seq_num;
+        entry.value.clear();
+        return entry.value;
+    }
+
+    /**
+     * Remove every entry for which pred(entry) returns true, visiting
+     * the entries oldest first and keeping the rest in order.
+     */
+    template <typename Pred>
+    void
+    eraseIf(Pred pred)
+    {
+        // Retiring the oldest entries, the usual case, just moves the head.
+        size_t retired = 0;
+        while (retired < m_count && pred(slot(retired)))
+            retired++;
+        m_head = (m_head + retired) & (m_ring.size() - 1);
+        m_count -= retired;
+
+        if (m_count == 0)
+            return;
+
+        // The new head already failed pred, so do not evaluate it again.
+        size_t kept = 1;
+        for (size_t i = 1; i < m_count; ++i) {
+            if (!pred(slot(i))) {
+                if (kept != i)
+                    std::swap(slot(kept), slot(i));
+                kept++;
+            }
+        }
+        m_count = kept;
+    }
+
+  private:
+    Entry &
+    slot(size_t i)
+    {
+        return m_ring[(m_head + i) & (m_ring.size() - 1)];
+    }
+
+    const Entry &
+    slot(size_t i) const
+    {
+        return m_ring[(m_head + i) & (m_ring.size() - 1)];
+    }
+
+    /** @return the index of the first entry not older than seq_num. */
+    size_t
+    lowerBound(InstSeqNum seq_num) const
+    {
+        // Fast path for the common case of touching the newest entry or
+        // appending a new one.
+        if (m_count == 0 || slot(m_count - 1).seqNum < seq_num)
+            return m_count;
+        if (slot(m_count - 1).seqNum == seq_num)
+            return m_count - 1;
+
+        size_t lo = 0, hi = m_count - 1;
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            if (slot(mid).seqNum < seq_num)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    void
+    grow()
+    {
+        std::vector<Entry> ring(m_ring.size() * 2);
+        for (size_t i = 0; i < m_ring.size(); ++i)
+            std::swap(ring[i], slot(i));
+        m_ring.swap(ring);
+        m_head = 0;
+    }
+
+    std::vector<Entry> m_ring;
+    size_t m_head = 0;
+    size_t m_count = 0;
+};
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_STRUCTURES_INSTSEQTABLE_HH__
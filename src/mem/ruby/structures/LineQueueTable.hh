@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_STRUCTURES_LINEQUEUETABLE_HH__
+#define __MEM_RUBY_STRUCTURES_LINEQUEUETABLE_HH__
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include "base/intmath.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * Maps a line address to a FIFO of requests for that line.
+ *
+ * The table is open addressed with linear probing, and each slot holds
+ * the head and tail of an intrusive queue linked through T::getNext() and
+ * T::setNext(), so neither adding a line nor queueing behind it allocates.
+ * The table only grows, and is sized for at most half of its slots in use.
+ */
+template <typename T>
+class LineQueueTable
+{
+  public:
+    explicit LineQueueTable(size_t capacity = 64)
+    {
+        resize(size_t(1) << ceilLog2(capacity * 2));
+    }
+
+    /** @return the number of lines with queued requests. */
+    size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+
+    /** @return the oldest request for line, or nullptr. */
+    T *
+    front(Addr line) const
+    {
+        const Slot *slot = lookup(line);
+        return slot ? slot->head : nullptr;
+    }
+
+    /** @return the oldest request for line satisfying pred, or nullptr. */
+    template <typename Pred>
+    T *
+    findIf(Addr line, Pred pred) const
+    {
+        const Slot *slot = lookup(line);
+        for (T *t = slot ? slot->head : nullptr; t; t = t->getNext()) {
+            if (pred(t))
+                return t;
+        }
+        return nullptr;
+    }
+
+    /** Queue t behind any other requests for line. */
+    void
+    push(Addr line, T *t)
+    {
+        t->setNext(nullptr);
+        Slot *slot = lookup(line);
+        if (slot) {
+            slot->tail->setNext(t);
+            slot->tail = t;
+            return;
+        }
+
+        if ((m_count + 1) * 2 > m_slots.size())
+            resize(m_slots.size() * 2);
+
+        size_t i = home(line);
+        while (m_slots[i].head)
+            i = (i + 1) & m_mask;
+        m_slots[i] = Slot{line, t, t};
+        m_count++;
+    }
+
+    /**
+     * Remove the oldest request for line.
+     * @return the request now at the front, or nullptr if none is left.
+     */
+    T *
+    pop(Addr line)
+    {
+        Slot *slot = lookup(line);
+        assert(slot);
+        T *next = slot->head->getNext();
+        if (next) {
+            slot->head = next;
+            return next;
+        }
+        erase(slot - m_slots.data());
+        return nullptr;
+    }
+
+    /** Call f(line, request) for every queued request. */
+    template <typename F>
+    void
+    forEach(F f) const
+    {
+        for (const Slot &slot : m_slots) {
+            for (T *t = slot.head; t; t = t->getNext())
+                f(slot.line, t);
+        }
+    }
+
+  private:
+    struct Slot
+    {
+        Addr line;
+        T *head;
+        T *tail;
+    };
+
+    size_t
+    home(Addr line) const
+    {
+        // Fibonacci hashing; the top bits mix in the whole address.
+        return (line * 0x9e3779b97f4a7c15ULL) >> m_shift;
+    }
+
+    Slot *
+    lookup(Addr line)
+    {
+        for (size_t i = home(line); m_slots[i].head; i = (i + 1) & m_mask) {
+            if (m_slots[i].line == line)
+                return &m_slots[i];
+        }
+        return nullptr;
+    }
+
+    const Slot *
+    lookup(Addr line) const
+    {
+        return const_cast<LineQueueTable *>(this)->lookup(line);
+    }
+
+    /** Empty slot i, moving later members of its probe run back. */
+    void
+    erase(size_t i)
+    {
+        for (size_t j = (i + 1) & m_mask; m_slots[j].head;
+             j = (j + 1) & m_mask) {
+            // The entry at j can fill the hole at i unless its home lies
+            // cyclically in (i, j].
+            size_t k = home(m_slots[j].line);
+            if (((j - k) & m_mask) >= ((j - i) & m_mask)) {
+                m_slots[i] = m_slots[j];
+                i = j;
+            }
+        }
+        m_slots[i] = Slot{0, nullptr, nullptr};
+        m_count--;
+    }
+
+    void
+    resize(size_t num_slots)
+    {
+        std::vector<Slot> old(num_slots, Slot{0, nullptr, nullptr});
+        old.swap(m_slots);
+        m_mask = num_slots - 1;
+        m_shift = 64 - floorLog2(num_slots);
+        for (const Slot &slot : old) {
+            if (!slot.head)
+                continue;
+            size_t i = home(slot.line);
+            while (m_slots[i].head)
+                i = (i + 1) & m_mask;
+            m_slots[i] = slot;
+        }
+    }
+
+    std::vector<Slot> m_slots;
+    size_t m_count = 0;
+    size_t m_mask = 0;
+    int m_shift = 0;
+};
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_STRUCTURES_LINEQUEUETABLE_HH__
@@ -40,6 +40,10 @@ class RubyCache(SimObject):
     replacement_policy = Param.BaseReplacementPolicy(TreePLRURP(), "")
     start_index_bit = Param.Int(6, "index start, default 6 for 64-byte line")
     is_icache = Param.Bool(False, "is instruction only cache")
+    flat_tags = Param.Bool(
+        False,
+        "index tags with a flat set-major array instead of a hash map",
+    )
     block_size = Param.MemorySize(
         "0B", "block size in bytes. 0 means default RubyBlockSize"
     )
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_STRUCTURES_TAGINDEX_HH__
+#define __MEM_RUBY_STRUCTURES_TAGINDEX_HH__
+
+#include <cassert>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * Maps a line address to the way holding it in a set-associative Ruby
+ * cache.
+ *
+ * The default hashed index is a single unordered_map from address to way.
+ * The flat index instead keeps one tag per way in a contiguous, set-major
+ * array, so a lookup touches a single cache line or two and the compare
+ * loop over the ways is vectorised by the compiler.
+ */
+class TagIndex
+{
+  public:
+    void
+    init(int num_sets, int assoc, bool flat)
+    {
+        m_assoc = assoc;
+        m_flat = flat;
+        if (m_flat)
+            m_tags.assign(size_t(num_sets) * assoc, InvalidTag);
+    }
+
+    /** @return the way holding tag in set, or -1. */
+    int
+    find(int64_t set, Addr tag) const
+    {
+        if (!m_flat) {
+            auto it = m_index.find(tag);
+            return it == m_index.end() ? -1 : it->second;
+        }
+
+        // Tags are unique within a set, so keeping the last match is the
+        // same as returning the first one, and lets the loop vectorise.
+        const Addr *tags = &m_tags[set * m_assoc];
+        int way = -1;
+        for (int i = 0; i < m_assoc; i++) {
+            if (tags[i] == tag)
+                way = i;
+        }
+        return way;
+    }
+
+    void
+    insert(int64_t set, int way, Addr tag)
+    {
+        if (m_flat)
+            m_tags[set * m_assoc + way] = tag;
+        else
+            m_index[tag] = way;
+    }
+
+    void
+    erase(int64_t set, int way, Addr tag)
+    {
+        if (m_flat) {
+            assert(m_tags[set * m_assoc + way] == tag);
+            m_tags[set * m_assoc + way] = InvalidTag;
+        } else {
+            m_index.erase(tag);
+        }
+    }
+
+  private:
+    /** Line addresses have their offset bits clear, so never match. */
+    static constexpr Addr InvalidTag = ~Addr(0);
+
+    int m_assoc = 0;
+    bool m_flat = false;
+    std::unordered_map<Addr, int> m_index;
+    std::vector<Addr> m_tags;
+};
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_STRUCTURES_TAGINDEX_HH__
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Micro-benchmark comparing the tree-based tables the GPUCoalescer used to
+ * keep in-flight instructions and coalesced requests in with the
+ * InstSeqTable and LineQueueTable it uses now.
+ *
+ * Each instruction brings one packet per lane. Its packets are merged into
+ * one request per line, requests for a line already outstanding queue
+ * behind it, and the oldest outstanding line completes whenever the
+ * request limit is reached. Both versions must retire the same requests
+ * in the same order.
+ *
+ * usage: coalescertime [instructions] [lines_per_inst] [max_outstanding]
+ */
+
+#include <chrono>
+#include <deque>
+#include <list>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "mem/ruby/structures/InstSeqTable.hh"
+#include "mem/ruby/structures/LineQueueTable.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+namespace
+{
+
+const int LineBits = 6;
+const int Lanes = 64;
+
+struct Inst
+{
+    InstSeqNum seqNum;
+    std::vector<Addr> lanes;
+};
+
+std::vector<Inst>
+makeStream(int num_insts, int lines_per_inst)
+{
+    std::vector<Inst> stream(num_insts);
+    std::mt19937_64 rng(1);
+    std::uniform_int_distribution<Addr> line(0, 4096);
+    for (int i = 0; i < num_insts; ++i) {
+        stream[i].seqNum = i + 1;
+        std::vector<Addr> lines(lines_per_inst);
+        for (auto &l : lines)
+            l = line(rng) << LineBits;
+        for (int lane = 0; lane < Lanes; ++lane) {
+            stream[i].lanes.push_back(lines[lane % lines_per_inst] +
+                                      (lane * 4) % (1 << LineBits));
+        }
+    }
+    return stream;
+}
+
+struct Request
+{
+    InstSeqNum seqNum = 0;
+    std::vector<Addr> pkts;
+    Request *next = nullptr;
+
+    Request *getNext() const { return next; }
+    void setNext(Request *n) { next = n; }
+};
+
+struct Result
+{
+    uint64_t checksum = 0;
+    double seconds = 0;
+};
+
+void
+retire(uint64_t &checksum, Addr line, const Request *req)
+{
+    checksum = checksum * 31 + (line ^ req->seqNum) + req->pkts.size();
+}
+
+Result
+runTrees(const std::vector<Inst> &stream, size_t max_outstanding)
+{
+    std::map<InstSeqNum, std::list<Addr>> inst_map;
+    std::map<Addr, std::deque<Request*>> table;
+    std::deque<Addr> issued;
+    size_t outstanding = 0;
+
+    Result result;
+    const auto start = std::chrono::steady_clock::now();
+    for (const Inst &inst : stream) {
+        for (Addr addr : inst.lanes)
+            inst_map[inst.seqNum].push_back(addr);
+
+        auto &pkts = inst_map.begin()->second;
+        InstSeqNum seq_num = inst_map.begin()->first;
+        for (Addr addr : pkts) {
+            Addr line = addr >> LineBits << LineBits;
+            Request *found = nullptr;
+            if (table.count(line)) {
+                for (Request *r : table.at(line)) {
+                    if (r->seqNum == seq_num)
+                        found = r;
+                }
+            }
+            if (!found) {
+                found = new Request;
+                found->seqNum = seq_num;
+                if (!table.count(line))
+                    issued.push_back(line);
+                table[line].push_back(found);
+                outstanding++;
+            }
+            found->pkts.push_back(addr);
+        }
+        inst_map.erase(inst_map.begin());
+
+        while (outstanding > max_outstanding) {
+            Addr line = issued.front();
+            issued.pop_front();
+            Request *req = table.at(line).front();
+            retire(result.checksum, line, req);
+            delete req;
+            outstanding--;
+            table.at(line).pop_front();
+            if (table.at(line).empty())
+                table.erase(line);
+            else
+                issued.push_back(line);
+        }
+    }
+    result.seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    for (auto &entry : table) {
+        for (Request *req : entry.second)
+            delete req;
+    }
+    return result;
+}
+
+struct PerInst
+{
+    std::vector<Addr> pkts;
+    void clear() { pkts.clear(); }
+};
+
+Result
+runFlat(const std::vector<Inst> &stream, size_t max_outstanding)
+{
+    InstSeqTable<PerInst> inst_map;
+    LineQueueTable<Request> table;
+    std::vector<Request*> free_list;
+    std::deque<Addr> issued;
+    size_t outstanding = 0;
+
+    Result result;
+    const auto start = std::chrono::steady_clock::now();
+    for (const Inst &inst : stream) {
+        PerInst &entry = inst_map.insert(inst.seqNum);
+        for (Addr addr : inst.lanes)
+            entry.pkts.push_back(addr);
+
+        auto &oldest = inst_map.at(0);
+        InstSeqNum seq_num = oldest.seqNum;
+        for (Addr addr : oldest.value.pkts) {
+            Addr line = addr >> LineBits << LineBits;
+            Request *found = table.findIf(line,
+                [&](Request *r) { return r->seqNum == seq_num; });
+            if (!found) {
+                if (free_list.empty()) {
+                    found = new Request;
+                } else {
+                    found = free_list.back();
+                    free_list.pop_back();
+                    found->pkts.clear();
+                }
+                found->seqNum = seq_num;
+                if (!table.front(line))
+                    issued.push_back(line);
+                table.push(line, found);
+                outstanding++;
+            }
+            found->pkts.push_back(addr);
+        }
+        inst_map.eraseIf([&](auto &e) { return e.seqNum == seq_num; });
+
+        while (outstanding > max_outstanding) {
+            Addr line = issued.front();
+            issued.pop_front();
+            Request *req = table.front(line);
+            retire(result.checksum, line, req);
+            outstanding--;
+            if (table.pop(line))
+                issued.push_back(line);
+            free_list.push_back(req);
+        }
+    }
+    result.seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    table.forEach([&](Addr, Request *req) { free_list.push_back(req); });
+    for (Request *req : free_list)
+        delete req;
+    return result;
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char *argv[])
+{
+    const int num_insts = argc > 1 ? std::stoi(argv[1]) : 1000000;
+    const int lines_per_inst = argc > 2 ? std::stoi(argv[2]) : 4;
+    const int max_outstanding = argc > 3 ? std::stoi(argv[3]) : 256;
+
+    if (num_insts <= 0 || lines_per_inst <= 0 || lines_per_inst > Lanes ||
+        max_outstanding <= 0) {
+        cprintf("usage: %s [instructions] [lines_per_inst] "
+                "[max_outstanding]\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<Inst> stream = makeStream(num_insts, lines_per_inst);
+    Result trees = runTrees(stream, max_outstanding);
+    Result flat = runFlat(stream, max_outstanding);
+    if (trees.checksum != flat.checksum) {
+        cprintf("mismatch: the tables retired requests differently\n");
+        return 1;
+    }
+
+    cprintf("%d instructions, %d lines each, %d outstanding\n",
+            num_insts, lines_per_inst, max_outstanding);
+    cprintf("trees %.0f insts/s, flat %.0f insts/s (%.2fx)\n",
+            num_insts / trees.seconds, num_insts / flat.seconds,
+            trees.seconds / flat.seconds);
+    return 0;
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Micro-benchmark comparing the hashed and flat TagIndex used by Ruby's
+ * CacheMemory.
+ *
+ * Replays a recorded stream of line addresses through a set-associative
+ * cache model (LRU, allocate on miss) once per index type. Any text file
+ * works as a stream: the first hex number on each line is taken as the
+ * address, so the output of --debug-flags=RubyCache can be fed in as is.
+ * Without a file, a synthetic stream with a hot working set and a
+ * streaming component is used.
+ *
+ * usage: tagindextime [trace] [size_kB] [assoc]
+ */
+
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "mem/ruby/structures/TagIndex.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+namespace
+{
+
+const int LineBits = 6;
+
+std::vector<Addr>
+readTrace(const char *path)
+{
+    std::vector<Addr> stream;
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        auto pos = line.find("0x");
+        if (pos == std::string::npos)
+            continue;
+        Addr addr = std::stoull(line.substr(pos), nullptr, 16);
+        stream.push_back(addr >> LineBits << LineBits);
+    }
+    return stream;
+}
+
+std::vector<Addr>
+syntheticTrace()
+{
+    std::vector<Addr> stream;
+    std::mt19937_64 rng(1);
+    std::uniform_int_distribution<Addr> hot(0, (8 << 20) >> LineBits);
+    Addr streaming = 1ULL << 32;
+    for (int i = 0; i < 4000000; ++i) {
+        if (i % 4 == 0) {
+            stream.push_back(streaming);
+            streaming += 1 << LineBits;
+        } else {
+            stream.push_back(hot(rng) << LineBits);
+        }
+    }
+    return stream;
+}
+
+struct Result
+{
+    uint64_t hits = 0;
+    double seconds = 0;
+};
+
+Result
+replay(const std::vector<Addr> &stream, int sets, int assoc, bool flat)
+{
+    TagIndex index;
+    index.init(sets, assoc, flat);
+    std::vector<Addr> tags(size_t(sets) * assoc, 0);
+    std::vector<bool> valid(size_t(sets) * assoc, false);
+    std::vector<uint64_t> last_use(size_t(sets) * assoc, 0);
+
+    Result result;
+    const auto start = std::chrono::steady_clock::now();
+    uint64_t now = 0;
+    for (Addr addr : stream) {
+        int64_t set = (addr >> LineBits) & (sets - 1);
+        size_t base = size_t(set) * assoc;
+        int way = index.find(set, addr);
+        if (way == -1) {
+            way = 0;
+            for (int i = 0; i < assoc; ++i) {
+                if (!valid[base + i]) {
+                    way = i;
+                    break;
+                }
+                if (last_use[base + i] < last_use[base + way])
+                    way = i;
+            }
+            if (valid[base + way])
+                index.erase(set, way, tags[base + way]);
+            index.insert(set, way, addr);
+            tags[base + way] = addr;
+            valid[base + way] = true;
+        } else {
+            result.hits++;
+        }
+        last_use[base + way] = ++now;
+    }
+    result.seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char *argv[])
+{
+    std::vector<Addr> stream =
+        argc > 1 ? readTrace(argv[1]) : syntheticTrace();
+    const int size_kb = argc > 2 ? std::stoi(argv[2]) : 4096;
+    const int assoc = argc > 3 ? std::stoi(argv[3]) : 16;
+    const int sets = (size_kb << 10) / assoc >> LineBits;
+
+    if (stream.empty() || sets <= 0 || (sets & (sets - 1))) {
+        cprintf("usage: %s [trace] [size_kB] [assoc]\n", argv[0]);
+        return 1;
+    }
+
+    Result hashed = replay(stream, sets, assoc, false);
+    Result flat = replay(stream, sets, assoc, true);
+    if (hashed.hits != flat.hits) {
+        cprintf("mismatch: hashed %d hits, flat %d hits\n",
+                hashed.hits, flat.hits);
+        return 1;
+    }
+
+    cprintf("%d accesses, %d sets x %d ways, %d hits\n",
+            stream.size(), sets, assoc, hashed.hits);
+    cprintf("hashed %.0f accesses/s, flat %.0f accesses/s (%.2fx)\n",
+            stream.size() / hashed.seconds, stream.size() / flat.seconds,
+            hashed.seconds / flat.seconds);
+    return 0;
+}
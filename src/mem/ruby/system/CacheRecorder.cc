@@ -29,8 +29,16 @@
 
 #include "mem/ruby/system/CacheRecorder.hh"
 
+#include <fcntl.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "base/byteswap.hh"
 #include "debug/RubyCacheTrace.hh"
 #include "mem/packet.hh"
+#include "mem/ruby/slicc_interface/AbstractController.hh"
 #include "mem/ruby/system/RubySystem.hh"
 #include "mem/ruby/system/Sequencer.hh"
 #include "sim/sim_exit.hh"
@@ -49,44 +57,224 @@ TraceRecord::print(std::ostream& out) const
         << m_type << ", Time: " << m_time << "]";
 }
 
+namespace
+{
+
+// Header of the trace files written by CacheRecorder::writeTrace(). Traces
+// without it are raw arrays of TraceRecord and are treated as version 1.
+const char traceMagic[8] = {'R', 'U', 'B', 'Y', 'T', 'R', 'C', 0};
+const uint32_t traceVersion = 2;
+
+struct TraceHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t blockSize;
+    uint64_t numRecords;
+};
+
+// Flag in the type byte of a record marking a block of zeroes, whose data
+// is not stored in the trace.
+const uint8_t zeroBlockFlag = 0x80;
+
+void
+putVarint(std::vector<uint8_t> &buf, uint64_t val)
+{
+    while (val >= 0x80) {
+        buf.push_back(uint8_t(val) | 0x80);
+        val >>= 7;
+    }
+    buf.push_back(uint8_t(val));
+}
+
+bool
+getVarint(gzFile file, uint64_t &val)
+{
+    val = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        int c = gzgetc(file);
+        if (c < 0)
+            return false;
+        val |= uint64_t(c & 0x7f) << shift;
+        if (!(c & 0x80))
+            return true;
+    }
+    return false;
+}
+
+} // anonymous namespace
+
 CacheRecorder::CacheRecorder()
-    : m_uncompressed_trace(NULL),
-      m_uncompressed_trace_size(0),
-      m_block_size_bytes(RubySystem::getBlockSizeBytes())
+    : m_records_read(0), m_records_flushed(0),
+      m_block_size_bytes(RubySystem::getBlockSizeBytes()),
+      m_trace(NULL), m_trace_version(0), m_trace_num_records(0),
+      m_trace_last_address(0), m_trace_record(NULL)
 {
 }
 
-CacheRecorder::CacheRecorder(uint8_t* uncompressed_trace,
-                             uint64_t uncompressed_trace_size,
-                             std::vector<RubyPort*>& ruby_port_map,
+CacheRecorder::CacheRecorder(std::vector<RubyPort*>& ruby_port_map,
                              uint64_t block_size_bytes)
-    : m_uncompressed_trace(uncompressed_trace),
-      m_uncompressed_trace_size(uncompressed_trace_size),
-      m_ruby_port_map(ruby_port_map), m_bytes_read(0),
+    : m_ruby_port_map(ruby_port_map),
       m_records_read(0), m_records_flushed(0),
-      m_block_size_bytes(block_size_bytes)
-
+      m_block_size_bytes(block_size_bytes),
+      m_trace(NULL), m_trace_version(0), m_trace_num_records(0),
+      m_trace_last_address(0), m_trace_record(NULL)
 {
-    if (m_uncompressed_trace != NULL) {
-        if (m_block_size_bytes < RubySystem::getBlockSizeBytes()) {
-            // Block sizes larger than when the trace was recorded are not
-            // supported, as we cannot reliably turn accesses to smaller blocks
-            // into larger ones.
-            panic("Recorded cache block size (%d) < current block size (%d) !!",
-                    m_block_size_bytes, RubySystem::getBlockSizeBytes());
-        }
-    }
 }
 
 CacheRecorder::~CacheRecorder()
 {
-    if (m_uncompressed_trace != NULL) {
-        delete [] m_uncompressed_trace;
-        m_uncompressed_trace = NULL;
+    closeTrace();
+    for (auto rec : m_records) {
+        free(rec);
     }
+    m_records.clear();
     m_ruby_port_map.clear();
 }
 
+void
+CacheRecorder::openTrace(const std::string &filename)
+{
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        perror("open");
+        fatal("Unable to open trace file %s", filename);
+    }
+
+    m_trace = gzdopen(fd, "rb");
+    if (m_trace == NULL) {
+        fatal("Insufficient memory to allocate compression state for %s\n",
+              filename);
+    }
+
+    TraceHeader header;
+    int bytes = gzread(m_trace, &header, sizeof(header));
+    if (bytes == sizeof(header) &&
+        memcmp(header.magic, traceMagic, sizeof(traceMagic)) == 0) {
+        m_trace_version = letoh(header.version);
+        fatal_if(m_trace_version != traceVersion,
+                 "Unsupported cache trace version %d in %s\n",
+                 m_trace_version, filename);
+        fatal_if(letoh(header.blockSize) != m_block_size_bytes,
+                 "Cache trace %s was recorded with %d byte blocks but the "
+                 "checkpoint says %d\n", filename, letoh(header.blockSize),
+                 m_block_size_bytes);
+        m_trace_num_records = letoh(header.numRecords);
+    } else {
+        // No header, so this is a raw array of TraceRecord.
+        m_trace_version = 1;
+        m_trace_num_records = 0;
+        gzrewind(m_trace);
+    }
+
+    if (m_block_size_bytes < RubySystem::getBlockSizeBytes()) {
+        // Block sizes larger than when the trace was recorded are not
+        // supported, as we cannot reliably turn accesses to smaller blocks
+        // into larger ones.
+        panic("Recorded cache block size (%d) < current block size (%d) !!",
+                m_block_size_bytes, RubySystem::getBlockSizeBytes());
+    }
+
+    m_trace_record = (TraceRecord*)malloc(sizeof(TraceRecord) +
+                                          m_block_size_bytes);
+    m_trace_last_address = 0;
+    m_records_read = 0;
+}
+
+void
+CacheRecorder::closeTrace()
+{
+    if (m_trace != NULL) {
+        gzclose(m_trace);
+        m_trace = NULL;
+    }
+    free(m_trace_record);
+    m_trace_record = NULL;
+}
+
+bool
+CacheRecorder::readTraceRecord()
+{
+    TraceRecord *rec = m_trace_record;
+
+    if (m_trace_version == 1) {
+        int size = sizeof(TraceRecord) + m_block_size_bytes;
+        int bytes = gzread(m_trace, rec, size);
+        if (bytes == 0)
+            return false;
+        fatal_if(bytes != size, "Truncated record in cache trace\n");
+        return true;
+    }
+
+    if (m_records_read == m_trace_num_records)
+        return false;
+
+    uint64_t cntrl, delta;
+    int type = -1;
+    bool ok = getVarint(m_trace, cntrl);
+    if (ok)
+        type = gzgetc(m_trace);
+    ok = ok && type >= 0 && getVarint(m_trace, delta);
+    fatal_if(!ok, "Truncated record in cache trace\n");
+
+    // Addresses are stored as the zigzag-encoded distance in blocks from
+    // the previous record.
+    int64_t blocks = (delta >> 1) ^ -int64_t(delta & 1);
+    m_trace_last_address += blocks * int64_t(m_block_size_bytes);
+
+    rec->m_cntrl_id = cntrl;
+    rec->m_time = 0;
+    rec->m_data_address = m_trace_last_address;
+    rec->m_pc_address = 0;
+    rec->m_type = RubyRequestType(type & ~zeroBlockFlag);
+    if (type & zeroBlockFlag) {
+        memset(rec->m_data, 0, m_block_size_bytes);
+    } else if (gzread(m_trace, rec->m_data, m_block_size_bytes) !=
+               int(m_block_size_bytes)) {
+        fatal("Truncated record in cache trace\n");
+    }
+    return true;
+}
+
+uint64_t
+CacheRecorder::installRecords(std::vector<AbstractController*>& cntrls)
+{
+    assert(m_trace != NULL);
+    bool same_block_size =
+        m_block_size_bytes == RubySystem::getBlockSizeBytes();
+
+    uint64_t installed = 0;
+    DataBlock data;
+    while (readTraceRecord()) {
+        TraceRecord *rec = m_trace_record;
+        m_records_read++;
+        assert(rec->m_cntrl_id < cntrls.size());
+
+        if (same_block_size) {
+            data.setData(rec->m_data, 0, m_block_size_bytes);
+            if (cntrls[rec->m_cntrl_id]->warmupInstall(rec->m_data_address,
+                                                       rec->m_type, data)) {
+                DPRINTF(RubyCacheTrace, "Installed %s\n", *rec);
+                installed++;
+                continue;
+            }
+        }
+
+        // Keep the record around to be replayed as a timing request.
+        int size = sizeof(TraceRecord) + m_block_size_bytes;
+        TraceRecord *copy = (TraceRecord*)malloc(size);
+        memcpy(copy, rec, size);
+        m_records.push_back(copy);
+    }
+
+    DPRINTF(RubyCacheTrace, "Installed %d of %d records, %d left to "
+            "replay\n", installed, m_records_read, m_records.size());
+
+    closeTrace();
+    m_records_read = 0;
+    return installed;
+}
+
 void
 CacheRecorder::enqueueNextFlushRequest()
 {
@@ -118,10 +306,17 @@ CacheRecorder::enqueueNextFlushRequest()
 void
 CacheRecorder::enqueueNextFetchRequest()
 {
-    if (m_bytes_read < m_uncompressed_trace_size) {
-        TraceRecord* traceRecord = (TraceRecord*) (m_uncompressed_trace +
-                                                                m_bytes_read);
+    // Records come from the trace file unless installRecords() has already
+    // consumed it, in which case only the records it left are replayed.
+    TraceRecord* traceRecord = NULL;
+    if (m_trace != NULL) {
+        if (readTraceRecord())
+            traceRecord = m_trace_record;
+    } else if (m_records_read < m_records.size()) {
+        traceRecord = m_records[m_records_read];
+    }
 
+    if (traceRecord != NULL) {
         DPRINTF(RubyCacheTrace, "Issuing %s\n", *traceRecord);
 
         for (int rec_bytes_read = 0; rec_bytes_read < m_block_size_bytes;
@@ -149,8 +344,13 @@ CacheRecorder::enqueueNextFetchRequest()
                                 Request::funcRequestorId);
             }
 
+            // The record buffer is reused for the next record, so the
+            // packet gets its own copy of the data.
             Packet *pkt = new Packet(req, requestType);
-            pkt->dataStatic(traceRecord->m_data + rec_bytes_read);
+            pkt->allocate();
+            memcpy(pkt->getPtr<uint8_t>(),
+                   traceRecord->m_data + rec_bytes_read,
+                   RubySystem::getBlockSizeBytes());
             pkt->req->setReqInstSeqNum(m_records_read);
 
 
@@ -160,7 +360,6 @@ CacheRecorder::enqueueNextFetchRequest()
             m_ruby_port_ptr->makeRequest(pkt);
         }
 
-        m_bytes_read += (sizeof(TraceRecord) + m_block_size_bytes);
         m_records_read++;
     } else {
         exitSimLoop("Finished Warmup", 0);
@@ -187,40 +386,63 @@ CacheRecorder::addRecord(int cntrl, Addr data_addr, Addr pc_addr,
     m_records.push_back(rec);
 }
 
-uint64_t
-CacheRecorder::aggregateRecords(uint8_t **buf, uint64_t total_size)
+void
+CacheRecorder::writeTrace(const std::string &filename)
 {
     std::sort(m_records.begin(), m_records.end(), compareTraceRecords);
 
-    int size = m_records.size();
-    uint64_t current_size = 0;
-    int record_size = sizeof(TraceRecord) + m_block_size_bytes;
-
-    for (int i = 0; i < size; ++i) {
-        // Determine if we need to expand the buffer size
-        if (current_size + record_size > total_size) {
-            uint8_t* new_buf = new (std::nothrow) uint8_t[total_size * 2];
-            if (new_buf == NULL) {
-                fatal("Unable to allocate buffer of size %s\n",
-                      total_size * 2);
-            }
-            total_size = total_size * 2;
-            uint8_t* old_buf = *buf;
-            memcpy(new_buf, old_buf, current_size);
-            *buf = new_buf;
-            delete [] old_buf;
+    int fd = creat(filename.c_str(), 0664);
+    if (fd < 0) {
+        perror("creat");
+        fatal("Can't open memory trace file '%s'\n", filename);
+    }
+
+    gzFile trace = gzdopen(fd, "wb");
+    if (trace == NULL)
+        fatal("Insufficient memory to allocate compression state for %s\n",
+              filename);
+
+    TraceHeader header;
+    memcpy(header.magic, traceMagic, sizeof(traceMagic));
+    header.version = htole(traceVersion);
+    header.blockSize = htole(uint32_t(m_block_size_bytes));
+    header.numRecords = htole(uint64_t(m_records.size()));
+
+    std::vector<uint8_t> buf((uint8_t*)&header,
+                             (uint8_t*)&header + sizeof(header));
+    Addr last_address = 0;
+    for (auto &rec : m_records) {
+        bool zero = std::all_of(rec->m_data,
+                                rec->m_data + m_block_size_bytes,
+                                [](uint8_t b) { return b == 0; });
+        int64_t blocks = (int64_t(rec->m_data_address) -
+                          int64_t(last_address)) / int64_t(m_block_size_bytes);
+        last_address = rec->m_data_address;
+
+        putVarint(buf, rec->m_cntrl_id);
+        buf.push_back(uint8_t(rec->m_type) | (zero ? zeroBlockFlag : 0));
+        putVarint(buf, (uint64_t(blocks) << 1) ^ uint64_t(blocks >> 63));
+        if (!zero)
+            buf.insert(buf.end(), rec->m_data,
+                       rec->m_data + m_block_size_bytes);
+
+        free(rec);
+        rec = NULL;
+
+        if (buf.size() >= 64 * 1024) {
+            if (gzwrite(trace, buf.data(), buf.size()) != int(buf.size()))
+                fatal("Write failed on memory trace file '%s'\n", filename);
+            buf.clear();
         }
+    }
+    m_records.clear();
 
-        // Copy the current record into the buffer
-        memcpy(&((*buf)[current_size]), m_records[i], record_size);
-        current_size += record_size;
+    if (gzwrite(trace, buf.data(), buf.size()) != int(buf.size()))
+        fatal("Write failed on memory trace file '%s'\n", filename);
 
-        free(m_records[i]);
-        m_records[i] = NULL;
+    if (gzclose(trace)) {
+        fatal("Close failed on memory trace file '%s'\n", filename);
     }
-
-    m_records.clear();
-    return current_size;
 }
 
 uint64_t
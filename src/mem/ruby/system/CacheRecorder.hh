@@ -35,6 +35,9 @@
 #ifndef __MEM_RUBY_SYSTEM_CACHERECORDER_HH__
 #define __MEM_RUBY_SYSTEM_CACHERECORDER_HH__
 
+#include <zlib.h>
+
+#include <string>
 #include <vector>
 
 #include "base/types.hh"
@@ -49,8 +52,10 @@ namespace gem5
 namespace ruby
 {
 
+class AbstractController;
 class Sequencer;
 class RubyPort;
+
 /*!
  * Class for recording cache contents. Note that the last element of the
  * class is an array of length zero. It is used for creating variable
@@ -76,14 +81,35 @@ class CacheRecorder
     CacheRecorder();
     ~CacheRecorder();
 
-    CacheRecorder(uint8_t* uncompressed_trace,
-                  uint64_t uncompressed_trace_size,
-                  std::vector<RubyPort*>& ruby_port_map,
+    CacheRecorder(std::vector<RubyPort*>& ruby_port_map,
                   uint64_t block_size_bytes);
     void addRecord(int cntrl, Addr data_addr, Addr pc_addr,
                    RubyRequestType type, Tick time, DataBlock& data);
 
-    uint64_t aggregateRecords(uint8_t **data, uint64_t size);
+    /*!
+     * Write the recorded cache contents to a gzipped trace file. The
+     * trace starts with a small versioned header and stores each record
+     * as a variable-length controller id, the request type, the distance
+     * in blocks from the previous record and the block data, which is
+     * left out for all-zero blocks.
+     */
+    void writeTrace(const std::string &filename);
+
+    /*!
+     * Open a trace written by writeTrace() for warming up the caches.
+     * Records are streamed from the file as they are replayed rather
+     * than being read into memory up front. Traces written before the
+     * header was introduced are still accepted.
+     */
+    void openTrace(const std::string &filename);
+
+    /*!
+     * Install the records of the open trace directly into the caches of
+     * the controllers they were recorded from, without simulating the
+     * requests. Records the protocol cannot install are kept and left to
+     * enqueueNextFetchRequest(). Returns the number of records installed.
+     */
+    uint64_t installRecords(std::vector<AbstractController*>& cntrls);
 
     uint64_t getNumRecords() const;
 
@@ -111,14 +137,25 @@ class CacheRecorder
     CacheRecorder(const CacheRecorder& obj);
     CacheRecorder& operator=(const CacheRecorder& obj);
 
+    /*!
+     * Read the next record of the open trace into m_trace_record.
+     * Returns false once the trace is exhausted.
+     */
+    bool readTraceRecord();
+    void closeTrace();
+
     std::vector<TraceRecord*> m_records;
-    uint8_t* m_uncompressed_trace;
-    uint64_t m_uncompressed_trace_size;
     std::vector<RubyPort*> m_ruby_port_map;
-    uint64_t m_bytes_read;
     uint64_t m_records_read;
     uint64_t m_records_flushed;
     uint64_t m_block_size_bytes;
+
+    // Trace being replayed, if any, and the state needed to decode it
+    gzFile m_trace;
+    uint32_t m_trace_version;
+    uint64_t m_trace_num_records;
+    Addr m_trace_last_address;
+    TraceRecord* m_trace_record;
 };
 
 inline bool
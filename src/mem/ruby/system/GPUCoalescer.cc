@@ -31,6 +31,8 @@
 
 #include "mem/ruby/system/GPUCoalescer.hh"
 
+#include <algorithm>
+
 #include "base/compiler.hh"
 #include "base/logging.hh"
 #include "base/str.hh"
@@ -68,9 +70,10 @@ UncoalescedTable::insertPacket(PacketPtr pkt)
 {
     uint64_t seqNum = pkt->req->getReqInstSeqNum();
 
-    instMap[seqNum].push_back(pkt);
+    PerInstPackets &pkts = instMap.insert(seqNum).pkts;
+    pkts.push_back(pkt);
     DPRINTF(GPUCoalescer, "Adding 0x%X seqNum %d to map. (map %d vec %d)\n",
-            pkt->getAddr(), seqNum, instMap.size(), instMap[seqNum].size());
+            pkt->getAddr(), seqNum, instMap.size(), pkts.size());
 }
 
 void
@@ -78,7 +81,7 @@ UncoalescedTable::insertReqType(PacketPtr pkt, RubyRequestType type)
 {
     uint64_t seqNum = pkt->req->getReqInstSeqNum();
 
-    reqTypeMap[seqNum] = type;
+    instMap.insert(seqNum).reqType = type;
 }
 
 bool
@@ -90,21 +93,26 @@ UncoalescedTable::packetAvailable()
 void
 UncoalescedTable::initPacketsRemaining(InstSeqNum seqNum, int count)
 {
-    if (!instPktsRemaining.count(seqNum)) {
-        instPktsRemaining[seqNum] = count;
+    PerInstState &inst = instMap.insert(seqNum);
+    if (inst.pktsRemaining < 0) {
+        inst.pktsRemaining = count;
     }
 }
 
 int
 UncoalescedTable::getPacketsRemaining(InstSeqNum seqNum)
 {
-    return instPktsRemaining[seqNum];
+    PerInstState *inst = instMap.find(seqNum);
+    assert(inst && inst->pktsRemaining >= 0);
+    return inst->pktsRemaining;
 }
 
 void
 UncoalescedTable::setPacketsRemaining(InstSeqNum seqNum, int count)
 {
-    instPktsRemaining[seqNum] = count;
+    PerInstState *inst = instMap.find(seqNum);
+    assert(inst);
+    inst->pktsRemaining = count;
 }
 
 PerInstPackets*
@@ -114,57 +122,52 @@ UncoalescedTable::getInstPackets(int offset)
         return nullptr;
     }
 
-    auto instMapIter = instMap.begin();
-    std::advance(instMapIter, offset);
-
-    return &(instMapIter->second);
+    return &instMap.at(offset).value.pkts;
 }
 
 void
 UncoalescedTable::updateResources()
 {
-    for (auto iter = instMap.begin(); iter != instMap.end(); ) {
-        InstSeqNum seq_num = iter->first;
+    instMap.eraseIf([this](auto &entry) {
+        InstSeqNum seq_num = entry.seqNum;
+        PerInstState &inst = entry.value;
         DPRINTF(GPUCoalescer, "%s checking remaining pkts for %d\n",
                 coalescer->name().c_str(), seq_num);
-        assert(instPktsRemaining.count(seq_num));
-
-        if (instPktsRemaining[seq_num] == 0) {
-            assert(iter->second.empty());
-
-            // Remove from both maps
-            instMap.erase(iter++);
-            instPktsRemaining.erase(seq_num);
-
-            // Release the token if the Ruby system is not in cooldown
-            // or warmup phases. When in these phases, the RubyPorts
-            // are accessed directly using the makeRequest() command
-            // instead of accessing through the port. This makes
-            // sending tokens through the port unnecessary
-            if (!RubySystem::getWarmupEnabled()
-                    && !RubySystem::getCooldownEnabled()) {
-                if (reqTypeMap[seq_num] != RubyRequestType_FLUSH) {
-                    DPRINTF(GPUCoalescer,
-                            "Returning token seqNum %d\n", seq_num);
-                    coalescer->getGMTokenPort().sendTokens(1);
-                }
-            }
+        assert(inst.pktsRemaining >= 0);
 
-            reqTypeMap.erase(seq_num);
-        } else {
-            ++iter;
+        if (inst.pktsRemaining != 0) {
+            return false;
         }
-    }
+
+        assert(inst.pkts.empty());
+
+        // Release the token if the Ruby system is not in cooldown
+        // or warmup phases. When in these phases, the RubyPorts
+        // are accessed directly using the makeRequest() command
+        // instead of accessing through the port. This makes
+        // sending tokens through the port unnecessary
+        if (!RubySystem::getWarmupEnabled()
+                && !RubySystem::getCooldownEnabled()) {
+            if (inst.reqType != RubyRequestType_FLUSH) {
+                DPRINTF(GPUCoalescer,
+                        "Returning token seqNum %d\n", seq_num);
+                coalescer->getGMTokenPort().sendTokens(1);
+            }
+        }
+
+        return true;
+    });
 }
 
 bool
 UncoalescedTable::areRequestsDone(const uint64_t instSeqNum) {
-    // iterate the instructions held in UncoalescedTable to see whether there
-    // are more requests to issue; if yes, not yet done; otherwise, done
-    for (auto& inst : instMap) {
-        DPRINTF(GPUCoalescer, "instSeqNum= %d, pending packets=%d\n"
-            ,inst.first, inst.second.size());
-        if (inst.first == instSeqNum) { return false; }
+    // look up the instructions held in UncoalescedTable to see whether
+    // there are more requests to issue; if yes, not yet done; otherwise, done
+    PerInstState *inst = instMap.find(instSeqNum);
+    if (inst) {
+        DPRINTF(GPUCoalescer, "instSeqNum= %d, pending packets=%d\n",
+                instSeqNum, inst->pkts.size());
+        return false;
     }
 
     return true;
@@ -175,9 +178,10 @@ UncoalescedTable::printRequestTable(std::stringstream& ss)
 {
     ss << "Listing pending packets from " << instMap.size() << " instructions";
 
-    for (auto& inst : instMap) {
-        ss << "\tAddr: " << printAddress(inst.first) << " with "
-           << inst.second.size() << " pending packets" << std::endl;
+    for (size_t i = 0; i < instMap.size(); ++i) {
+        auto &inst = instMap.at(i);
+        ss << "\tAddr: " << printAddress(inst.seqNum) << " with "
+           << inst.value.pkts.size() << " pending packets" << std::endl;
     }
 }
 
@@ -186,8 +190,8 @@ UncoalescedTable::checkDeadlock(Tick threshold)
 {
     Tick current_time = curTick();
 
-    for (auto &it : instMap) {
-        for (auto &pkt : it.second) {
+    for (size_t i = 0; i < instMap.size(); ++i) {
+        for (auto &pkt : instMap.at(i).value.pkts) {
             if (current_time - pkt->req->time() > threshold) {
                 std::stringstream ss;
                 printRequestTable(ss);
@@ -287,6 +291,28 @@ GPUCoalescer::GPUCoalescer(const Params &p)
 
 GPUCoalescer::~GPUCoalescer()
 {
+    for (auto crequest : freeCoalescedRequests) {
+        delete crequest;
+    }
+}
+
+CoalescedRequest *
+GPUCoalescer::allocCoalescedRequest(uint64_t seqNum)
+{
+    if (freeCoalescedRequests.empty()) {
+        return new CoalescedRequest(seqNum);
+    }
+
+    CoalescedRequest *crequest = freeCoalescedRequests.back();
+    freeCoalescedRequests.pop_back();
+    crequest->reset(seqNum);
+    return crequest;
+}
+
+void
+GPUCoalescer::freeCoalescedRequest(CoalescedRequest *crequest)
+{
+    freeCoalescedRequests.push_back(crequest);
 }
 
 Port &
@@ -304,17 +330,15 @@ void
 GPUCoalescer::wakeup()
 {
     Cycles current_time = curCycle();
-    for (auto& requestList : coalescedTable) {
-        for (auto& req : requestList.second) {
-            if (current_time - req->getIssueTime() > m_deadlock_threshold) {
-                std::stringstream ss;
-                printRequestTable(ss);
-                warn("GPUCoalescer %d Possible deadlock detected!\n%s\n",
-                     m_version, ss.str());
-                panic("Aborting due to deadlock!\n");
-            }
+    coalescedTable.forEach([&](Addr line, CoalescedRequest *req) {
+        if (current_time - req->getIssueTime() > m_deadlock_threshold) {
+            std::stringstream ss;
+            printRequestTable(ss);
+            warn("GPUCoalescer %d Possible deadlock detected!\n%s\n",
+                 m_version, ss.str());
+            panic("Aborting due to deadlock!\n");
         }
-    }
+    });
 
     Tick tick_threshold = cyclesToTicks(m_deadlock_threshold);
     uncoalescedTable.checkDeadlock(tick_threshold);
@@ -332,22 +356,20 @@ GPUCoalescer::printRequestTable(std::stringstream& ss)
     ss << "Printing out " << coalescedTable.size()
        << " outstanding requests in the coalesced table\n";
 
-    for (auto& requestList : coalescedTable) {
-        for (auto& request : requestList.second) {
-            ss << "\tAddr: " << printAddress(requestList.first) << "\n"
-               << "\tInstruction sequence number: "
-               << request->getSeqNum() << "\n"
-               << "\t\tType: "
-               << RubyRequestType_to_string(request->getRubyType()) << "\n"
-               << "\t\tNumber of associated packets: "
-               << request->getPackets().size() << "\n"
-               << "\t\tIssue time: "
-               << request->getIssueTime() * clockPeriod() << "\n"
-               << "\t\tDifference from current tick: "
-               << (curCycle() - request->getIssueTime()) * clockPeriod()
-               << "\n";
-        }
-    }
+    coalescedTable.forEach([&](Addr line, CoalescedRequest *request) {
+        ss << "\tAddr: " << printAddress(line) << "\n"
+           << "\tInstruction sequence number: "
+           << request->getSeqNum() << "\n"
+           << "\t\tType: "
+           << RubyRequestType_to_string(request->getRubyType()) << "\n"
+           << "\t\tNumber of associated packets: "
+           << request->getPackets().size() << "\n"
+           << "\t\tIssue time: "
+           << request->getIssueTime() * clockPeriod() << "\n"
+           << "\t\tDifference from current tick: "
+           << (curCycle() - request->getIssueTime()) * clockPeriod()
+           << "\n";
+    });
 
     // print out packets waiting to be issued in uncoalesced table
     uncoalescedTable.printRequestTable(ss);
@@ -433,21 +455,18 @@ GPUCoalescer::writeCallback(Addr address,
                          bool isRegion)
 {
     assert(address == makeLineAddress(address));
-    assert(coalescedTable.count(address));
 
-    auto crequest = coalescedTable.at(address).front();
+    auto crequest = coalescedTable.front(address);
+    assert(crequest);
 
     hitCallback(crequest, mach, data, true, crequest->getIssueTime(),
                 forwardRequestTime, firstResponseTime, isRegion);
 
     // remove this crequest in coalescedTable
-    delete crequest;
-    coalescedTable.at(address).pop_front();
+    auto nextRequest = coalescedTable.pop(address);
+    freeCoalescedRequest(crequest);
 
-    if (coalescedTable.at(address).empty()) {
-        coalescedTable.erase(address);
-    } else {
-        auto nextRequest = coalescedTable.at(address).front();
+    if (nextRequest) {
         issueRequest(nextRequest);
     }
 }
@@ -520,21 +539,18 @@ GPUCoalescer::readCallback(Addr address,
                         bool isRegion)
 {
     assert(address == makeLineAddress(address));
-    assert(coalescedTable.count(address));
 
-    auto crequest = coalescedTable.at(address).front();
+    auto crequest = coalescedTable.front(address);
+    assert(crequest);
     fatal_if(crequest->getRubyType() != RubyRequestType_LD,
              "readCallback received non-read type response\n");
 
     hitCallback(crequest, mach, data, true, crequest->getIssueTime(),
                 forwardRequestTime, firstResponseTime, isRegion);
 
-    delete crequest;
-    coalescedTable.at(address).pop_front();
-    if (coalescedTable.at(address).empty()) {
-      coalescedTable.erase(address);
-    } else {
-      auto nextRequest = coalescedTable.at(address).front();
+    auto nextRequest = coalescedTable.pop(address);
+    freeCoalescedRequest(crequest);
+    if (nextRequest) {
       issueRequest(nextRequest);
     }
 }
@@ -767,16 +783,13 @@ GPUCoalescer::coalescePacket(PacketPtr pkt)
 
     // If the packet has the same line address as a request already in the
     // coalescedTable and has the same sequence number, it can be coalesced.
-    if (coalescedTable.count(line_addr)) {
-        // Search for a previous coalesced request with the same seqNum.
-        auto& creqQueue = coalescedTable.at(line_addr);
-        auto citer = std::find_if(creqQueue.begin(), creqQueue.end(),
-            [&](CoalescedRequest* c) { return c->getSeqNum() == seqNum; }
-        );
-        if (citer != creqQueue.end()) {
-            (*citer)->insertPacket(pkt);
-            return true;
-        }
+    // Search for a previous coalesced request with the same seqNum.
+    CoalescedRequest *prev = coalescedTable.findIf(line_addr,
+        [&](CoalescedRequest* c) { return c->getSeqNum() == seqNum; }
+    );
+    if (prev) {
+        prev->insertPacket(pkt);
+        return true;
     }
 
     if (m_outstanding_count < m_max_outstanding_requests) {
@@ -785,26 +798,21 @@ GPUCoalescer::coalescePacket(PacketPtr pkt)
         DPRINTF(GPUCoalescer, "Creating new or aliased request for 0x%X\n",
                 line_addr);
 
-        CoalescedRequest *creq = new CoalescedRequest(seqNum);
+        CoalescedRequest *creq = allocCoalescedRequest(seqNum);
         creq->insertPacket(pkt);
         creq->setRubyType(getRequestType(pkt));
         creq->setIssueTime(curCycle());
 
-        if (!coalescedTable.count(line_addr)) {
+        if (!coalescedTable.front(line_addr)) {
             // If there is no outstanding request for this line address,
             // create a new coalecsed request and issue it immediately.
-            auto reqList = std::deque<CoalescedRequest*> { creq };
-            coalescedTable.insert(std::make_pair(line_addr, reqList));
-            if (!coalescedReqs.count(seqNum)) {
-                coalescedReqs.insert(std::make_pair(seqNum, reqList));
-            } else {
-                coalescedReqs.at(seqNum).push_back(creq);
-            }
+            coalescedTable.push(line_addr, creq);
+            coalescedReqs.push_back(creq);
         } else {
             // The request is for a line address that is already outstanding
             // but for a different instruction. Add it as a new request to be
             // issued when the current outstanding request is completed.
-            coalescedTable.at(line_addr).push_back(creq);
+            coalescedTable.push(line_addr, creq);
             DPRINTF(GPUCoalescer, "found address 0x%X with new seqNum %d\n",
                     line_addr, seqNum);
         }
@@ -883,20 +891,17 @@ GPUCoalescer::completeIssue()
             // erase them from the list if coalescing is successful and
             // leave them in the list otherwise. This aggressively attempts
             // to coalesce as many packets as possible from the current inst.
-            pkt_list->remove_if(
+            pkt_list->erase(std::remove_if(pkt_list->begin(), pkt_list->end(),
                 [&](PacketPtr pkt) { return coalescePacket(pkt); }
-            );
-
-            if (coalescedReqs.count(seq_num)) {
-                auto& creqs = coalescedReqs.at(seq_num);
-                for (auto creq : creqs) {
-                    DPRINTF(GPUCoalescer, "Issued req type %s seqNum %d\n",
-                            RubyRequestType_to_string(creq->getRubyType()),
-                                                      seq_num);
-                    issueRequest(creq);
-                }
-                coalescedReqs.erase(seq_num);
+            ), pkt_list->end());
+
+            for (auto creq : coalescedReqs) {
+                DPRINTF(GPUCoalescer, "Issued req type %s seqNum %d\n",
+                        RubyRequestType_to_string(creq->getRubyType()),
+                                                  seq_num);
+                issueRequest(creq);
             }
+            coalescedReqs.clear();
 
             assert(pkt_list_size >= pkt_list->size());
             size_t pkt_list_diff = pkt_list_size - pkt_list->size();
@@ -946,9 +951,9 @@ GPUCoalescer::atomicCallback(Addr address,
                              const DataBlock& data)
 {
     assert(address == makeLineAddress(address));
-    assert(coalescedTable.count(address));
 
-    auto crequest = coalescedTable.at(address).front();
+    auto crequest = coalescedTable.front(address);
+    assert(crequest);
 
     fatal_if((crequest->getRubyType() != RubyRequestType_ATOMIC &&
               crequest->getRubyType() != RubyRequestType_ATOMIC_RETURN &&
@@ -958,13 +963,10 @@ GPUCoalescer::atomicCallback(Addr address,
     hitCallback(crequest, mach, (DataBlock&)data, true,
                 crequest->getIssueTime(), Cycles(0), Cycles(0), false);
 
-    delete crequest;
-    coalescedTable.at(address).pop_front();
+    auto nextRequest = coalescedTable.pop(address);
+    freeCoalescedRequest(crequest);
 
-    if (coalescedTable.at(address).empty()) {
-        coalescedTable.erase(address);
-    } else {
-        auto nextRequest = coalescedTable.at(address).front();
+    if (nextRequest) {
         issueRequest(nextRequest);
     }
 }
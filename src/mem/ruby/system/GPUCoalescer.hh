@@ -34,6 +34,7 @@
 
 #include <iostream>
 #include <unordered_map>
+#include <vector>
 
 #include "base/statistics.hh"
 #include "gpu-compute/gpu_dyn_inst.hh"
@@ -45,6 +46,8 @@
 #include "mem/ruby/protocol/RubyAccessMode.hh"
 #include "mem/ruby/protocol/RubyRequestType.hh"
 #include "mem/ruby/protocol/SequencerRequestType.hh"
+#include "mem/ruby/structures/InstSeqTable.hh"
+#include "mem/ruby/structures/LineQueueTable.hh"
 #include "mem/ruby/system/Sequencer.hh"
 #include "mem/token_port.hh"
 
@@ -62,7 +65,7 @@ struct MachineID;
 class CacheMemory;
 
 // List of packets that belongs to a specific instruction.
-typedef std::list<PacketPtr> PerInstPackets;
+typedef std::vector<PacketPtr> PerInstPackets;
 
 class UncoalescedTable
 {
@@ -95,15 +98,29 @@ class UncoalescedTable
   private:
     GPUCoalescer *coalescer;
 
-    // Maps an instructions unique sequence number to a queue of packets
-    // which need responses. This data structure assumes the sequence number
-    // is monotonically increasing (which is true for CU class) in order to
-    // issue packets in age order.
-    std::map<InstSeqNum, PerInstPackets> instMap;
-
-    std::map<InstSeqNum, int> instPktsRemaining;
+    struct PerInstState
+    {
+        // Packets of the instruction which need responses.
+        PerInstPackets pkts;
+        // Packets still expected from the instruction, -1 until known.
+        int pktsRemaining;
+        RubyRequestType reqType;
+
+        void
+        clear()
+        {
+            pkts.clear();
+            pktsRemaining = -1;
+            reqType = RubyRequestType_NULL;
+        }
+    };
 
-    std::map<InstSeqNum, RubyRequestType> reqTypeMap;
+    // Maps an instructions unique sequence number to the packets which
+    // need responses and its bookkeeping. Instructions are kept in
+    // sequence number order, which is assumed to be monotonically
+    // increasing (true for the CU class), in order to issue packets in age
+    // order.
+    InstSeqTable<PerInstState> instMap;
 };
 
 class CoalescedRequest
@@ -111,26 +128,42 @@ class CoalescedRequest
   public:
     CoalescedRequest(uint64_t _seqNum)
         : seqNum(_seqNum), issueTime(Cycles(0)),
-          rubyType(RubyRequestType_NULL)
+          rubyType(RubyRequestType_NULL), next(nullptr)
     {}
     ~CoalescedRequest() {}
 
+    // Prepare a recycled request for reuse, keeping the capacity of
+    // its packet list.
+    void
+    reset(uint64_t _seqNum)
+    {
+        seqNum = _seqNum;
+        issueTime = Cycles(0);
+        rubyType = RubyRequestType_NULL;
+        pkts.clear();
+        next = nullptr;
+    }
+
     void insertPacket(PacketPtr pkt) { pkts.push_back(pkt); }
     void setSeqNum(uint64_t _seqNum) { seqNum = _seqNum; }
     void setIssueTime(Cycles _issueTime) { issueTime = _issueTime; }
     void setRubyType(RubyRequestType type) { rubyType = type; }
+    void setNext(CoalescedRequest *_next) { next = _next; }
 
     uint64_t getSeqNum() const { return seqNum; }
     PacketPtr getFirstPkt() const { return pkts[0]; }
     Cycles getIssueTime() const { return issueTime; }
     RubyRequestType getRubyType() const { return rubyType; }
     std::vector<PacketPtr>& getPackets() { return pkts; }
+    // Next request for the same line in the coalesced table.
+    CoalescedRequest *getNext() const { return next; }
 
   private:
     uint64_t seqNum;
     Cycles issueTime;
     RubyRequestType rubyType;
     std::vector<PacketPtr> pkts;
+    CoalescedRequest *next;
 };
 
 // PendingWriteInst tracks the number of outstanding Ruby requests
@@ -435,11 +468,17 @@ class GPUCoalescer : public RubyPort
     // maximum size is equal to the maximum outstanding requests for a CU
     // (typically the number of blocks in TCP). If there are duplicates of
     // an address, the are serviced in age order.
-    std::map<Addr, std::deque<CoalescedRequest*>> coalescedTable;
-    // Map of instruction sequence number to coalesced requests that get
+    LineQueueTable<CoalescedRequest> coalescedTable;
+    // Coalesced requests of the instruction being coalesced that get
     // created in coalescePacket, used in completeIssue to send the fully
     // coalesced request
-    std::unordered_map<uint64_t, std::deque<CoalescedRequest*>> coalescedReqs;
+    std::vector<CoalescedRequest*> coalescedReqs;
+
+    // Retired coalesced requests, recycled by coalescePacket instead of
+    // allocating a new request for every line.
+    std::vector<CoalescedRequest*> freeCoalescedRequests;
+    CoalescedRequest *allocCoalescedRequest(uint64_t seqNum);
+    void freeCoalescedRequest(CoalescedRequest *crequest);
 
     // a map btw an instruction sequence number and PendingWriteInst
     // this is used to do a final call back for each write when it is
@@ -56,6 +56,12 @@ class RubySystem(ClockedObject):
         "Use phys_mem as the functional \
         store and only use ruby for timing.",
     )
+    direct_warmup = Param.Bool(
+        False,
+        "When restoring from a checkpoint, install the recorded cache "
+        "lines directly in protocols that support it instead of replaying "
+        "them as requests",
+    )
 
     # Profiler related configuration variables
     hot_lines = Param.Bool(False, "")
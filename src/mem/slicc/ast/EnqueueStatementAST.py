@@ -76,7 +76,9 @@ class EnqueueStatementAST(StatementAST):
         # Declare message
         code(
             "std::shared_ptr<${{msg_type.c_ident}}> out_msg = "
-            "std::make_shared<${{msg_type.c_ident}}>(clockEdge());"
+            "std::allocate_shared<${{msg_type.c_ident}}>("
+            "MemPoolAllocator<${{msg_type.c_ident}}>(&Message::poolUsage), "
+            "clockEdge());"
         )
 
         # The other statements
@@ -0,0 +1,406 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/store_checkpoint.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+namespace store_checkpoint
+{
+
+namespace
+{
+
+/** Granularity at which restore() skips zero memory. */
+constexpr uint64_t PageSize = 4096;
+
+/**
+ * Most separate mappings restore() makes of an image that is not flat.
+ * Every one of them can be a VMA of its own, and Linux allows only
+ * vm.max_map_count (65530 by default) of those per process, which the
+ * simulator needs for itself as well. Chunks beyond this are read.
+ */
+constexpr uint64_t MaxMappedRuns = 16384;
+
+bool
+allZero(const uint8_t *p, uint64_t len)
+{
+    // OR whole blocks together so the compiler can vectorise, and stop
+    // at the first block with anything in it
+    constexpr uint64_t Block = 256;
+    uint64_t i = 0;
+    for (; i + Block <= len; i += Block) {
+        uint64_t acc = 0;
+        for (uint64_t j = 0; j < Block; j += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, p + i + j, sizeof(word));
+            acc |= word;
+        }
+        if (acc)
+            return false;
+    }
+    for (; i < len; i++) {
+        if (p[i])
+            return false;
+    }
+    return true;
+}
+
+bool
+pwriteAll(int fd, const void *buf, uint64_t len, uint64_t offset)
+{
+    auto *p = static_cast<const uint8_t *>(buf);
+    while (len) {
+        ssize_t n = pwrite(fd, p, len, offset);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        p += n;
+        len -= n;
+        offset += n;
+    }
+    return true;
+}
+
+bool
+preadAll(int fd, void *buf, uint64_t len, uint64_t offset)
+{
+    auto *p = static_cast<uint8_t *>(buf);
+    while (len) {
+        ssize_t n = pread(fd, p, len, offset);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        if (n == 0)
+            return false;
+        p += n;
+        len -= n;
+        offset += n;
+    }
+    return true;
+}
+
+/**
+ * Is the file a flat image, as save() writes without compression, with
+ * every chunk that is not zero stored in place and nothing else in the
+ * way?
+ */
+bool
+isFlat(const Header &header, const std::vector<ChunkEntry> &index)
+{
+    if (header.indexOffset < FileAlign + header.size)
+        return false;
+
+    for (uint64_t chunk = 0; chunk < index.size(); chunk++) {
+        const ChunkEntry &entry = index[chunk];
+        if (entry.kind != ZeroChunk &&
+            (entry.kind != RawChunk ||
+             entry.offset != FileAlign + chunk * header.chunkSize)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+unsigned
+numThreads(unsigned threads, uint64_t num_chunks)
+{
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    return std::max<uint64_t>(1, std::min<uint64_t>(threads, num_chunks));
+}
+
+/**
+ * Call f(chunk, scratch) for every chunk, spread over the given number
+ * of threads, where scratch is a buffer private to the calling thread.
+ * f returns an error message, or nullptr on success, and the first error
+ * stops all threads and is returned.
+ */
+template <typename F>
+const char *
+forEachChunk(unsigned threads, uint64_t num_chunks, F f)
+{
+    std::atomic<uint64_t> next(0);
+    std::atomic<const char *> error(nullptr);
+
+    auto worker = [&]() {
+        std::vector<uint8_t> scratch;
+        while (!error.load(std::memory_order_relaxed)) {
+            const uint64_t chunk = next.fetch_add(1);
+            if (chunk >= num_chunks)
+                break;
+            if (const char *err = f(chunk, scratch)) {
+                const char *none = nullptr;
+                error.compare_exchange_strong(none, err);
+            }
+        }
+    };
+
+    std::vector<std::thread> helpers;
+    for (unsigned i = 1; i < threads; i++)
+        helpers.emplace_back(worker);
+    worker();
+    for (auto &helper : helpers)
+        helper.join();
+
+    return error.load();
+}
+
+} // anonymous namespace
+
+void
+save(const std::string &path, const uint8_t *pmem, uint64_t size,
+     unsigned threads, bool compress)
+{
+    const uint64_t num_chunks = divCeil(size, ChunkSize);
+
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    fatal_if(fd < 0, "Can't open physical memory checkpoint file '%s'\n",
+             path);
+
+    std::vector<ChunkEntry> index(num_chunks);
+    std::mutex end_mutex;
+    uint64_t file_end = compress ? FileAlign :
+        FileAlign + roundUp(size, FileAlign);
+
+    const char *err = forEachChunk(numThreads(threads, num_chunks),
+                                   num_chunks,
+        [&](uint64_t chunk, std::vector<uint8_t> &buf) -> const char * {
+            const uint8_t *src = pmem + chunk * ChunkSize;
+            const uint64_t len = std::min(ChunkSize, size - chunk * ChunkSize);
+            ChunkEntry &entry = index[chunk];
+
+            if (allZero(src, len)) {
+                entry = {0, 0, ZeroChunk};
+                return nullptr;
+            }
+
+            if (!compress) {
+                entry = {FileAlign + chunk * ChunkSize, uint32_t(len),
+                         RawChunk};
+                return pwriteAll(fd, src, len, entry.offset) ?
+                    nullptr : "Write failed";
+            }
+
+            uLongf compressed_len = compressBound(len);
+            buf.resize(compressed_len);
+            const bool compressed =
+                compress2(buf.data(), &compressed_len, src, len,
+                          Z_BEST_SPEED) == Z_OK && compressed_len < len;
+
+            const uint8_t *data = compressed ? buf.data() : src;
+            const uint64_t data_len = compressed ? compressed_len : len;
+            {
+                std::lock_guard<std::mutex> lock(end_mutex);
+                if (!compressed)
+                    file_end = roundUp(file_end, FileAlign);
+                entry = {file_end, uint32_t(data_len),
+                         compressed ? ZlibChunk : RawChunk};
+                file_end += data_len;
+            }
+
+            return pwriteAll(fd, data, data_len, entry.offset) ?
+                nullptr : "Write failed";
+        });
+
+    if (!err) {
+        Header header = {};
+        std::memcpy(header.magic, Magic, sizeof(header.magic));
+        header.version = Version;
+        header.chunkSize = ChunkSize;
+        header.size = size;
+        header.numChunks = num_chunks;
+        header.indexOffset = file_end;
+
+        if (!pwriteAll(fd, index.data(), num_chunks * sizeof(ChunkEntry),
+                       file_end) ||
+            !pwriteAll(fd, &header, sizeof(header), 0)) {
+            err = "Write failed";
+        }
+    }
+
+    if (close(fd) != 0 && !err)
+        err = "Close failed";
+
+    fatal_if(err, "%s on physical memory checkpoint file '%s'\n", err, path);
+}
+
+bool
+restore(const std::string &path, uint8_t *pmem, uint64_t size,
+        unsigned threads, bool map)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    fatal_if(fd < 0, "Can't open physical memory checkpoint file '%s'\n",
+             path);
+
+    Header header;
+    fatal_if(!preadAll(fd, &header, sizeof(header), 0) ||
+             std::memcmp(header.magic, Magic, sizeof(header.magic)) != 0,
+             "Physical memory checkpoint file '%s' is not in the chunked "
+             "format\n", path);
+    fatal_if(header.version != Version,
+             "Physical memory checkpoint file '%s' has version %d, "
+             "expected %d\n", path, header.version, Version);
+    fatal_if(header.size != size,
+             "Memory range size has changed! Saw %lld, expected %lld\n",
+             header.size, size);
+
+    const uint64_t chunk_size = header.chunkSize;
+    const uint64_t num_chunks = header.numChunks;
+    fatal_if(chunk_size == 0 || num_chunks != divCeil(size, chunk_size),
+             "Physical memory checkpoint file '%s' is corrupt\n", path);
+
+    std::vector<ChunkEntry> index(num_chunks);
+    fatal_if(!preadAll(fd, index.data(), num_chunks * sizeof(ChunkEntry),
+                       header.indexOffset),
+             "Read failed on physical memory checkpoint file '%s'\n", path);
+
+    const uint64_t page_size = sysconf(_SC_PAGE_SIZE);
+    if (map && isFlat(header, index) && size % page_size == 0 &&
+        FileAlign % page_size == 0) {
+        // the mapping keeps its own reference to the file
+        void *mapped = mmap(pmem, size, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_FIXED, fd, FileAlign);
+        if (mapped == pmem) {
+            close(fd);
+            return true;
+        }
+        // Read the image instead, mapping parts of it would fail too
+        warn("Can't map physical memory checkpoint file '%s': %s, "
+             "reading it instead\n", path, strerror(errno));
+        map = false;
+    }
+
+    // Map whole uncompressed chunks in place, like a flat image. Chunks
+    // that follow each other in the file are mapped together, and
+    // anything that can't be mapped is read below.
+    std::vector<bool> mapped(num_chunks, false);
+    auto mappable = [&](uint64_t chunk) {
+        const ChunkEntry &entry = index[chunk];
+        const uint64_t len = std::min(chunk_size, size - chunk * chunk_size);
+        return entry.kind == RawChunk && entry.length == len &&
+            len % page_size == 0 && entry.offset % page_size == 0;
+    };
+    uint64_t runs = 0;
+    for (uint64_t chunk = 0; map && chunk < num_chunks; chunk++) {
+        uint8_t *dst = pmem + chunk * chunk_size;
+        if (!mappable(chunk) ||
+            reinterpret_cast<uintptr_t>(dst) % page_size != 0) {
+            continue;
+        }
+
+        uint64_t end = chunk + 1;
+        while (end < num_chunks && mappable(end) &&
+               index[end].offset ==
+               index[chunk].offset + (end - chunk) * chunk_size) {
+            end++;
+        }
+
+        const uint64_t len = (end - chunk) * chunk_size;
+        if (runs++ == MaxMappedRuns)
+            break;
+        void *p = mmap(dst, len, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_FIXED, fd, index[chunk].offset);
+        if (p != dst)
+            break;
+        std::fill(mapped.begin() + chunk, mapped.begin() + end, true);
+        chunk = end - 1;
+    }
+
+    const char *err = forEachChunk(numThreads(threads, num_chunks),
+                                   num_chunks,
+        [&](uint64_t chunk, std::vector<uint8_t> &buf) -> const char * {
+            const ChunkEntry &entry = index[chunk];
+            if (entry.kind == ZeroChunk || mapped[chunk])
+                return nullptr;
+
+            const uint64_t len = std::min(chunk_size,
+                                          size - chunk * chunk_size);
+            buf.resize(len + entry.length);
+            uint8_t *data = buf.data();
+            uint8_t *in = entry.kind == RawChunk ? data : data + len;
+
+            if (entry.kind == RawChunk ? entry.length != len :
+                entry.kind != ZlibChunk) {
+                return "Corrupt chunk";
+            }
+
+            uint8_t *dst = pmem + chunk * chunk_size;
+            if (!preadAll(fd, in, entry.length, entry.offset))
+                return "Read failed";
+            if (entry.kind == ZlibChunk) {
+                uLongf out_len = len;
+                if (uncompress(data, &out_len, in, entry.length) != Z_OK ||
+                    out_len != len) {
+                    return "Corrupt chunk";
+                }
+            }
+
+            // Only copy pages that are non-zero, so we don't give the VM
+            // system hell
+            for (uint64_t off = 0; off < len; off += PageSize) {
+                const uint64_t page_len = std::min(PageSize, len - off);
+                if (!allZero(data + off, page_len))
+                    std::memcpy(dst + off, data + off, page_len);
+            }
+            return nullptr;
+        });
+
+    close(fd);
+
+    fatal_if(err, "%s on physical memory checkpoint file '%s'\n", err, path);
+    return false;
+}
+
+} // namespace store_checkpoint
+} // namespace memory
+} // namespace gem5
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_STORE_CHECKPOINT_HH__
+#define __MEM_STORE_CHECKPOINT_HH__
+
+#include <cstdint>
+#include <string>
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * The chunked checkpoint format for the contents of a backing store.
+ *
+ * The store is cut into chunks of ChunkSize bytes. Chunks that are all
+ * zero are not written at all, the others are compressed with zlib on
+ * several threads, and kept uncompressed when that does not make them
+ * smaller. Uncompressed chunks start at a page aligned file offset.
+ *
+ * When compression is turned off the file is a flat image instead:
+ * chunk i is at FileAlign + i * ChunkSize, with holes for zero chunks,
+ * so that the whole image can be mapped into a backing store.
+ *
+ * A file starts with a Header, followed by the chunk data in no
+ * particular order, and ends with one ChunkEntry per chunk at
+ * Header::indexOffset. All fields are in host byte order.
+ */
+namespace store_checkpoint
+{
+
+/** Bytes of memory per chunk. */
+constexpr uint64_t ChunkSize = 64 * 1024;
+
+/** Alignment of uncompressed chunks, and size of the header block. */
+constexpr uint64_t FileAlign = 4096;
+
+constexpr char Magic[8] = "gem5mem";
+constexpr uint32_t Version = 1;
+
+struct Header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t chunkSize;
+    uint64_t size;
+    uint64_t numChunks;
+    uint64_t indexOffset;
+};
+
+enum ChunkKind : uint32_t
+{
+    ZeroChunk = 0,
+    RawChunk = 1,
+    ZlibChunk = 2,
+};
+
+struct ChunkEntry
+{
+    uint64_t offset;
+    uint32_t length;
+    uint32_t kind;
+};
+
+/**
+ * Write a backing store to a checkpoint file.
+ *
+ * @param path File to create.
+ * @param pmem Start of the backing store.
+ * @param size Size of the backing store in bytes.
+ * @param threads Threads to compress with, 0 for one per host core.
+ * @param compress Compress the chunks, or write a flat image.
+ */
+void save(const std::string &path, const uint8_t *pmem, uint64_t size,
+          unsigned threads, bool compress = true);
+
+/**
+ * Fill a backing store from a checkpoint file. Pages that are zero in
+ * the checkpoint are left untouched, so the store is expected to be
+ * zero to begin with.
+ *
+ * @param path File to read.
+ * @param pmem Start of the backing store.
+ * @param size Size of the backing store in bytes, which must match the
+ *        size in the file.
+ * @param threads Threads to decompress with, 0 for one per host core.
+ * @param map Map the image copy-on-write over the store rather than
+ *        reading it. Pages are then read lazily, and shared with other
+ *        processes mapping the same file, which must not change while
+ *        it is in use. The store must be a private, page aligned
+ *        mapping of its own. Of an image that is not flat, only the
+ *        whole uncompressed chunks at page aligned offsets are mapped,
+ *        and the rest is read, as is anything the host won't map.
+ * @return Whether the whole image was mapped, which needs a flat image
+ *         and a size that is a multiple of the host page size.
+ */
+bool restore(const std::string &path, uint8_t *pmem, uint64_t size,
+             unsigned threads, bool map = false);
+
+} // namespace store_checkpoint
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_STORE_CHECKPOINT_HH__
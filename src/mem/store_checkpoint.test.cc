@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "base/gtest/logging.hh"
+#include "mem/store_checkpoint.hh"
+
+using namespace gem5;
+using namespace gem5::memory;
+
+namespace
+{
+
+class StoreCheckpointTest : public testing::Test
+{
+  protected:
+    std::string path;
+
+    void
+    SetUp() override
+    {
+        char name[] = "/tmp/store_checkpoint_XXXXXX";
+        int fd = mkstemp(name);
+        ASSERT_GE(fd, 0);
+        close(fd);
+        path = name;
+    }
+
+    void TearDown() override { unlink(path.c_str()); }
+
+    /**
+     * A store with zero chunks, compressible chunks, random chunks and a
+     * partial chunk at the end.
+     */
+    static std::vector<uint8_t>
+    makeStore()
+    {
+        const uint64_t chunk = store_checkpoint::ChunkSize;
+        std::vector<uint8_t> store(7 * chunk + 1000, 0);
+        std::mt19937_64 rng(42);
+        for (uint64_t i = chunk; i < 2 * chunk; i++)
+            store[i] = i % 7;
+        for (uint64_t i = 3 * chunk; i < 4 * chunk; i++)
+            store[i] = rng();
+        store[5 * chunk + 4096 + 17] = 0xaa;
+        for (uint64_t i = 7 * chunk; i < store.size(); i++)
+            store[i] = rng();
+        return store;
+    }
+};
+
+} // anonymous namespace
+
+TEST_F(StoreCheckpointTest, RoundTrip)
+{
+    const auto store = makeStore();
+    store_checkpoint::save(path, store.data(), store.size(), 4);
+
+    std::vector<uint8_t> restored(store.size(), 0);
+    store_checkpoint::restore(path, restored.data(), restored.size(), 3);
+    EXPECT_EQ(restored, store);
+}
+
+TEST_F(StoreCheckpointTest, SkipsZeroChunks)
+{
+    const auto store = makeStore();
+    store_checkpoint::save(path, store.data(), store.size(), 1);
+
+    std::ifstream file(path, std::ios::binary);
+    store_checkpoint::Header header;
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    ASSERT_TRUE(file);
+    EXPECT_EQ(header.numChunks, 8);
+
+    std::vector<store_checkpoint::ChunkEntry> index(header.numChunks);
+    file.seekg(header.indexOffset);
+    file.read(reinterpret_cast<char *>(index.data()),
+              index.size() * sizeof(index[0]));
+    ASSERT_TRUE(file);
+
+    EXPECT_EQ(index[0].kind, store_checkpoint::ZeroChunk);
+    EXPECT_EQ(index[1].kind, store_checkpoint::ZlibChunk);
+    EXPECT_EQ(index[2].kind, store_checkpoint::ZeroChunk);
+    EXPECT_EQ(index[3].kind, store_checkpoint::RawChunk);
+    EXPECT_EQ(index[3].offset % store_checkpoint::FileAlign, 0);
+    EXPECT_EQ(index[5].kind, store_checkpoint::ZlibChunk);
+    EXPECT_EQ(index[6].kind, store_checkpoint::ZeroChunk);
+}
+
+TEST_F(StoreCheckpointTest, KeepsZeroPagesUntouched)
+{
+    const auto store = makeStore();
+    store_checkpoint::save(path, store.data(), store.size(), 2);
+
+    // Zero memory in the checkpoint must not overwrite the store
+    std::vector<uint8_t> restored(store.size(), 0x55);
+    store_checkpoint::restore(path, restored.data(), restored.size(), 2);
+    EXPECT_EQ(restored[0], 0x55);
+    EXPECT_EQ(restored[5 * store_checkpoint::ChunkSize], 0x55);
+    EXPECT_EQ(restored[5 * store_checkpoint::ChunkSize + 4096 + 17], 0xaa);
+}
+
+TEST_F(StoreCheckpointTest, SizeMismatch)
+{
+    const auto store = makeStore();
+    store_checkpoint::save(path, store.data(), store.size(), 1);
+
+    std::vector<uint8_t> restored(store.size() + 1, 0);
+    gtestLogOutput.str("");
+    EXPECT_ANY_THROW(store_checkpoint::restore(path, restored.data(),
+                                               restored.size(), 1));
+    EXPECT_NE(gtestLogOutput.str().find("Memory range size has changed"),
+              std::string::npos);
+}
+
+TEST_F(StoreCheckpointTest, FlatImage)
+{
+    const auto store = makeStore();
+    store_checkpoint::save(path, store.data(), store.size(), 2, false);
+
+    std::vector<uint8_t> restored(store.size(), 0);
+    EXPECT_FALSE(store_checkpoint::restore(path, restored.data(),
+                                           restored.size(), 2));
+    EXPECT_EQ(restored, store);
+}
+
+TEST_F(StoreCheckpointTest, MapFlatImage)
+{
+    // A store of whole pages, mapped on its own like a backing store
+    auto store = makeStore();
+    store.resize(8 * store_checkpoint::ChunkSize);
+    store_checkpoint::save(path, store.data(), store.size(), 2, false);
+
+    void *pmem = mmap(nullptr, store.size(), PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(pmem, MAP_FAILED);
+    uint8_t *mem = static_cast<uint8_t *>(pmem);
+
+    EXPECT_TRUE(store_checkpoint::restore(path, mem, store.size(), 1, true));
+    EXPECT_EQ(std::memcmp(mem, store.data(), store.size()), 0);
+
+    // Writes are private to the mapping, the image is unchanged
+    mem[3 * store_checkpoint::ChunkSize] ^= 0xff;
+    std::vector<uint8_t> again(store.size(), 0);
+    store_checkpoint::restore(path, again.data(), again.size(), 1);
+    EXPECT_EQ(again, store);
+
+    munmap(pmem, store.size());
+}
+
+TEST_F(StoreCheckpointTest, MapCompressedReads)
+{
+    const auto store = makeStore();
+    store_checkpoint::save(path, store.data(), store.size(), 2);
+
+    std::vector<uint8_t> restored(store.size(), 0);
+    EXPECT_FALSE(store_checkpoint::restore(path, restored.data(),
+                                           restored.size(), 2, true));
+    EXPECT_EQ(restored, store);
+}
+
+TEST_F(StoreCheckpointTest, MapCompressedRawChunks)
+{
+    auto store = makeStore();
+    store.resize(8 * store_checkpoint::ChunkSize);
+    store_checkpoint::save(path, store.data(), store.size(), 2);
+
+    void *pmem = mmap(nullptr, store.size(), PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(pmem, MAP_FAILED);
+    uint8_t *mem = static_cast<uint8_t *>(pmem);
+
+    EXPECT_FALSE(store_checkpoint::restore(path, mem, store.size(), 2,
+                                           true));
+    EXPECT_EQ(std::memcmp(mem, store.data(), store.size()), 0);
+
+#ifdef __linux__
+    // The random chunk is stored raw, so it is now backed by the file
+    const auto raw = reinterpret_cast<uintptr_t>(
+        mem + 3 * store_checkpoint::ChunkSize);
+    std::ifstream maps("/proc/self/maps");
+    bool mapped = false;
+    for (std::string line; std::getline(maps, line);) {
+        uintptr_t start, end;
+        if (std::sscanf(line.c_str(), "%lx-%lx", &start, &end) == 2 &&
+            start <= raw && raw < end) {
+            mapped = line.find(path) != std::string::npos;
+        }
+    }
+    EXPECT_TRUE(mapped);
+#endif
+
+    // Writes are private to the mapping, the image is unchanged
+    mem[3 * store_checkpoint::ChunkSize] ^= 0xff;
+    std::vector<uint8_t> again(store.size(), 0);
+    store_checkpoint::restore(path, again.data(), again.size(), 1);
+    EXPECT_EQ(again, store);
+
+    munmap(pmem, store.size());
+}
+
+TEST_F(StoreCheckpointTest, MapRawChunkRuns)
+{
+    // Raw chunks 0-3 are consecutive in the file, 4 is compressed and
+    // 5-6 follow it
+    const uint64_t chunk = store_checkpoint::ChunkSize;
+    std::vector<uint8_t> store(8 * chunk, 0);
+    std::mt19937_64 rng(7);
+    for (uint64_t i = 0; i < 4 * chunk; i++)
+        store[i] = rng();
+    for (uint64_t i = 4 * chunk; i < 5 * chunk; i++)
+        store[i] = i % 5;
+    for (uint64_t i = 5 * chunk; i < 7 * chunk; i++)
+        store[i] = rng();
+    store_checkpoint::save(path, store.data(), store.size(), 1);
+
+    void *pmem = mmap(nullptr, store.size(), PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(pmem, MAP_FAILED);
+    uint8_t *mem = static_cast<uint8_t *>(pmem);
+
+    EXPECT_FALSE(store_checkpoint::restore(path, mem, store.size(), 2,
+                                           true));
+    EXPECT_EQ(std::memcmp(mem, store.data(), store.size()), 0);
+
+#ifdef __linux__
+    // The first run is one mapping of the file
+    const auto begin = reinterpret_cast<uintptr_t>(mem);
+    std::ifstream maps("/proc/self/maps");
+    bool mapped = false;
+    for (std::string line; std::getline(maps, line);) {
+        uintptr_t start, end;
+        if (std::sscanf(line.c_str(), "%lx-%lx", &start, &end) == 2 &&
+            start <= begin && begin < end) {
+            mapped = line.find(path) != std::string::npos &&
+                end >= begin + 4 * chunk;
+        }
+    }
+    EXPECT_TRUE(mapped);
+#endif
+
+    munmap(pmem, store.size());
+}
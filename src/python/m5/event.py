@@ -44,8 +44,10 @@ import _m5.event
 from _m5.event import GlobalSimLoopExitEvent as SimExit
 from _m5.event import PyEvent as Event
 from _m5.event import (
+    EventQueueBackend,
     getEventQueue,
     setEventQueue,
+    setEventQueueBackend,
 )
 
 mainq = None
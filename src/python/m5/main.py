@@ -233,6 +233,22 @@ def parse_options():
         callback=_stats_help,
         help="Display documentation for available stat visitors",
     )
+    option(
+        "--stats-include",
+        metavar="GLOB[,GLOB]",
+        action="append",
+        split=",",
+        help="Only dump stats whose name, or the name of an enclosing "
+        "group, matches GLOB (e.g., 'system.ruby.tcp_cntrl*')",
+    )
+    option(
+        "--stats-exclude",
+        metavar="GLOB[,GLOB]",
+        action="append",
+        split=",",
+        help="Do not dump stats whose name, or the name of an enclosing "
+        "group, matches GLOB",
+    )
 
     # Configuration Options
     group("Configuration Options")
@@ -261,6 +277,13 @@ def parse_options():
         help="Create DOT & pdf outputs of the DVFS configuration"
         + " [Default: %default]",
     )
+    option(
+        "--eventq-backend",
+        metavar="{list,calendar}",
+        choices=("list", "calendar"),
+        default="list",
+        help="Data structure used to hold pending events [Default: %default]",
+    )
 
     # Debugging options
     group("Debugging Options")
@@ -405,6 +428,9 @@ def main():
     # Set the main event queue for the main thread.
     event.mainq = event.getEventQueue(0)
     event.setEventQueue(event.mainq)
+    event.setEventQueueBackend(
+        getattr(event.EventQueueBackend, options.eventq_backend)
+    )
 
     if not os.path.isdir(options.outdir):
         os.makedirs(options.outdir)
@@ -558,6 +584,9 @@ def main():
 
     # set stats options
     stats.addStatVisitor(options.stats_file)
+    stats.setStatSelector(
+        include=options.stats_include, exclude=options.stats_exclude
+    )
 
     # Disable listeners unless running interactively or explicitly
     # enabled
@@ -52,9 +52,13 @@ from _m5.stats import periodicStatDump
 from _m5.stats import schedStatEvent as schedEvent
 
 from .gem5stats import JsonOutputVistor
+from .selector import StatSelector
 
 outputList = []
 
+# Include/exclude filter applied to the text and HDF5 stat dumps.
+_selector = StatSelector()
+
 # Dictionary of stat visitor factories populated by the _url_factory
 # visitor.
 factories = {}
@@ -134,23 +138,31 @@ def _url_factory(schemes, enable=True):
 
 
 @_url_factory([None, "", "text", "file"])
-def _textFactory(fn, desc=True, spaces=True):
+def _textFactory(fn, desc=True, spaces=True, deltas=False):
     """Output stats in text format.
 
     Text stat files contain one stat per line with an optional
     description. The description is enabled by default, but can be
     disabled by setting the desc parameter to False.
 
+    When deltas are enabled, a dump only contains the stats whose
+    values changed since they were last dumped. Stats that never leave
+    their reset value are never printed. This keeps periodic dumps of
+    large systems small; the value of a stat missing from a dump is the
+    one it had in the most recent dump that contains it (or zero).
+
     Parameters:
       * desc (bool): Output stat descriptions (default: True)
       * spaces (bool): Output alignment spaces (default: True)
+      * deltas (bool): Only output changed stats (default: False)
 
     Example:
       text://stats.txt?desc=False;spaces=False
+      text://stats.txt?deltas=True
 
     """
 
-    return _m5.stats.initText(fn, desc, spaces)
+    return _m5.stats.initText(fn, desc, spaces, deltas)
 
 
 @_url_factory(["h5"], enable=hasattr(_m5.stats, "initHDF5"))
@@ -190,6 +202,27 @@ def _hdf5Factory(fn, chunking=10, desc=True, formulas=True):
     return _m5.stats.initHDF5(fn, chunking, desc, formulas)
 
 
+@_url_factory(["bin"])
+def _binaryFactory(fn, desc=True):
+    """Output stats in a compact binary format.
+
+    Binary stat files store the list of stats once and then append one
+    fixed-size snapshot of raw values per dump, which makes them cheap to
+    write and to load for runs with many stat dumps. Snapshots can be
+    memory-mapped as a table with one row per dump. Use
+    util/stats/binstats.py to read them or to convert them to text.
+
+    Parameters:
+      * desc (bool): Store stat descriptions (default: True)
+
+    Example:
+      bin://stats.bin?desc=False
+
+    """
+
+    return _m5.stats.initBinary(fn, desc)
+
+
 @_url_factory(["json"])
 def _jsonFactory(fn):
     """Output stats in JSON format.
@@ -234,6 +267,25 @@ def addStatVisitor(url):
     outputList.append(factory(parsed))
 
 
+def setStatSelector(include=None, exclude=None):
+    """Restrict stat dumps to a subset of the stats
+
+    Both arguments are lists of shell-style glob patterns that are
+    matched against full stat names (e.g., "system.cpu.ipc"). A pattern
+    matching a group applies to every stat in it. When include patterns
+    are given, only the stats they select are dumped. Stats selected by
+    an exclude pattern are never dumped. Groups that cannot contain a
+    selected stat are not visited at all.
+
+    The selector applies to the text and HDF5 outputs. JSON output is
+    unaffected.
+
+    """
+
+    global _selector
+    _selector = StatSelector(include, exclude)
+
+
 def printStatVisitorTypes():
     """List available stat visitors and their documentation"""
 
@@ -357,30 +409,50 @@ def prepare():
 
 
 def _dump_to_visitor(visitor, roots=None):
+    selector = _selector
+
     # New stats
-    def dump_group(group):
+    def dump_group(group, path, included):
         for stat in group.getStats():
-            stat.visit(visitor)
+            if not selector or selector.select_stat(
+                f"{path}.{stat.name}" if path else stat.name, included
+            ):
+                stat.visit(visitor)
         for n, g in group.getStatGroups().items():
+            sub_path = f"{path}.{n}" if path else n
+            sub_included = selector.enter_group(sub_path, included)
+            if sub_included is None:
+                continue
             visitor.beginGroup(n)
-            dump_group(g)
+            dump_group(g, sub_path, sub_included)
             visitor.endGroup()
 
     if roots:
         # New stats from selected subroots.
         for root in roots:
+            path = ""
+            included = False
+            for p in root.path_list():
+                path = f"{path}.{p}" if path else p
+                included = selector.enter_group(path, included)
+                if included is None:
+                    break
+            if included is None:
+                continue
+
             for p in root.path_list():
                 visitor.beginGroup(p)
-            dump_group(root)
+            dump_group(root, path, included)
             for p in reversed(root.path_list()):
                 visitor.endGroup()
     else:
         # New stats starting from root.
-        dump_group(Root.getInstance())
+        dump_group(Root.getInstance(), "", False)
 
         # Legacy stats
         for stat in stats_list:
-            stat.visit(visitor)
+            if not selector or selector.select_stat(stat.name, False):
+                stat.visit(visitor)
 
 
 lastDump = 0
@@ -0,0 +1,127 @@
+# Copyright (c) 2026 The gem5 Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Stat selection for stat dumps.
+
+A StatSelector decides which statistics are written by a stat dump based on
+shell-style glob patterns matched against a stat's full dotted name, e.g.,
+``system.ruby.tcp_cntrl0.L1cache.m_demand_hits``. A pattern that matches a
+group (``system.cpu``) selects everything below that group. ``*`` matches
+across dots, so ``system.ruby.tcp_cntrl*`` selects the stats of every TCP
+controller.
+
+Groups that cannot contain a selected stat are pruned before they are
+visited, so the cost of a dump scales with the number of selected stats
+rather than with the size of the stat tree.
+"""
+
+import fnmatch
+import re
+from typing import (
+    Iterable,
+    Optional,
+)
+
+
+class StatSelector:
+    """Include/exclude glob filter over dotted stat names.
+
+    A stat is dumped if it, or one of its enclosing groups, matches an
+    include pattern (or no include patterns were given) and neither it nor
+    any of its enclosing groups matches an exclude pattern.
+    """
+
+    def __init__(
+        self,
+        include: Optional[Iterable[str]] = None,
+        exclude: Optional[Iterable[str]] = None,
+    ):
+        self.include = [p for p in (include or []) if p]
+        self.exclude = [p for p in (exclude or []) if p]
+        self._include_re = self._compile(self.include)
+        self._exclude_re = self._compile(self.exclude)
+        # The part of each include pattern before its first wildcard. A
+        # group can only contain matches of a pattern if its path and the
+        # pattern's literal prefix agree.
+        self._include_prefixes = [
+            re.split(r"[*?\[]", p, maxsplit=1)[0] for p in self.include
+        ]
+
+    @staticmethod
+    def _compile(patterns):
+        if not patterns:
+            return None
+        return re.compile("|".join(fnmatch.translate(p) for p in patterns))
+
+    def __bool__(self) -> bool:
+        return bool(self.include or self.exclude)
+
+    def _may_contain(self, path: str) -> bool:
+        """True if some include pattern may match a stat below path."""
+        prefix = path + "."
+        return any(
+            lit.startswith(prefix) or prefix.startswith(lit)
+            for lit in self._include_prefixes
+        )
+
+    def enter_group(self, path: str, included: bool) -> Optional[bool]:
+        """Decide whether to visit the group at path.
+
+        :param path: The dotted path of the group.
+        :param included: Whether an enclosing group matched an include
+            pattern, as returned by enter_group() for the parent.
+
+        :returns: None if the group should be skipped entirely, otherwise
+            whether the group itself is included, to be passed on to its
+            children.
+        """
+        if self._exclude_re and self._exclude_re.match(path):
+            return None
+
+        if included or not self._include_re:
+            return True
+        if self._include_re.match(path):
+            return True
+        if self._may_contain(path):
+            return False
+
+        return None
+
+    def select_stat(self, name: str, included: bool) -> bool:
+        """True if the stat with the full dotted name should be dumped.
+
+        :param included: Whether an enclosing group matched an include
+            pattern, as returned by enter_group().
+        """
+        if self._exclude_re and self._exclude_re.match(name):
+            return False
+
+        return (
+            included
+            or not self._include_re
+            or bool(self._include_re.match(name))
+        )
@@ -117,6 +117,14 @@ pybind_init_event(py::module_ &m_native)
     m.def("getEventQueue", &getEventQueue,
           py::return_value_policy::reference);
 
+    py::enum_<EventQueue::Backend>(m, "EventQueueBackend")
+        .value("list", EventQueue::Backend::List)
+        .value("calendar", EventQueue::Backend::Calendar)
+        ;
+
+    m.def("setEventQueueBackend", &setEventQueueBackend,
+          py::arg("backend"));
+
     py::class_<EventQueue>(m, "EventQueue")
         .def("name",  [](EventQueue *eq) { return eq->name(); })
         .def("dump", &EventQueue::dump)
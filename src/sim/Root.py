@@ -69,6 +69,11 @@ class Root(SimObject):
 
     full_system = Param.Bool("if this is a full system simulation")
 
+    binary_checkpoint = Param.Bool(
+        False,
+        "write m5.cpt in the binary section format rather than as INI text",
+    )
+
     # Time syncing prevents the simulation from running faster than real time.
     time_sync_enable = Param.Bool(False, "whether time syncing is enabled")
     time_sync_period = Param.Clock("100ms", "how often to sync with real time")
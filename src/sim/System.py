@@ -104,6 +104,24 @@ class System(SimObject):
         "shared_backstore is non-empty.",
     )
 
+    memory_checkpoint_threads = Param.Unsigned(
+        0,
+        "Threads used to save and restore the contents of memory in "
+        "checkpoints, 0 for one per host core",
+    )
+    memory_checkpoint_compress = Param.Bool(
+        True,
+        "Compress the contents of memory in checkpoints. Uncompressed "
+        "checkpoints are flat images that memory_checkpoint_mmap can map",
+    )
+    memory_checkpoint_mmap = Param.Bool(
+        False,
+        "Restore uncompressed memory checkpoints by mapping them "
+        "copy-on-write, so pages are read on first use and shared with "
+        "other processes restoring the same checkpoint. The checkpoint "
+        "must not be modified while in use",
+    )
+
     cache_line_size = Param.Unsigned(64, "Cache line size in bytes")
 
     redirect_paths = VectorParam.RedirectPath([], "Path redirections")
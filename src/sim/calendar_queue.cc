@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/calendar_queue.hh"
+
+#include <algorithm>
+#include <cassert>
+
+#include "base/logging.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+bool
+binLess(const Event *l, const Event *r)
+{
+    return *l < *r;
+}
+
+} // anonymous namespace
+
+CalendarQueue::CalendarQueue()
+    : buckets(MinBuckets, nullptr), mask(MinBuckets - 1),
+      width(1000), numEvents(0)
+{
+}
+
+void
+CalendarQueue::insert(Event *event)
+{
+    Event *&top = buckets[bucketOf(event->when())];
+
+    if (!top || *event <= *top) {
+        top = Event::insertBefore(event, top);
+    } else {
+        Event *prev = top;
+        Event *curr = top->nextBin;
+        while (curr && *curr < *event) {
+            prev = curr;
+            curr = curr->nextBin;
+        }
+        prev->nextBin = Event::insertBefore(event, curr);
+    }
+
+    if (++numEvents > 2 * buckets.size())
+        resize(2 * buckets.size());
+}
+
+void
+CalendarQueue::remove(Event *event)
+{
+    Event *&top = buckets[bucketOf(event->when())];
+    if (!top)
+        panic("event not found!");
+
+    if (*top == *event) {
+        top = Event::removeItem(event, top);
+    } else {
+        Event *prev = top;
+        Event *curr = top->nextBin;
+        while (curr && *curr < *event) {
+            prev = curr;
+            curr = curr->nextBin;
+        }
+
+        if (!curr || *curr != *event)
+            panic("event not found!");
+
+        prev->nextBin = Event::removeItem(event, curr);
+    }
+
+    assert(numEvents > 0);
+    if (--numEvents < buckets.size() / 4 && buckets.size() > MinBuckets)
+        resize(buckets.size() / 2);
+}
+
+Event *
+CalendarQueue::findMin(Tick hint) const
+{
+    if (numEvents == 0)
+        return nullptr;
+
+    // Scan one year of days starting at the hint. The first bucket whose
+    // earliest bin falls on the day being scanned holds the minimum.
+    Tick day = hint / width;
+    for (size_t i = 0; i < buckets.size(); ++i, ++day) {
+        Event *top = buckets[day & mask];
+        if (top && top->when() / width == day)
+            return top;
+    }
+
+    // The next event is more than a year away, search all buckets.
+    Event *min = nullptr;
+    for (Event *top : buckets) {
+        if (top && (!min || *top < *min))
+            min = top;
+    }
+    return min;
+}
+
+std::vector<Event *>
+CalendarQueue::bins() const
+{
+    std::vector<Event *> all;
+    for (Event *top : buckets) {
+        for (Event *bin = top; bin; bin = bin->nextBin)
+            all.push_back(bin);
+    }
+    std::sort(all.begin(), all.end(), binLess);
+    return all;
+}
+
+Event *
+CalendarQueue::drain()
+{
+    std::vector<Event *> all = bins();
+
+    Event *head = nullptr;
+    for (auto it = all.rbegin(); it != all.rend(); ++it) {
+        (*it)->nextBin = head;
+        head = *it;
+    }
+
+    std::fill(buckets.begin(), buckets.end(), nullptr);
+    numEvents = 0;
+
+    return head;
+}
+
+void
+CalendarQueue::insertBin(Event *top)
+{
+    Event *&first = buckets[bucketOf(top->when())];
+
+    if (!first || *top < *first) {
+        top->nextBin = first;
+        first = top;
+        return;
+    }
+
+    Event *prev = first;
+    while (prev->nextBin && *prev->nextBin < *top)
+        prev = prev->nextBin;
+    top->nextBin = prev->nextBin;
+    prev->nextBin = top;
+}
+
+void
+CalendarQueue::resize(size_t num_buckets)
+{
+    std::vector<Event *> all = bins();
+
+    // Use three times the average spacing of the earliest events as the
+    // new width, so that most days hold a handful of bins.
+    Tick first = MaxTick;
+    Tick last = 0;
+    size_t distinct = 0;
+    for (size_t i = 0; i < all.size() && distinct < WidthSamples; ++i) {
+        if (all[i]->when() == last && distinct)
+            continue;
+        if (!distinct)
+            first = all[i]->when();
+        last = all[i]->when();
+        ++distinct;
+    }
+    if (distinct > 1)
+        width = std::max<Tick>(1, 3 * (last - first) / (distinct - 1));
+
+    buckets.assign(num_buckets, nullptr);
+    mask = num_buckets - 1;
+
+    // Bins are unique and already sorted, inserting them back to front
+    // keeps every bucket insertion at the head of its list.
+    for (auto it = all.rbegin(); it != all.rend(); ++it)
+        insertBin(*it);
+}
+
+} // namespace gem5
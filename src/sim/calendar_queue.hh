@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_CALENDAR_QUEUE_HH__
+#define __SIM_CALENDAR_QUEUE_HH__
+
+#include <cstddef>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+class Event;
+
+/**
+ * Calendar queue backend for EventQueue.
+ *
+ * Events are kept in the same bins as in the default EventQueue list
+ * (one bin per distinct (when, priority) pair, holding a LIFO stack of
+ * events linked through Event::nextInBin), so the service order is
+ * identical. Instead of a single sorted list of bins, the bins are
+ * hashed by time into an array of buckets ("days") of a fixed width.
+ * Each bucket holds a short sorted list of bins linked through
+ * Event::nextBin. Inserting an event only walks its own bucket, and
+ * finding the next event scans forward from the current day.
+ *
+ * The number of buckets follows the number of events, and the bucket
+ * width is re-estimated from the spacing of the earliest events every
+ * time the calendar is resized. This gives O(1) amortized insert and
+ * remove for the event distributions seen in practice.
+ *
+ * The calendar does not track the queue head. EventQueue keeps its head
+ * pointer and calls findMin() when the head bin is emptied.
+ */
+class CalendarQueue
+{
+  public:
+    CalendarQueue();
+
+    CalendarQueue(const CalendarQueue &) = delete;
+    CalendarQueue &operator=(const CalendarQueue &) = delete;
+
+    /** Insert an event, it becomes the top of its bin. */
+    void insert(Event *event);
+
+    /** Remove a scheduled event. */
+    void remove(Event *event);
+
+    /**
+     * Find the top of the earliest bin. All events in the calendar must
+     * be scheduled at or after the hint.
+     */
+    Event *findMin(Tick hint) const;
+
+    /** Remove all events and return them as a sorted list of bins. */
+    Event *drain();
+
+    /** All bins in service order. */
+    std::vector<Event *> bins() const;
+
+    size_t size() const { return numEvents; }
+    size_t numBuckets() const { return buckets.size(); }
+    Tick bucketWidth() const { return width; }
+
+  private:
+    /** Lower bound on the number of buckets */
+    static constexpr size_t MinBuckets = 16;
+    /** Number of leading bins used to estimate the bucket width */
+    static constexpr size_t WidthSamples = 32;
+
+    size_t bucketOf(Tick when) const { return (when / width) & mask; }
+
+    /** Link a whole bin into its bucket. */
+    void insertBin(Event *top);
+
+    /** Rebuild the calendar with the given number of buckets. */
+    void resize(size_t num_buckets);
+
+    /** Heads of the sorted bin lists, one per bucket. */
+    std::vector<Event *> buckets;
+    size_t mask;
+    Tick width;
+    size_t numEvents;
+};
+
+} // namespace gem5
+
+#endif // __SIM_CALENDAR_QUEUE_HH__
@@ -31,6 +31,7 @@
 #include "sim/eventq.hh"
 
 #include <cassert>
+#include <chrono>
 #include <iostream>
 #include <mutex>
 #include <string>
@@ -41,6 +42,7 @@
 #include "base/trace.hh"
 #include "cpu/smt.hh"
 #include "debug/Checkpoint.hh"
+#include "sim/calendar_queue.hh"
 
 namespace gem5
 {
@@ -134,9 +136,20 @@ Event::releaseImpl()
         delete this;
 }
 
+EventQueue::Backend EventQueue::defaultBackend = EventQueue::Backend::List;
+
 void
 EventQueue::insert(Event *event)
 {
+    if (calendar) {
+        calendar->insert(event);
+        // the event either starts a new earliest bin or was pushed on
+        // top of the head bin
+        if (!head || *event <= *head)
+            head = event;
+        return;
+    }
+
     // Deal with the head case
     if (!head || *event <= *head) {
         head = Event::insertBefore(event, head);
@@ -196,6 +209,13 @@ EventQueue::remove(Event *event)
 
     assert(event->queue == this);
 
+    if (calendar) {
+        calendar->remove(event);
+        if (event == head)
+            head = calendar->findMin(event->when());
+        return;
+    }
+
     // deal with an event on the head's 'in bin' list (event has the same
     // time as the head)
     if (*head == *event) {
@@ -228,7 +248,10 @@ EventQueue::serviceOne()
     Event *next = head->nextInBin;
     event->flags.clear(Event::Scheduled);
 
-    if (next) {
+    if (calendar) {
+        calendar->remove(event);
+        head = next ? next : calendar->findMin(event->when());
+    } else if (next) {
         // update the next bin pointer since it could be stale
         next->nextBin = head->nextBin;
 
@@ -321,15 +344,12 @@ EventQueue::dump() const
     if (empty())
         cprintf("<No Events>\n");
     else {
-        Event *nextBin = head;
-        while (nextBin) {
+        for (Event *nextBin : bins()) {
             Event *nextInBin = nextBin;
             while (nextInBin) {
                 nextInBin->dump();
                 nextInBin = nextInBin->nextInBin;
             }
-
-            nextBin = nextBin->nextBin;
         }
     }
 
@@ -344,8 +364,7 @@ EventQueue::debugVerify() const
     Tick time = 0;
     short priority = 0;
 
-    Event *nextBin = head;
-    while (nextBin) {
+    for (Event *nextBin : bins()) {
         Event *nextInBin = nextBin;
         while (nextInBin) {
             if (nextInBin->when() < time) {
@@ -371,21 +390,75 @@ EventQueue::debugVerify() const
 
             nextInBin = nextInBin->nextInBin;
         }
-
-        nextBin = nextBin->nextBin;
     }
 
     return true;
 }
 
+std::vector<Event *>
+EventQueue::bins() const
+{
+    if (calendar)
+        return calendar->bins();
+
+    std::vector<Event *> all;
+    for (Event *bin = head; bin; bin = bin->nextBin)
+        all.push_back(bin);
+    return all;
+}
+
 Event*
 EventQueue::replaceHead(Event* s)
 {
-    Event* t = head;
-    head = s;
+    if (!calendar) {
+        Event* t = head;
+        head = s;
+        return t;
+    }
+
+    // Hand out the current contents in the list format and load the new
+    // list into the calendar. Events of a bin are inserted bottom first
+    // so that the bin keeps its order.
+    Event *t = calendar->drain();
+    std::vector<Event *> stack;
+    for (Event *bin = s; bin;) {
+        Event *next_bin = bin->nextBin;
+        for (Event *e = bin; e; e = e->nextInBin)
+            stack.push_back(e);
+        while (!stack.empty()) {
+            calendar->insert(stack.back());
+            stack.pop_back();
+        }
+        bin = next_bin;
+    }
+    head = calendar->findMin(0);
     return t;
 }
 
+void
+EventQueue::setBackend(Backend backend)
+{
+    if (backend == getBackend())
+        return;
+
+    Event *events = replaceHead(nullptr);
+    if (backend == Backend::Calendar) {
+        calendar = new CalendarQueue;
+    } else {
+        delete calendar;
+        calendar = nullptr;
+    }
+    replaceHead(events);
+}
+
+void
+setEventQueueBackend(EventQueue::Backend backend)
+{
+    EventQueue::defaultBackend = backend;
+    for (uint32_t i = 0; i < numMainEventQueues; ++i)
+        mainEventQueue[i]->setBackend(backend);
+}
+
 void
 dumpMainQueue()
 {
@@ -442,30 +515,64 @@ Event::dump() const
 }
 
 EventQueue::EventQueue(const std::string &n)
-    : objName(n), head(NULL), _curTick(0)
+    : objName(n), head(NULL), _curTick(0), calendar(nullptr),
+      async_head(nullptr), asyncInserted(0), asyncMerges(0),
+      asyncMergeSeconds(0)
 {
+    setBackend(defaultBackend);
+}
+
+EventQueue::~EventQueue()
+{
+    while (!empty())
+        deschedule(getHead());
+    delete calendar;
 }
 
 void
 EventQueue::asyncInsert(Event *event)
 {
-    async_queue_mutex.lock();
-    async_queue.push_back(event);
-    async_queue_mutex.unlock();
+    Event *top = async_head.load(std::memory_order_relaxed);
+    do {
+        event->nextBin = top;
+    } while (!async_head.compare_exchange_weak(top, event,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed));
 }
 
 void
 EventQueue::handleAsyncInsertions()
 {
     assert(this == curEventQueue());
-    async_queue_mutex.lock();
 
-    while (!async_queue.empty()) {
-        insert(async_queue.front());
-        async_queue.pop_front();
+    // Cheap check first, this is called on every quantum boundary
+    if (!async_head.load(std::memory_order_relaxed))
+        return;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    Event *top = async_head.exchange(nullptr, std::memory_order_acquire);
+
+    // The inbox is a stack, reverse it so that events are merged in the
+    // order they were scheduled.
+    Event *fifo = nullptr;
+    while (top) {
+        Event *next = top->nextBin;
+        top->nextBin = fifo;
+        fifo = top;
+        top = next;
+    }
+
+    while (fifo) {
+        Event *next = fifo->nextBin;
+        insert(fifo);
+        fifo = next;
+        ++asyncInserted;
     }
 
-    async_queue_mutex.unlock();
+    ++asyncMerges;
+    asyncMergeSeconds += std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
 }
 
 } // namespace gem5
@@ -36,13 +36,14 @@
 #define __SIM_EVENTQ_HH__
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <climits>
 #include <functional>
 #include <iosfwd>
-#include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/debug.hh"
 #include "base/flags.hh"
@@ -60,6 +61,7 @@ namespace gem5
 
 class EventQueue;       // forward declaration
 class BaseGlobalEvent;
+class CalendarQueue;
 
 //! Simulation Quantum for multiple eventq simulation.
 //! The quantum value is the period length after which the queues
@@ -254,6 +256,7 @@ class EventBase
 class Event : public EventBase, public Serializable
 {
     friend class EventQueue;
+    friend class CalendarQueue;
 
   private:
     // The event queue is now a linked list of linked lists.  The
@@ -605,7 +608,7 @@ operator!=(const Event &l, const Event &r)
  * schedule() method with the 'global' parameter set to true. Unlike
  * the previous queue migration strategy, this strategy is fully
  * deterministic. This causes the event to be inserted in a separate
- * queue of asynchronous events (async_queue), which is merged main
+ * inbox of asynchronous events (async_head), which is merged main
  * event queue at the end of each simulation quantum (by calling the
  * handleAsyncInsertions() method). Note that this implies that such
  * events must happen at least one simulation quantum into the future,
@@ -621,11 +624,26 @@ class EventQueue
     Event *head;
     Tick _curTick;
 
-    //! Mutex to protect async queue.
-    UncontendedMutex async_queue_mutex;
+    //! Calendar backend, NULL when the sorted bin list is used.
+    CalendarQueue *calendar;
 
-    //! List of events added by other threads to this event queue.
-    std::list<Event*> async_queue;
+    /**
+     * Events added by other threads to this event queue.
+     *
+     * This is a lock-free multi-producer single-consumer stack linked
+     * through Event::nextBin, which is unused until the event is merged
+     * into the main queue. Producers push with a CAS, the owning thread
+     * takes the whole stack with a single exchange and merges it in
+     * handleAsyncInsertions().
+     */
+    std::atomic<Event *> async_head;
+
+    //! Number of events merged from the async inbox.
+    Counter asyncInserted;
+    //! Number of non-empty inbox merges.
+    Counter asyncMerges;
+    //! Host seconds spent merging the async inbox.
+    double asyncMergeSeconds;
 
     /**
      * Lock protecting event handling.
@@ -654,14 +672,36 @@ class EventQueue
     void insert(Event *event);
     void remove(Event *event);
 
-    //! Function for adding events to the async queue. The added events
+    //! Function for adding events to the async inbox. The added events
     //! are added to main event queue later. Threads, other than the
     //! owning thread, should call this function instead of insert().
+    //! Lock-free and safe to call from any number of threads.
     void asyncInsert(Event *event);
 
     EventQueue(const EventQueue &);
 
+    //! All bins of the queue in service order.
+    std::vector<Event *> bins() const;
+
   public:
+    /**
+     * Data structure used to keep events sorted. Both backends service
+     * events in exactly the same (when, priority, order) sequence.
+     *
+     * List keeps a sorted singly linked list of bins, with linear
+     * insertion cost. Calendar hashes bins into time buckets, with O(1)
+     * amortized insertion cost, which pays off for queues holding many
+     * events.
+     */
+    enum class Backend
+    {
+        List,
+        Calendar
+    };
+
+    /** Backend used by newly created event queues */
+    static Backend defaultBackend;
+
     class ScopedMigration
     {
       public:
@@ -901,10 +941,22 @@ class EventQueue
     bool debugVerify() const;
 
     /**
-     * Function for moving events from the async_queue to the main queue.
+     * Function for moving events from the async inbox to the main queue.
+     * Events are merged in the order they were inserted.
      */
     void handleAsyncInsertions();
 
+    /**
+     * Cross-queue scheduling counters. They are only updated by the
+     * owning thread and should be read while the simulation is not
+     * running in parallel.
+     * @{
+     */
+    Counter numAsyncInserted() const { return asyncInserted; }
+    Counter numAsyncMerges() const { return asyncMerges; }
+    double asyncMergeTime() const { return asyncMergeSeconds; }
+    /** @} */
+
     /**
      *  Function to signal that the event loop should be woken up because
      *  an event has been scheduled by an agent outside the gem5 event
@@ -932,6 +984,19 @@ class EventQueue
      */
     Event* replaceHead(Event* s);
 
+    /**
+     * Switch this queue to another backend. Scheduled events are
+     * migrated. Must not be called while the queue is being serviced by
+     * another thread.
+     *
+     * @ingroup api_eventq
+     */
+    void setBackend(Backend backend);
+    Backend getBackend() const
+    {
+        return calendar ? Backend::Calendar : Backend::List;
+    }
+
     /**@{*/
     /**
      * Provide an interface for locking/unlocking the event queue.
@@ -961,11 +1026,7 @@ class EventQueue
      */
     void checkpointReschedule(Event *event);
 
-    virtual ~EventQueue()
-    {
-        while (!empty())
-            deschedule(getHead());
-    }
+    virtual ~EventQueue();
 };
 
 inline void
@@ -977,6 +1038,9 @@ curEventQueue(EventQueue *q)
 
 void dumpMainQueue();
 
+//! Select the backend of all current and future main event queues.
+void setEventQueueBackend(EventQueue::Backend backend);
+
 class EventManager
 {
   protected:
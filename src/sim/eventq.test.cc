@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+class RecordingEvent : public Event
+{
+  public:
+    RecordingEvent(int _id, Priority p, std::vector<int> &_log)
+        : Event(p), id(_id), log(_log)
+    {}
+
+    void process() override { log.push_back(id); }
+
+    const int id;
+
+  private:
+    std::vector<int> &log;
+};
+
+/**
+ * Run the same pseudo-random mix of schedule, deschedule and reschedule
+ * operations on a queue and return the order in which events ran.
+ */
+std::vector<int>
+runWorkload(EventQueue::Backend backend, unsigned seed, int num_events,
+            Tick spread, bool switch_backend = false)
+{
+    std::vector<int> log;
+    EventQueue eq("test_queue");
+    eq.setBackend(backend);
+
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<Tick> when_dist(0, spread);
+    std::uniform_int_distribution<int> prio_dist(-2, 2);
+    std::uniform_int_distribution<int> op_dist(0, 9);
+
+    std::vector<std::unique_ptr<RecordingEvent>> events;
+    for (int i = 0; i < num_events; ++i) {
+        events.emplace_back(new RecordingEvent(i, prio_dist(rng), log));
+        eq.schedule(events.back().get(), when_dist(rng));
+    }
+
+    // Move some events around and drop some others
+    for (int i = 0; i < num_events; ++i) {
+        RecordingEvent *event = events[i].get();
+        int op = op_dist(rng);
+        if (op == 0 && event->scheduled()) {
+            eq.deschedule(event);
+        } else if (op == 1) {
+            eq.reschedule(event, when_dist(rng), true);
+        }
+    }
+
+    if (switch_backend) {
+        eq.setBackend(backend == EventQueue::Backend::List ?
+                      EventQueue::Backend::Calendar :
+                      EventQueue::Backend::List);
+    }
+
+    // Service half of the events, then keep scheduling while servicing
+    int serviced = 0;
+    while (!eq.empty() && serviced < num_events / 2) {
+        eq.serviceOne();
+        ++serviced;
+    }
+
+    for (int i = 0; i < num_events; ++i) {
+        RecordingEvent *event = events[i].get();
+        if (!event->scheduled() && op_dist(rng) < 3)
+            eq.schedule(event, eq.getCurTick() + when_dist(rng));
+    }
+
+    EXPECT_TRUE(eq.debugVerify());
+
+    while (!eq.empty())
+        eq.serviceOne();
+
+    return log;
+}
+
+} // anonymous namespace
+
+/** The calendar must service events in exactly the list's order. */
+TEST(EventQueueTest, CalendarMatchesList)
+{
+    for (unsigned seed = 0; seed < 8; ++seed) {
+        auto list = runWorkload(EventQueue::Backend::List, seed, 2000,
+                                100000);
+        auto calendar = runWorkload(EventQueue::Backend::Calendar, seed,
+                                    2000, 100000);
+        EXPECT_FALSE(list.empty());
+        EXPECT_EQ(list, calendar) << "seed " << seed;
+    }
+}
+
+/** Many events per tick exercise the in-bin ordering. */
+TEST(EventQueueTest, CalendarMatchesListDenseTicks)
+{
+    auto list = runWorkload(EventQueue::Backend::List, 42, 5000, 10);
+    auto calendar = runWorkload(EventQueue::Backend::Calendar, 42, 5000, 10);
+    EXPECT_EQ(list, calendar);
+}
+
+/** Events far apart force the calendar's direct search. */
+TEST(EventQueueTest, CalendarMatchesListSparse)
+{
+    auto list = runWorkload(EventQueue::Backend::List, 7, 500,
+                            1000000000000ULL);
+    auto calendar = runWorkload(EventQueue::Backend::Calendar, 7, 500,
+                                1000000000000ULL);
+    EXPECT_EQ(list, calendar);
+}
+
+/** Switching backends with events scheduled keeps the order. */
+TEST(EventQueueTest, SwitchBackend)
+{
+    auto list = runWorkload(EventQueue::Backend::List, 3, 1000, 50000);
+    auto switched = runWorkload(EventQueue::Backend::List, 3, 1000, 50000,
+                                true);
+    EXPECT_EQ(list, switched);
+
+    auto calendar = runWorkload(EventQueue::Backend::Calendar, 3, 1000,
+                                50000, true);
+    EXPECT_EQ(list, calendar);
+}
+
+/** replaceHead() hands out and takes back whole queues. */
+TEST(EventQueueTest, ReplaceHead)
+{
+    for (auto backend : {EventQueue::Backend::List,
+                         EventQueue::Backend::Calendar}) {
+        std::vector<int> log;
+        EventQueue eq("test_queue");
+        eq.setBackend(backend);
+
+        RecordingEvent a(0, Event::Default_Pri, log);
+        RecordingEvent b(1, Event::Default_Pri, log);
+        RecordingEvent c(2, Event::Default_Pri, log);
+        eq.schedule(&a, 20);
+        eq.schedule(&b, 10);
+
+        Event *saved = eq.replaceHead(nullptr);
+        ASSERT_TRUE(eq.empty());
+
+        eq.schedule(&c, 5);
+        eq.serviceOne();
+        ASSERT_TRUE(eq.empty());
+
+        eq.replaceHead(saved);
+        ASSERT_EQ(eq.getHead(), &b);
+        while (!eq.empty())
+            eq.serviceOne();
+
+        EXPECT_EQ(log, std::vector<int>({2, 1, 0}));
+    }
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Micro-benchmark comparing the EventQueue backends.
+ *
+ * Uses the classic hold model: a fixed number of events are pending and
+ * every serviced event schedules itself again a random delay into the
+ * future, so the queue size stays constant. The delays are multiples of
+ * a clock period, like most events in a simulated system.
+ */
+
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+class HoldEvent : public Event
+{
+  public:
+    HoldEvent(EventQueue &_eq, std::mt19937 &_rng)
+        : eq(_eq), rng(_rng), delay(1, 64)
+    {}
+
+    void
+    process() override
+    {
+        eq.schedule(this, eq.getCurTick() + delay(rng) * 500);
+    }
+
+  private:
+    EventQueue &eq;
+    std::mt19937 &rng;
+    std::uniform_int_distribution<Tick> delay;
+};
+
+double
+run(EventQueue::Backend backend, int pending, int services)
+{
+    EventQueue eq("bench_queue");
+    eq.setBackend(backend);
+
+    std::mt19937 rng(1);
+    std::vector<std::unique_ptr<HoldEvent>> events;
+    for (int i = 0; i < pending; ++i) {
+        events.emplace_back(new HoldEvent(eq, rng));
+        eq.schedule(events.back().get(), (i % 64) * 500);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < services; ++i)
+        eq.serviceOne();
+    const double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+    while (!eq.empty())
+        eq.deschedule(eq.getHead());
+
+    return services / seconds;
+}
+
+} // anonymous namespace
+
+int
+main()
+{
+    const int services = 2000000;
+
+    for (int pending : {16, 256, 4096, 65536}) {
+        double list = run(EventQueue::Backend::List, pending, services);
+        double calendar = run(EventQueue::Backend::Calendar, pending,
+                              services);
+        cprintf("%d pending events: list %.0f events/s, "
+                "calendar %.0f events/s (%.2fx)\n",
+                pending, list, calendar, calendar / list);
+    }
+
+    return 0;
+}
@@ -43,6 +43,7 @@
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/TimeSync.hh"
+#include "mem/mem_pool.hh"
 #include "sim/core.hh"
 #include "sim/cur_tick.hh"
 #include "sim/eventq.hh"
@@ -75,9 +76,29 @@ Root::RootStats::RootStats()
              "The number of ticks simulated per host second (ticks/s)"),
     ADD_STAT(hostMemory, statistics::units::Byte::get(),
              "Number of bytes of host memory used"),
+    ADD_STAT(asyncInserts, statistics::units::Count::get(),
+             "Number of events scheduled across event queues"),
+    ADD_STAT(asyncInsertRate, statistics::units::Rate<
+                statistics::units::Count, statistics::units::Second>::get(),
+             "Cross-queue events scheduled per host second"),
+    ADD_STAT(asyncMerges, statistics::units::Count::get(),
+             "Number of cross-queue inbox merges"),
+    ADD_STAT(asyncMergeSeconds, statistics::units::Second::get(),
+             "Real time spent merging cross-queue inboxes on the host"),
+    ADD_STAT(hostPoolAllocs, statistics::units::Count::get(),
+             "Number of allocations small enough for the memory pool"),
+    ADD_STAT(hostPoolHits, statistics::units::Count::get(),
+             "Number of allocations recycled from the memory pool"),
+    ADD_STAT(hostPoolHitRate, statistics::units::Ratio::get(),
+             "Fraction of allocations recycled from the memory pool"),
 
     statTime(true),
-    startTick(0)
+    startTick(0),
+    startAsyncInserts(0),
+    startAsyncMerges(0),
+    startAsyncMergeSeconds(0),
+    startPoolAllocs(0),
+    startPoolHits(0)
 {
     simFreq.scalar(sim_clock::Frequency);
     simTicks.functor([this]() { return curTick() - startTick; });
@@ -99,8 +120,75 @@ Root::RootStats::RootStats()
 
     hostTickRate.precision(0);
 
+    asyncInserts
+        .functor([this]() {
+                return totalAsyncInserts() - startAsyncInserts;
+            })
+        .flags(statistics::nozero)
+        ;
+
+    asyncMerges
+        .functor([this]() {
+                return totalAsyncMerges() - startAsyncMerges;
+            })
+        .flags(statistics::nozero)
+        ;
+
+    asyncMergeSeconds
+        .functor([this]() {
+                return totalAsyncMergeSeconds() - startAsyncMergeSeconds;
+            })
+        .flags(statistics::nozero)
+        .precision(6)
+        ;
+
+    hostPoolAllocs
+        .functor([this]() { return MemPool::allocs() - startPoolAllocs; })
+        .flags(statistics::nozero)
+        ;
+
+    hostPoolHits
+        .functor([this]() { return MemPool::hits() - startPoolHits; })
+        .flags(statistics::nozero)
+        ;
+
+    hostPoolHitRate.flags(statistics::nozero | statistics::nonan);
+    hostPoolHitRate.precision(4);
+
+    asyncInsertRate.flags(statistics::nozero | statistics::nonan);
+    asyncInsertRate.precision(0);
+
     simSeconds = simTicks / simFreq;
     hostTickRate = simTicks / hostSeconds;
+    asyncInsertRate = asyncInserts / hostSeconds;
+    hostPoolHitRate = hostPoolHits / hostPoolAllocs;
+}
+
+Counter
+Root::RootStats::totalAsyncInserts()
+{
+    Counter total = 0;
+    for (uint32_t i = 0; i < numMainEventQueues; ++i)
+        total += mainEventQueue[i]->numAsyncInserted();
+    return total;
+}
+
+Counter
+Root::RootStats::totalAsyncMerges()
+{
+    Counter total = 0;
+    for (uint32_t i = 0; i < numMainEventQueues; ++i)
+        total += mainEventQueue[i]->numAsyncMerges();
+    return total;
+}
+
+double
+Root::RootStats::totalAsyncMergeSeconds()
+{
+    double total = 0;
+    for (uint32_t i = 0; i < numMainEventQueues; ++i)
+        total += mainEventQueue[i]->asyncMergeTime();
+    return total;
 }
 
 void
@@ -108,6 +196,11 @@ Root::RootStats::resetStats()
 {
     statTime.setTimer();
     startTick = curTick();
+    startAsyncInserts = totalAsyncInserts();
+    startAsyncMerges = totalAsyncMerges();
+    startAsyncMergeSeconds = totalAsyncMergeSeconds();
+    startPoolAllocs = MemPool::allocs();
+    startPoolHits = MemPool::hits();
 
     statistics::Group::resetStats();
 }
@@ -187,6 +280,7 @@ Root::Root(const RootParams &p, int)
     lastTime.setTimer();
 
     simQuantum = p.sim_quantum;
+    Serializable::binaryFormat = p.binary_checkpoint;
 
     // Some of the statistics are global and need to be accessed by
     // stat formulas. The most convenient way to implement that is by
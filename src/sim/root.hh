@@ -110,6 +110,15 @@ class Root : public SimObject
         statistics::Formula hostTickRate;
         statistics::Value hostMemory;
 
+        statistics::Value asyncInserts;
+        statistics::Formula asyncInsertRate;
+        statistics::Value asyncMerges;
+        statistics::Value asyncMergeSeconds;
+
+        statistics::Value hostPoolAllocs;
+        statistics::Value hostPoolHits;
+        statistics::Formula hostPoolHitRate;
+
         static RootStats instance;
 
       private:
@@ -120,6 +129,20 @@ class Root : public SimObject
 
         Time statTime;
         Tick startTick;
+
+        /** Sum of the cross-queue counters over all main event queues */
+        static Counter totalAsyncInserts();
+        static Counter totalAsyncMerges();
+        static double totalAsyncMergeSeconds();
+
+        /** Cross-queue scheduling counters at the last stats reset */
+        Counter startAsyncInserts;
+        Counter startAsyncMerges;
+        double startAsyncMergeSeconds;
+
+        /** Memory pool counters at the last stats reset */
+        Counter startPoolAllocs;
+        Counter startPoolHits;
     };
 
   public:
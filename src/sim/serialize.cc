@@ -59,6 +59,23 @@ int ckptMaxCount = 0;
 int ckptCount = 0;
 int ckptPrevCount = -1;
 std::stack<std::string> Serializable::path;
+bool Serializable::binaryFormat = false;
+
+namespace
+{
+
+/** Create the checkpoint directory and return the cpt file path. */
+std::string
+checkpointFile(const std::string &cpt_dir)
+{
+    std::string dir = CheckpointIn::setDir(cpt_dir);
+    if (mkdir(dir.c_str(), 0775) == -1 && errno != EEXIST)
+            fatal("couldn't mkdir %s\n", dir);
+
+    return dir + CheckpointIn::baseFilename;
+}
+
+} // anonymous namespace
 
 /////////////////////////////
 
@@ -88,11 +105,7 @@ void
 Serializable::generateCheckpointOut(const std::string &cpt_dir,
         std::ofstream &outstream)
 {
-    std::string dir = CheckpointIn::setDir(cpt_dir);
-    if (mkdir(dir.c_str(), 0775) == -1 && errno != EEXIST)
-            fatal("couldn't mkdir %s\n", dir);
-
-    std::string cpt_file = dir + CheckpointIn::baseFilename;
+    std::string cpt_file = checkpointFile(cpt_dir);
     outstream = std::ofstream(cpt_file.c_str());
     time_t t = time(NULL);
     if (!outstream)
@@ -100,6 +113,17 @@ Serializable::generateCheckpointOut(const std::string &cpt_dir,
     outstream << "## checkpoint generated: " << ctime(&t);
 }
 
+std::unique_ptr<CheckpointOut>
+Serializable::generateCheckpointOut(const std::string &cpt_dir)
+{
+    if (binaryFormat)
+        return std::make_unique<BinaryCheckpointOut>(checkpointFile(cpt_dir));
+
+    auto outstream = std::make_unique<std::ofstream>();
+    generateCheckpointOut(cpt_dir, *outstream);
+    return outstream;
+}
+
 Serializable::ScopedCheckpointSection::~ScopedCheckpointSection()
 {
     assert(!path.empty());
@@ -123,7 +147,10 @@ Serializable::ScopedCheckpointSection::nameOut(CheckpointOut &cp)
 {
     DPRINTF(Checkpoint, "ScopedCheckpointSection::nameOut: %s\n",
             Serializable::currentSection());
-    cp << "\n[" << Serializable::currentSection() << "]\n";
+    if (auto *bin = BinaryCheckpointOut::get(cp))
+        bin->section(Serializable::currentSection());
+    else
+        cp << "\n[" << Serializable::currentSection() << "]\n";
 }
 
 const std::string &
@@ -163,7 +190,11 @@ CheckpointIn::CheckpointIn(const std::string &cpt_dir)
     : db(), _cptDir(setDir(cpt_dir))
 {
     std::string filename = getCptDir() + "/" + CheckpointIn::baseFilename;
-    if (!db.load(filename)) {
+    if (BinaryCheckpointIn::isBinary(filename)) {
+        bin = std::make_unique<BinaryCheckpointIn>();
+        if (!bin->load(filename))
+            fatal("Can't load checkpoint file '%s'\n", filename);
+    } else if (!db.load(filename)) {
         fatal("Can't load checkpoint file '%s'\n", filename);
     }
 }
@@ -180,7 +211,8 @@ CheckpointIn::CheckpointIn(const std::string &cpt_dir)
 bool
 CheckpointIn::entryExists(const std::string &section, const std::string &entry)
 {
-    return db.entryExists(section, entry);
+    return bin ? bin->entryExists(section, entry) :
+        db.entryExists(section, entry);
 }
 /**
  * @param section Here we mention the section we are looking for
@@ -196,20 +228,35 @@ bool
 CheckpointIn::find(const std::string &section, const std::string &entry,
         std::string &value)
 {
-    return db.find(section, entry, value);
+    return bin ? bin->find(section, entry, value) :
+        db.find(section, entry, value);
+}
+
+const BinaryCheckpointIn::Entry *
+CheckpointIn::findArray(const std::string &section, const std::string &entry,
+        uint8_t type)
+{
+    if (!bin)
+        return nullptr;
+    const BinaryCheckpointIn::Entry *e = bin->findEntry(section, entry);
+    return e && e->kind == binary_checkpoint::ArrayEntry && e->type == type ?
+        e : nullptr;
 }
 
 bool
 CheckpointIn::sectionExists(const std::string &section)
 {
-    return db.sectionExists(section);
+    return bin ? bin->sectionExists(section) : db.sectionExists(section);
 }
 
 void
 CheckpointIn::visitSection(const std::string &section,
     IniFile::VisitSectionCallback cb)
 {
-    db.visitSection(section, cb);
+    if (bin)
+        bin->visitSection(section, cb);
+    else
+        db.visitSection(section, cb);
 }
 
 } // namespace gem5
@@ -47,9 +47,11 @@
 
 
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <iterator>
+#include <memory>
 #include <stack>
 #include <string>
 #include <type_traits>
@@ -58,6 +60,7 @@
 
 #include "base/inifile.hh"
 #include "base/logging.hh"
+#include "sim/serialize_binary.hh"
 #include "sim/serialize_handlers.hh"
 
 namespace gem5
@@ -69,6 +72,8 @@ class CheckpointIn
 {
   private:
     IniFile db;
+    /** The checkpoint if it is in the binary format, used instead of db. */
+    std::unique_ptr<BinaryCheckpointIn> bin;
 
     const std::string _cptDir;
 
@@ -93,6 +98,16 @@ class CheckpointIn
         IniFile::VisitSectionCallback cb);
     /** @}*/ //end of api_checkout group
 
+    /**
+     * Look up an array stored as raw elements in a binary checkpoint.
+     *
+     * @param type The element type the caller wants.
+     * @return The entry, or nullptr if the checkpoint is not binary or
+     *         the entry has to be parsed from text.
+     */
+    const BinaryCheckpointIn::Entry *findArray(const std::string &section,
+        const std::string &entry, uint8_t type);
+
     // The following static functions have to do with checkpoint
     // creation rather than restoration.  This class makes a handy
     // namespace for them though.  Currently no Checkpoint object is
@@ -311,6 +326,19 @@ class Serializable
     static void generateCheckpointOut(const std::string &cpt_dir,
         std::ofstream &outstream);
 
+    /**
+     * Generate a checkpoint file in the format picked by binaryFormat.
+     *
+     * @param cpt_dir The dir at which the cpt file will be created.
+     * @return The cpt file, which is complete when it is destroyed.
+     * @ingroup api_serialize
+     */
+    static std::unique_ptr<CheckpointOut> generateCheckpointOut(
+        const std::string &cpt_dir);
+
+    /** Whether new checkpoints use the binary format rather than INI. */
+    static bool binaryFormat;
+
   private:
     static std::stack<std::string> path;
 };
@@ -326,6 +354,12 @@ template <class T>
 void
 paramOut(CheckpointOut &os, const std::string &name, const T &param)
 {
+    if (auto *bin = BinaryCheckpointOut::get(os)) {
+        ShowParam<T>::show(bin->beginEntry(), param);
+        bin->endEntry(name);
+        return;
+    }
+
     os << name << "=";
     ShowParam<T>::show(os, param);
     os << "\n";
@@ -388,15 +422,36 @@ void
 arrayParamOut(CheckpointOut &os, const std::string &name,
               InputIterator start, InputIterator end)
 {
-    os << name << "=";
-    auto it = start;
-    using Elem = std::remove_cv_t<std::remove_reference_t<decltype(*it)>>;
-    if (it != end)
-        ShowParam<Elem>::show(os, *it++);
-    while (it != end) {
-        os << " ";
-        ShowParam<Elem>::show(os, *it++);
+    using Elem = std::remove_cv_t<std::remove_reference_t<decltype(*start)>>;
+    auto show = [start, end](std::ostream &os) {
+        auto it = start;
+        if (it != end)
+            ShowParam<Elem>::show(os, *it++);
+        while (it != end) {
+            os << " ";
+            ShowParam<Elem>::show(os, *it++);
+        }
+    };
+
+    if (auto *bin = BinaryCheckpointOut::get(os)) {
+        constexpr uint8_t type = binary_checkpoint::elemType<Elem>();
+        if constexpr (type == 0) {
+            show(bin->beginEntry());
+            bin->endEntry(name);
+        } else if constexpr (std::is_pointer_v<InputIterator>) {
+            bin->array(name, type, start, end - start);
+        } else {
+            // Gather the elements, as bools one byte each
+            using Raw = std::conditional_t<std::is_same_v<Elem, bool>,
+                                           uint8_t, Elem>;
+            const std::vector<Raw> elems(start, end);
+            bin->array(name, type, elems.data(), elems.size());
+        }
+        return;
     }
+
+    os << name << "=";
+    show(os);
     os << "\n";
 }
 
@@ -442,6 +497,23 @@ arrayParamIn(CheckpointIn &cp, const std::string &name,
              InsertIterator inserter, ssize_t fixed_size=-1)
 {
     const std::string &section = Serializable::currentSection();
+
+    constexpr uint8_t type = binary_checkpoint::elemType<T>();
+    if constexpr (type != 0) {
+        if (auto *entry = cp.findArray(section, name, type)) {
+            fatal_if(fixed_size >= 0 && entry->count != fixed_size,
+                     "Array size mismatch on %s:%s (Got %u, expected %u)'\n",
+                     section, name, entry->count, fixed_size);
+            for (uint64_t i = 0; i < entry->count; i++) {
+                T value;
+                std::memcpy(&value, entry->data.data() + i * sizeof(T),
+                            sizeof(T));
+                *inserter = value;
+            }
+            return;
+        }
+    }
+
     std::string str;
     fatal_if(!cp.find(section, name, str),
         "Can't unserialize '%s:%s'.", section, name);
@@ -37,6 +37,7 @@
 #include <cstdint>
 #include <deque>
 #include <fstream>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <set>
@@ -1366,3 +1367,218 @@ TEST_F(SerializeFixture, SerializeMapping)
         ASSERT_THAT(reals, testing::ElementsAre(0.1, 1.345, 892.72, 1e+10));
     }
 }
+
+/** @return Whether the file at path is a binary checkpoint. */
+bool
+isBinaryCpt(const std::string &path)
+{
+    return BinaryCheckpointIn::isBinary(path);
+}
+
+/** Test that arrays round trip through a binary checkpoint. */
+TEST_F(SerializeFixture, BinaryArrayParamOutIn)
+{
+    const int integer[] = {5, 10, 15};
+    std::array<double, 4> real = {0.1, 1.345, 892.72, 1e+10};
+    std::list<bool> boolean = {true, false};
+    std::vector<std::string> str = {"a", "string", "test"};
+    std::set<uint64_t> uint64 = {12751928501, 13, 111111};
+    std::deque<uint8_t> uint8 = {17, 42, 255};
+
+    {
+        BinaryCheckpointOut cpt(getCptPath());
+        Serializable::ScopedCheckpointSection scs(cpt, "Section1");
+        arrayParamOut(cpt, "Param1", integer);
+        arrayParamOut(cpt, "Param2", real);
+        arrayParamOut(cpt, "Param3", boolean);
+        arrayParamOut(cpt, "Param4", str);
+        arrayParamOut(cpt, "Param5", uint64);
+        arrayParamOut(cpt, "Param6", uint8);
+    }
+    ASSERT_TRUE(isBinaryCpt(getCptPath()));
+
+    CheckpointIn cpt(getDirName());
+
+    int unserialized_integer[3];
+    std::array<double, 4> unserialized_real;
+    std::list<bool> unserialized_boolean;
+    std::vector<std::string> unserialized_str;
+    std::set<uint64_t> unserialized_uint64;
+    std::deque<uint8_t> unserialized_uint8;
+
+    Serializable::ScopedCheckpointSection scs(cpt, "Section1");
+
+    arrayParamIn(cpt, "Param1", unserialized_integer, 3);
+    ASSERT_THAT(unserialized_integer, testing::ElementsAre(5, 10, 15));
+
+    arrayParamIn(cpt, "Param2", unserialized_real.data(),
+        unserialized_real.size());
+    ASSERT_EQ(real, unserialized_real);
+
+    arrayParamIn(cpt, "Param3", unserialized_boolean);
+    ASSERT_EQ(boolean, unserialized_boolean);
+
+    arrayParamIn(cpt, "Param4", unserialized_str);
+    ASSERT_EQ(str, unserialized_str);
+
+    arrayParamIn(cpt, "Param5", unserialized_uint64);
+    ASSERT_EQ(uint64, unserialized_uint64);
+
+    arrayParamIn(cpt, "Param6", unserialized_uint8);
+    ASSERT_EQ(uint8, unserialized_uint8);
+
+    // Raw arrays read as the text the INI format would hold
+    std::string value;
+    ASSERT_TRUE(cpt.find("Section1", "Param1", value));
+    ASSERT_EQ(value, "5 10 15");
+    ASSERT_TRUE(cpt.find("Section1", "Param2", value));
+    ASSERT_EQ(value, "0.1 1.345 892.72 1e+10");
+    ASSERT_TRUE(cpt.find("Section1", "Param3", value));
+    ASSERT_EQ(value, "true false");
+    ASSERT_TRUE(cpt.find("Section1", "Param6", value));
+    ASSERT_EQ(value, "17 42 255");
+}
+
+/** Test reading an array as another element type than it was written. */
+TEST_F(SerializeFixture, BinaryArrayOtherType)
+{
+    const std::vector<uint32_t> narrow = {1, 2, 4000000000};
+    {
+        BinaryCheckpointOut cpt(getCptPath());
+        Serializable::ScopedCheckpointSection scs(cpt, "Section1");
+        arrayParamOut(cpt, "Param1", narrow);
+    }
+
+    CheckpointIn cpt(getDirName());
+    Serializable::ScopedCheckpointSection scs(cpt, "Section1");
+    std::vector<uint64_t> wide;
+    arrayParamIn(cpt, "Param1", wide);
+    ASSERT_THAT(wide, testing::ElementsAre(1, 2, 4000000000));
+}
+
+/** Test that a fixed size array read from a binary checkpoint is checked. */
+TEST_F(SerializeFixtureDeathTest, BinaryArrayParamOutInSmaller)
+{
+    const int integer[] = {5, 10, 15};
+    {
+        BinaryCheckpointOut cpt(getCptPath());
+        Serializable::ScopedCheckpointSection scs(cpt, "Section1");
+        arrayParamOut(cpt, "Param1", integer);
+    }
+
+    CheckpointIn cpt(getDirName());
+    Serializable::ScopedCheckpointSection scs(cpt, "Section1");
+    int unserialized_integer[2];
+    ASSERT_ANY_THROW(arrayParamIn(cpt, "Param1", unserialized_integer, 2));
+}
+
+/** Test that an array of an unknown element type is reported. */
+TEST_F(SerializeFixtureDeathTest, BinaryArrayUnknownType)
+{
+    const int integer[] = {5, 10, 15};
+    {
+        BinaryCheckpointOut cpt(getCptPath());
+        Serializable::ScopedCheckpointSection scs(cpt, "Section1");
+        arrayParamOut(cpt, "Param1", integer);
+    }
+
+    // The element type follows the name of the entry
+    std::string contents;
+    {
+        std::ifstream is(getCptPath(), std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(is), {});
+    }
+    const size_t pos = contents.find("Param1");
+    ASSERT_NE(pos, std::string::npos);
+    contents[pos + 6] = 0x7f;
+    std::ofstream(getCptPath(), std::ios::binary) << contents;
+
+    CheckpointIn cpt(getDirName());
+    std::string value;
+    gtestLogOutput.str("");
+    ASSERT_ANY_THROW(cpt.find("Section1", "Param1", value));
+    ASSERT_THAT(gtestLogOutput.str(), ::testing::HasSubstr(
+        "Unknown element type 0x7f of Param1 in section Section1 of "
+        "checkpoint "));
+}
+
+/**
+ * Test sections, scalars and text written to the stream directly in a
+ * binary checkpoint.
+ */
+TEST_F(SerializeFixture, BinarySections)
+{
+    {
+        BinaryCheckpointOut cpt(getCptPath());
+        {
+            Serializable::ScopedCheckpointSection scs(cpt, "Section1");
+            paramOut(cpt, "Param1", 42);
+            paramOut(cpt, "Param2", std::string("a string"));
+            cpt << "Param3=  direct \n";
+            Serializable::ScopedCheckpointSection scs2(cpt, "Section2");
+            paramOut(cpt, "Param1", true);
+        }
+        cpt << "\n[Section3]\nParam1=3\n";
+        {
+            // Entries of a section opened again are merged
+            Serializable::ScopedCheckpointSection scs(cpt, "Section1");
+            paramOut(cpt, "Param1", 43);
+            paramOut(cpt, "Param4", 4.5);
+        }
+    }
+    ASSERT_TRUE(isBinaryCpt(getCptPath()));
+
+    CheckpointIn cpt(getDirName());
+    ASSERT_TRUE(cpt.sectionExists("Section1"));
+    ASSERT_TRUE(cpt.sectionExists("Section1.Section2"));
+    ASSERT_TRUE(cpt.sectionExists("Section3"));
+    ASSERT_FALSE(cpt.sectionExists("Section2"));
+    ASSERT_TRUE(cpt.entryExists("Section1", "Param3"));
+    ASSERT_FALSE(cpt.entryExists("Section1", "Param5"));
+    ASSERT_FALSE(cpt.entryExists("Section4", "Param1"));
+
+    std::string value;
+    ASSERT_TRUE(cpt.find("Section1", "Param1", value));
+    ASSERT_EQ(value, "43");
+    ASSERT_TRUE(cpt.find("Section1", "Param2", value));
+    ASSERT_EQ(value, "a string");
+    ASSERT_TRUE(cpt.find("Section1", "Param3", value));
+    ASSERT_EQ(value, "direct");
+    ASSERT_TRUE(cpt.find("Section1.Section2", "Param1", value));
+    ASSERT_EQ(value, "true");
+    ASSERT_TRUE(cpt.find("Section3", "Param1", value));
+    ASSERT_EQ(value, "3");
+
+    std::vector<std::string> visited;
+    cpt.visitSection("Section1",
+        [&visited](const std::string &name, const std::string &value) {
+            visited.push_back(name + "=" + value);
+        });
+    ASSERT_THAT(visited, testing::ElementsAre("Param1=43",
+        "Param2=a string", "Param3=direct", "Param4=4.5"));
+
+    Serializable::ScopedCheckpointSection scs(cpt, "Section1");
+    double real;
+    paramIn(cpt, "Param4", real);
+    ASSERT_EQ(real, 4.5);
+}
+
+/** Test generating a checkpoint in the binary format. */
+TEST_F(SerializeFixture, GenerateBinaryCptOut)
+{
+    Serializable::binaryFormat = true;
+    {
+        std::unique_ptr<CheckpointOut> cpt =
+            Serializable::generateCheckpointOut(getDirName());
+        Serializable::ScopedCheckpointSection scs(*cpt, "Section1");
+        paramOut(*cpt, "Param1", 1);
+    }
+    Serializable::binaryFormat = false;
+    ASSERT_TRUE(isBinaryCpt(getCptPath()));
+
+    {
+        std::unique_ptr<CheckpointOut> cpt =
+            Serializable::generateCheckpointOut(getDirName());
+    }
+    ASSERT_FALSE(isBinaryCpt(getCptPath()));
+}
@@ -0,0 +1,465 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/serialize_binary.hh"
+
+#include <cstring>
+
+#include "base/compiler.hh"
+#include "base/logging.hh"
+#include "base/str.hh"
+#include "sim/serialize_handlers.hh"
+
+namespace gem5
+{
+
+using namespace binary_checkpoint;
+
+const int BinaryCheckpointOut::pwordIndex = std::ios_base::xalloc();
+
+BinaryCheckpointOut::BinaryCheckpointOut(const std::string &filename)
+    : std::ostream(&direct), file(filename, std::ios::binary),
+      filename(filename), offset(sizeof(Header))
+{
+    fatal_if(!file, "Unable to open file %s for writing\n", filename);
+    pword(pwordIndex) = this;
+
+    // The header is filled in by close()
+    Header header = {};
+    file.write((const char *)&header, sizeof(header));
+}
+
+BinaryCheckpointOut::~BinaryCheckpointOut()
+{
+    if (file.is_open())
+        close();
+}
+
+void
+BinaryCheckpointOut::putString(const std::string &str)
+{
+    uint32_t len = str.size();
+    put(&len, sizeof(len));
+    put(str.data(), len);
+}
+
+void
+BinaryCheckpointOut::putName(uint8_t kind, const std::string &name)
+{
+    put(&kind, sizeof(kind));
+    putString(name);
+}
+
+void
+BinaryCheckpointOut::section(const std::string &name)
+{
+    flushText();
+    flushSection();
+    current = name;
+    inSection = true;
+}
+
+std::ostream &
+BinaryCheckpointOut::beginEntry()
+{
+    flushText();
+    value.str("");
+    return value;
+}
+
+void
+BinaryCheckpointOut::endEntry(const std::string &name)
+{
+    const std::string text = value.str();
+    uint64_t len = text.size();
+    putName(TextEntry, name);
+    put(&len, sizeof(len));
+    put(text.data(), len);
+}
+
+void
+BinaryCheckpointOut::array(const std::string &name, uint8_t type,
+                           const void *data, uint64_t count)
+{
+    flushText();
+    putName(ArrayEntry, name);
+    put(&type, sizeof(type));
+    put(&count, sizeof(count));
+    put(data, count * elemSize(type));
+}
+
+void
+BinaryCheckpointOut::flushText()
+{
+    if (direct.pubseekoff(0, std::ios_base::cur, std::ios_base::out) <= 0)
+        return;
+
+    // Split the text into lines the way IniFile would
+    std::istringstream lines(direct.str());
+    direct.str("");
+    std::string line;
+    while (std::getline(lines, line)) {
+        eat_white(line);
+        if (line.empty())
+            continue;
+        if (line.front() == '[' && line.back() == ']') {
+            std::string name = line.substr(1, line.size() - 2);
+            eat_white(name);
+            section(name);
+            continue;
+        }
+        auto eq = line.find('=');
+        if (eq == std::string::npos)
+            continue;
+        std::string name = line.substr(0, eq);
+        std::string text = line.substr(eq + 1);
+        eat_white(name);
+        eat_white(text);
+        beginEntry() << text;
+        endEntry(name);
+    }
+}
+
+void
+BinaryCheckpointOut::flushSection()
+{
+    if (inSection) {
+        index.push_back({current, offset, buf.size()});
+        file.write(buf.data(), buf.size());
+        offset += buf.size();
+    }
+    buf.clear();
+}
+
+void
+BinaryCheckpointOut::close()
+{
+    flushText();
+    flushSection();
+    inSection = false;
+
+    for (const auto &sec: index) {
+        putString(sec.name);
+        put(&sec.offset, sizeof(sec.offset));
+        put(&sec.length, sizeof(sec.length));
+    }
+    file.write(buf.data(), buf.size());
+    buf.clear();
+
+    Header header = {};
+    std::memcpy(header.magic, Magic, sizeof(header.magic));
+    header.version = Version;
+    header.byteOrder = ByteOrder;
+    header.numSections = index.size();
+    header.indexOffset = offset;
+    file.seekp(0);
+    file.write((const char *)&header, sizeof(header));
+    file.close();
+    fatal_if(!file, "Error writing checkpoint file %s\n", filename);
+}
+
+namespace
+{
+
+/** Reads the fields of a section or the index out of a buffer. */
+class Cursor
+{
+  public:
+    Cursor(const std::string &buf) : buf(buf) {}
+
+    bool done() const { return pos == buf.size(); }
+
+    template <class T>
+    bool
+    get(T &value)
+    {
+        if (buf.size() - pos < sizeof(T))
+            return false;
+        std::memcpy(&value, buf.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+
+    bool
+    get(std::string &value, uint64_t len)
+    {
+        if (buf.size() - pos < len)
+            return false;
+        value.assign(buf, pos, len);
+        pos += len;
+        return true;
+    }
+
+    bool
+    getString(std::string &value)
+    {
+        uint32_t len;
+        return get(len) && get(value, len);
+    }
+
+  private:
+    const std::string &buf;
+    size_t pos = 0;
+};
+
+template <class T>
+void
+showElems(std::ostream &os, const std::string &data, uint64_t count)
+{
+    for (uint64_t i = 0; i < count; i++) {
+        T value;
+        std::memcpy(&value, data.data() + i * sizeof(T), sizeof(T));
+        if (i)
+            os << " ";
+        ShowParam<T>::show(os, value);
+    }
+}
+
+/** @return Whether type is the element type of an array entry. */
+bool
+knownElemType(uint8_t type)
+{
+    for (uint8_t known: {elemType<int8_t>(), elemType<int16_t>(),
+                         elemType<int32_t>(), elemType<int64_t>(),
+                         elemType<uint8_t>(), elemType<uint16_t>(),
+                         elemType<uint32_t>(), elemType<uint64_t>(),
+                         elemType<float>(), elemType<double>(),
+                         elemType<bool>()}) {
+        if (type == known)
+            return true;
+    }
+    return false;
+}
+
+} // anonymous namespace
+
+bool
+BinaryCheckpointIn::isBinary(const std::string &filename)
+{
+    std::ifstream f(filename, std::ios::binary);
+    char magic[sizeof(Magic)];
+    return f.read(magic, sizeof(magic)) &&
+        std::memcmp(magic, Magic, sizeof(magic)) == 0;
+}
+
+bool
+BinaryCheckpointIn::load(const std::string &filename)
+{
+    this->filename = filename;
+    file.open(filename, std::ios::binary);
+    Header header;
+    if (!file.read((char *)&header, sizeof(header)) ||
+            std::memcmp(header.magic, Magic, sizeof(Magic)) != 0) {
+        return false;
+    }
+    fatal_if(header.byteOrder != ByteOrder,
+             "Checkpoint %s was written on a host of another byte order\n",
+             filename);
+    fatal_if(header.version != Version,
+             "Checkpoint %s has unsupported binary version %d\n",
+             filename, header.version);
+
+    file.seekg(0, std::ios::end);
+    const uint64_t end = file.tellg();
+    if (header.indexOffset > end)
+        return false;
+    std::string buf(end - header.indexOffset, '\0');
+    file.seekg(header.indexOffset);
+    if (!file.read(&buf[0], buf.size()))
+        return false;
+
+    Cursor cur(buf);
+    for (uint64_t i = 0; i < header.numSections; i++) {
+        std::string name;
+        uint64_t offset, length;
+        if (!cur.getString(name) || !cur.get(offset) || !cur.get(length) ||
+                offset + length > header.indexOffset) {
+            return false;
+        }
+        // A section that is opened again gets another extent, and its
+        // entries are merged like those of a repeated INI section
+        auto [it, inserted] = sections.try_emplace(name);
+        if (inserted)
+            names.push_back(name);
+        it->second.extents.emplace_back(offset, length);
+    }
+    return cur.done();
+}
+
+BinaryCheckpointIn::Section *
+BinaryCheckpointIn::getSection(const std::string &name)
+{
+    auto it = sections.find(name);
+    if (it == sections.end())
+        return nullptr;
+
+    Section &sec = it->second;
+    if (sec.loaded)
+        return &sec;
+
+    for (const auto &[offset, length]: sec.extents) {
+        std::string buf(length, '\0');
+        file.seekg(offset);
+        fatal_if(!file.read(&buf[0], length),
+                 "Error reading section %s of checkpoint %s\n",
+                 name, filename);
+
+        Cursor cur(buf);
+        while (!cur.done()) {
+            uint8_t kind;
+            std::string entry_name;
+            Entry entry = {};
+            bool ok = cur.get(kind) && cur.getString(entry_name);
+            entry.kind = EntryKind(kind);
+            if (ok && kind == TextEntry) {
+                ok = cur.get(entry.count) && cur.get(entry.data, entry.count);
+            } else if (ok && kind == ArrayEntry) {
+                ok = cur.get(entry.type);
+                fatal_if(ok && !knownElemType(entry.type),
+                         "Unknown element type %#x of %s in section %s of "
+                         "checkpoint %s\n", unsigned(entry.type),
+                         entry_name, name, filename);
+                ok = ok && cur.get(entry.count) &&
+                    cur.get(entry.data, entry.count * elemSize(entry.type));
+            } else {
+                ok = false;
+            }
+            fatal_if(!ok, "Corrupt section %s in checkpoint %s\n",
+                     name, filename);
+
+            // Later entries of the same name replace earlier ones
+            auto [pos, inserted] =
+                sec.byName.try_emplace(entry_name, sec.entries.size());
+            if (inserted) {
+                sec.entries.emplace_back(std::move(entry_name),
+                                         std::move(entry));
+            } else {
+                sec.entries[pos->second].second = std::move(entry);
+            }
+        }
+    }
+    sec.loaded = true;
+    return &sec;
+}
+
+const BinaryCheckpointIn::Entry *
+BinaryCheckpointIn::findEntry(const std::string &section,
+                              const std::string &entry)
+{
+    Section *sec = getSection(section);
+    if (!sec)
+        return nullptr;
+    auto it = sec->byName.find(entry);
+    return it == sec->byName.end() ? nullptr :
+        &sec->entries[it->second].second;
+}
+
+std::string
+BinaryCheckpointIn::text(const Entry &entry)
+{
+    if (entry.kind == TextEntry)
+        return entry.data;
+
+    std::ostringstream os;
+    switch (entry.type) {
+      case elemType<int8_t>():
+        showElems<int8_t>(os, entry.data, entry.count);
+        break;
+      case elemType<int16_t>():
+        showElems<int16_t>(os, entry.data, entry.count);
+        break;
+      case elemType<int32_t>():
+        showElems<int32_t>(os, entry.data, entry.count);
+        break;
+      case elemType<int64_t>():
+        showElems<int64_t>(os, entry.data, entry.count);
+        break;
+      case elemType<uint8_t>():
+        showElems<uint8_t>(os, entry.data, entry.count);
+        break;
+      case elemType<uint16_t>():
+        showElems<uint16_t>(os, entry.data, entry.count);
+        break;
+      case elemType<uint32_t>():
+        showElems<uint32_t>(os, entry.data, entry.count);
+        break;
+      case elemType<uint64_t>():
+        showElems<uint64_t>(os, entry.data, entry.count);
+        break;
+      case elemType<float>():
+        showElems<float>(os, entry.data, entry.count);
+        break;
+      case elemType<double>():
+        showElems<double>(os, entry.data, entry.count);
+        break;
+      case elemType<bool>():
+        showElems<bool>(os, entry.data, entry.count);
+        break;
+      default:
+        // Element types are checked when their section is loaded
+        GEM5_UNREACHABLE;
+    }
+    return os.str();
+}
+
+bool
+BinaryCheckpointIn::find(const std::string &section, const std::string &entry,
+                         std::string &value)
+{
+    const Entry *e = findEntry(section, entry);
+    if (!e)
+        return false;
+    value = text(*e);
+    return true;
+}
+
+bool
+BinaryCheckpointIn::entryExists(const std::string &section,
+                                const std::string &entry)
+{
+    return findEntry(section, entry) != nullptr;
+}
+
+bool
+BinaryCheckpointIn::sectionExists(const std::string &section)
+{
+    return sections.count(section) != 0;
+}
+
+void
+BinaryCheckpointIn::visitSection(const std::string &section,
+                                 IniFile::VisitSectionCallback cb)
+{
+    Section *sec = getSection(section);
+    if (!sec)
+        return;
+    for (const auto &[name, entry]: sec->entries)
+        cb(name, text(entry));
+}
+
+} // namespace gem5
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* @file
+ * Binary checkpoint section format
+ */
+
+#ifndef __SIM_SERIALIZE_BINARY_HH__
+#define __SIM_SERIALIZE_BINARY_HH__
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/inifile.hh"
+
+namespace gem5
+{
+
+/**
+ * A binary alternative to the INI text of m5.cpt, with the same sections
+ * and entries.
+ *
+ * A file starts with a Header, followed by the entries of one section
+ * after another, and ends with one index record per section at
+ * Header::indexOffset, so that a reader can go straight to the sections
+ * it needs. Scalars are kept as the text the INI format would hold.
+ * Arrays of arithmetic types are kept as raw elements instead, which
+ * saves formatting and parsing them one by one. All fields are in host
+ * byte order.
+ *
+ * Entry:  u8 kind, u32 name length, name, then for a TextEntry u64
+ *         length and the text, and for an ArrayEntry u8 element type,
+ *         u64 element count and the elements.
+ * Index:  u32 name length, name, u64 offset, u64 length.
+ */
+namespace binary_checkpoint
+{
+
+constexpr char Magic[8] = "gem5cpt";
+constexpr uint32_t Version = 1;
+constexpr uint32_t ByteOrder = 0x01020304;
+
+struct Header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t numSections;
+    uint64_t indexOffset;
+};
+
+enum EntryKind : uint8_t
+{
+    TextEntry = 0,
+    ArrayEntry = 1,
+};
+
+/** Element classes, kept in the upper half of an element type. */
+enum ElemClass : uint8_t
+{
+    SignedElem = 1,
+    UnsignedElem = 2,
+    FloatElem = 3,
+    BoolElem = 4,
+};
+
+static_assert(sizeof(bool) == 1, "bools are stored as single bytes");
+
+/** Whether arrays of T are stored as raw elements. */
+template <class T>
+constexpr bool IsRaw = (std::is_integral_v<T> && sizeof(T) <= 8) ||
+    std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+/**
+ * The element type of T, its class and its size in bytes, or 0 if
+ * arrays of T are kept as text.
+ */
+template <class T>
+constexpr uint8_t
+elemType()
+{
+    if constexpr (!IsRaw<T>) {
+        return 0;
+    } else {
+        uint8_t cls = std::is_same_v<T, bool> ? BoolElem :
+            std::is_floating_point_v<T> ? FloatElem :
+            std::is_signed_v<T> ? SignedElem : UnsignedElem;
+        return (cls << 4) | sizeof(T);
+    }
+}
+
+constexpr unsigned elemSize(uint8_t type) { return type & 0xf; }
+
+} // namespace binary_checkpoint
+
+/**
+ * A checkpoint file in the binary format. It is an ostream so it can be
+ * handed to serialize() like an INI checkpoint: paramOut() and friends
+ * find it with get() and store structured entries. Text written to the
+ * stream directly is parsed as INI lines, so code that does its own
+ * formatting still ends up in the right section.
+ */
+class BinaryCheckpointOut : public std::ostream
+{
+  public:
+    BinaryCheckpointOut(const std::string &filename);
+    ~BinaryCheckpointOut();
+
+    /** @return The binary checkpoint os is, or nullptr for INI text. */
+    static BinaryCheckpointOut *
+    get(std::ostream &os)
+    {
+        return static_cast<BinaryCheckpointOut *>(os.pword(pwordIndex));
+    }
+
+    /** Start a new section, which later entries go into. */
+    void section(const std::string &name);
+
+    /**
+     * Add a text entry. The value is written to the stream returned by
+     * beginEntry(), and the entry is complete when endEntry() is called.
+     */
+    std::ostream &beginEntry();
+    void endEntry(const std::string &name);
+
+    /** Add an array entry of count elements of the given type. */
+    void array(const std::string &name, uint8_t type, const void *data,
+               uint64_t count);
+
+    /** Write the index and close the file. */
+    void close();
+
+  private:
+    void
+    put(const void *data, uint64_t len)
+    {
+        buf.append((const char *)data, len);
+    }
+    void putString(const std::string &str);
+    void putName(uint8_t kind, const std::string &name);
+    void flushSection();
+    void flushText();
+
+    static const int pwordIndex;
+
+    std::ofstream file;
+    const std::string filename;
+
+    /** Text written to the stream directly. */
+    std::stringbuf direct;
+    /** Scratch stream for the value of a text entry. */
+    std::ostringstream value;
+
+    /** Entries of the section being written. */
+    std::string buf;
+    std::string current;
+    bool inSection = false;
+
+    struct IndexEntry
+    {
+        std::string name;
+        uint64_t offset;
+        uint64_t length;
+    };
+    std::vector<IndexEntry> index;
+    uint64_t offset;
+};
+
+/**
+ * The reading side of the binary format, used by CheckpointIn in place
+ * of an IniFile. The index is read when the file is loaded, and each
+ * section the first time it is looked up.
+ */
+class BinaryCheckpointIn
+{
+  public:
+    struct Entry
+    {
+        binary_checkpoint::EntryKind kind;
+        uint8_t type;
+        uint64_t count;
+        /** The text, or the raw elements of an array. */
+        std::string data;
+    };
+
+    /** @return Whether filename starts like a binary checkpoint. */
+    static bool isBinary(const std::string &filename);
+
+    bool load(const std::string &filename);
+
+    /** Look an entry up, formatting arrays as INI text. */
+    bool find(const std::string &section, const std::string &entry,
+              std::string &value);
+    /** @return An entry, or nullptr if there is no such entry. */
+    const Entry *findEntry(const std::string &section,
+                           const std::string &entry);
+    bool entryExists(const std::string &section, const std::string &entry);
+    bool sectionExists(const std::string &section);
+    void visitSection(const std::string &section,
+                      IniFile::VisitSectionCallback cb);
+
+    /** @return The names of all sections, in file order. */
+    const std::vector<std::string> &sectionNames() const { return names; }
+
+    /** Format an entry the way the INI format would hold it. */
+    static std::string text(const Entry &entry);
+
+  private:
+    struct Section
+    {
+        std::vector<std::pair<uint64_t, uint64_t>> extents;
+        bool loaded = false;
+        std::vector<std::pair<std::string, Entry>> entries;
+        std::unordered_map<std::string, size_t> byName;
+    };
+
+    Section *getSection(const std::string &name);
+
+    std::ifstream file;
+    std::string filename;
+    std::unordered_map<std::string, Section> sections;
+    std::vector<std::string> names;
+};
+
+} // namespace gem5
+
+#endif // __SIM_SERIALIZE_BINARY_HH__
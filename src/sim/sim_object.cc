@@ -30,6 +30,7 @@
 #include "sim/sim_object.hh"
 
 #include <cassert>
+#include <memory>
 
 #include "base/logging.hh"
 #include "base/match.hh"
@@ -131,8 +132,9 @@ SimObject::getPort(const std::string &if_name, PortID idx)
 void
 SimObject::serializeAll(const std::string &cpt_dir)
 {
-    std::ofstream cp;
-    Serializable::generateCheckpointOut(cpt_dir, cp);
+    std::unique_ptr<CheckpointOut> cpt =
+        Serializable::generateCheckpointOut(cpt_dir);
+    CheckpointOut &cp = *cpt;
 
     SimObjectList::reverse_iterator ri = simObjectList.rbegin();
     SimObjectList::reverse_iterator rend = simObjectList.rend();
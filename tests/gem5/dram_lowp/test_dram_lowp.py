@@ -49,3 +49,21 @@ gem5_verify_config(
     valid_isas=(constants.all_compiled_tag,),
     valid_hosts=constants.supported_hosts,
 )
+
+# Run the same traffic with and without skip_idle_refresh. The script
+# exits with an error if any of the DRAM stats differ.
+for page_policy in ("open", "open_adaptive", "close", "close_adaptive"):
+    for powerdown in (False, True):
+        gem5_verify_config(
+            name="test-idle_refresh-%s%s"
+            % (page_policy, "-powerdown" if powerdown else ""),
+            fixtures=(),
+            verifiers=(),
+            config=joinpath(
+                config.base_dir, "configs", "dram", "idle_refresh.py"
+            ),
+            config_args=["-p", page_policy]
+            + (["--powerdown"] if powerdown else []),
+            valid_isas=(constants.all_compiled_tag,),
+            valid_hosts=constants.supported_hosts,
+        )
@@ -0,0 +1,99 @@
+# Copyright (c) 2026 The gem5 Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+import unittest
+
+from m5.stats.selector import StatSelector
+
+
+class StatSelectorTestSuite(unittest.TestCase):
+    """Test cases for include/exclude stat selection"""
+
+    def test_empty(self):
+        sel = StatSelector()
+        self.assertFalse(sel)
+        self.assertTrue(sel.enter_group("system", False))
+        self.assertTrue(sel.select_stat("system.cpu.ipc", False))
+
+    def test_include_stat(self):
+        sel = StatSelector(include=["system.cpu.ipc"])
+        self.assertTrue(sel)
+        self.assertFalse(sel.enter_group("system", False))
+        self.assertFalse(sel.enter_group("system.cpu", False))
+        self.assertIsNone(sel.enter_group("system.cpu.dcache", False))
+        self.assertIsNone(sel.enter_group("system.mem_ctrl", False))
+        self.assertTrue(sel.select_stat("system.cpu.ipc", False))
+        self.assertFalse(sel.select_stat("system.cpu.cpi", False))
+        self.assertFalse(sel.select_stat("simSeconds", False))
+
+    def test_include_group(self):
+        sel = StatSelector(include=["system.ruby.tcp_cntrl*"])
+        self.assertFalse(sel.enter_group("system", False))
+        self.assertFalse(sel.enter_group("system.ruby", False))
+        self.assertIsNone(sel.enter_group("system.ruby.l1_cntrl0", False))
+        self.assertIsNone(sel.enter_group("system.cpu", False))
+        self.assertTrue(sel.enter_group("system.ruby.tcp_cntrl3", False))
+        # Everything below an included group is included.
+        self.assertTrue(
+            sel.enter_group("system.ruby.tcp_cntrl3.L1cache", True)
+        )
+        self.assertTrue(sel.select_stat("system.ruby.tcp_cntrl3.x.y", True))
+        self.assertFalse(sel.select_stat("system.ruby.numRequests", False))
+
+    def test_wildcard_prefix(self):
+        # Patterns starting with a wildcard cannot prune anything.
+        sel = StatSelector(include=["*.L1cache.*"])
+        self.assertFalse(sel.enter_group("system", False))
+        self.assertFalse(sel.enter_group("system.cpu", False))
+        self.assertTrue(sel.select_stat("system.tcp.L1cache.hits", False))
+        self.assertFalse(sel.select_stat("system.tcp.L2cache.hits", False))
+
+    def test_exclude(self):
+        sel = StatSelector(exclude=["system.cpu*", "*.power_state.*"])
+        self.assertTrue(sel)
+        self.assertIsNone(sel.enter_group("system.cpu", False))
+        self.assertIsNone(sel.enter_group("system.cpu1", False))
+        self.assertTrue(sel.enter_group("system.l2", False))
+        self.assertTrue(sel.select_stat("system.l2.hits", True))
+        self.assertFalse(
+            sel.select_stat("system.l2.power_state.numTransitions", True)
+        )
+
+    def test_include_and_exclude(self):
+        sel = StatSelector(
+            include=["system.ruby.*"], exclude=["system.ruby.*.delayHist"]
+        )
+        self.assertTrue(sel.select_stat("system.ruby.l1.hits", False))
+        self.assertFalse(sel.select_stat("system.ruby.l1.delayHist", False))
+        self.assertIsNone(sel.enter_group("system.ruby.l1.delayHist", True))
+        self.assertFalse(sel.select_stat("system.cpu.ipc", False))
+
+    def test_brackets(self):
+        sel = StatSelector(include=["system.cpu[02].ipc"])
+        self.assertFalse(sel.enter_group("system", False))
+        self.assertTrue(sel.select_stat("system.cpu0.ipc", False))
+        self.assertTrue(sel.select_stat("system.cpu2.ipc", False))
+        self.assertFalse(sel.select_stat("system.cpu1.ipc", False))
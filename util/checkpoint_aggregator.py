@@ -29,7 +29,9 @@
 import gzip
 import os
 import re
+import struct
 import sys
+import zlib
 from configparser import ConfigParser
 
 
@@ -41,6 +43,35 @@ class myCP(ConfigParser):
         return optionstr
 
 
+def store_pages(path, fmt):
+    """Yield the contents of a memory store file 4KiB at a time."""
+    if fmt == "gzip":
+        with gzip.open(path, "rb") as gf:
+            while True:
+                page = gf.read(1 << 12)
+                if not page:
+                    return
+                yield page
+
+    # The chunked format, see src/mem/store_checkpoint.hh
+    with open(path, "rb") as f:
+        header = struct.unpack("=8sIIQQQ", f.read(40))
+        _, _, chunk_size, size, num_chunks, index_offset = header
+        f.seek(index_offset)
+        index = [struct.unpack("=QII", f.read(16)) for _ in range(num_chunks)]
+        for i, (offset, length, kind) in enumerate(index):
+            chunk_len = min(chunk_size, size - i * chunk_size)
+            if kind == 0:
+                data = bytes(chunk_len)
+            else:
+                f.seek(offset)
+                data = f.read(length)
+                if kind == 2:
+                    data = zlib.decompress(data)
+            for p in range(0, chunk_len, 1 << 12):
+                yield data[p : p + (1 << 12)]
+
+
 def aggregate(output_dir, cpts, no_compress, memory_size):
     merged_config = None
     page_ptr = 0
@@ -101,12 +132,12 @@ def aggregate(output_dir, cpts, no_compress, memory_size):
         page_ptr = page_ptr + pages
         print("pages to be read: ", pages)
 
-        f = open(cpts[i] + "/system.physmem.store0.pmem", "rb")
-        gf = gzip.GzipFile(fileobj=f, mode="rb")
+        fmt = config.get("system.physmem.store0", "format", fallback="gzip")
+        gf = store_pages(cpts[i] + "/system.physmem.store0.pmem", fmt)
 
         x = 0
         while x < pages:
-            bytesRead = gf.read(1 << 12)
+            bytesRead = next(gf, b"")
             if not no_compress:
                 merged_mem.write(bytesRead)
             else:
@@ -114,7 +145,6 @@ def aggregate(output_dir, cpts, no_compress, memory_size):
             x += 1
 
         gf.close()
-        f.close()
 
     merged_config.add_section("system")
     merged_config.set("system", "pagePtr", page_ptr)
@@ -138,6 +168,7 @@ def aggregate(output_dir, cpts, no_compress, memory_size):
     merged_config.set(
         "system.physmem.store0", "range_size", page_ptr * 4 * 1024
     )
+    merged_config.set("system.physmem.store0", "format", "gzip")
 
     merged_config.add_section("Globals")
     merged_config.set("Globals", "curTick", max_curtick)
@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026 The gem5 Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Convert an m5.cpt between the INI text format and the binary section
+# format (see src/sim/serialize_binary.hh), e.g. to look at or edit a
+# binary checkpoint, or to run cpt_upgrader.py on it.
+#
+# Usage: cpt_convert.py <input m5.cpt> <output m5.cpt>
+#
+# The direction is picked from the input. Raw arrays are written to INI
+# as gem5 would have formatted them. Entries read from INI are all kept
+# as text, which gem5 parses just like the INI format when restoring.
+
+import argparse
+import struct
+import sys
+from collections import OrderedDict
+
+MAGIC = b"gem5cpt\0"
+VERSION = 1
+BYTE_ORDER = 0x01020304
+HEADER = struct.Struct("=8sIIQQ")
+
+TEXT_ENTRY = 0
+ARRAY_ENTRY = 1
+
+# Element types, an element class in the upper four bits and the size
+# in bytes in the lower four
+SIGNED, UNSIGNED, FLOAT, BOOL = 1, 2, 3, 4
+ELEM_FORMATS = {
+    SIGNED: {1: "b", 2: "h", 4: "i", 8: "q"},
+    UNSIGNED: {1: "B", 2: "H", 4: "I", 8: "Q"},
+    FLOAT: {4: "f", 8: "d"},
+    BOOL: {1: "?"},
+}
+
+
+def show(cls, value):
+    """Format an element the way gem5's ShowParam would."""
+    if cls == BOOL:
+        return "true" if value else "false"
+    if cls == FLOAT:
+        return "%g" % value
+    return str(value)
+
+
+def is_binary(path):
+    with open(path, "rb") as f:
+        return f.read(len(MAGIC)) == MAGIC
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def get(self, fmt):
+        values = struct.unpack_from("=" + fmt, self.data, self.pos)
+        self.pos += struct.calcsize("=" + fmt)
+        return values
+
+    def get_bytes(self, length):
+        if self.pos + length > len(self.data):
+            raise ValueError("truncated checkpoint")
+        value = self.data[self.pos : self.pos + length]
+        self.pos += length
+        return value
+
+    def get_string(self):
+        (length,) = self.get("I")
+        return self.get_bytes(length).decode()
+
+
+def read_binary(path):
+    """Return the sections of a binary checkpoint as INI text."""
+    with open(path, "rb") as f:
+        data = f.read()
+    magic, version, byte_order, num_sections, index_offset = (
+        HEADER.unpack_from(data)
+    )
+    if byte_order != BYTE_ORDER:
+        sys.exit(f"{path} was written on a host of another byte order")
+    if version != VERSION:
+        sys.exit(f"{path} has unsupported binary version {version}")
+
+    sections = OrderedDict()
+    index = Reader(data[index_offset:])
+    for _ in range(num_sections):
+        name = index.get_string()
+        offset, length = index.get("QQ")
+        entries = sections.setdefault(name, OrderedDict())
+        sec = Reader(data[offset : offset + length])
+        while sec.pos < length:
+            (kind,) = sec.get("B")
+            entry = sec.get_string()
+            if kind == TEXT_ENTRY:
+                (text_len,) = sec.get("Q")
+                entries[entry] = sec.get_bytes(text_len).decode()
+            elif kind == ARRAY_ENTRY:
+                elem_type, count = sec.get("BQ")
+                cls, size = elem_type >> 4, elem_type & 0xF
+                fmt = ELEM_FORMATS[cls][size]
+                values = struct.unpack(
+                    f"={count}{fmt}", sec.get_bytes(count * size)
+                )
+                entries[entry] = " ".join(show(cls, v) for v in values)
+            else:
+                sys.exit(f"{path}: corrupt section {name}")
+    return sections
+
+
+def read_ini(path):
+    """Read an INI checkpoint with the rules of gem5's IniFile."""
+    sections = OrderedDict()
+    entries = None
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line:
+                continue
+            if line[0] == "[" and line[-1] == "]":
+                entries = sections.setdefault(
+                    line[1:-1].strip(), OrderedDict()
+                )
+                continue
+            if entries is None:
+                continue
+            name, eq, value = line.partition("=")
+            if not eq:
+                sys.exit(f"{path}: can't parse line {line}")
+            if name.endswith("+"):
+                name = name[:-1].strip()
+                entries[name] = entries.get(name, "") + " " + value.strip()
+            else:
+                entries[name.strip()] = value.strip()
+    return sections
+
+
+def write_ini(path, sections):
+    with open(path, "w") as f:
+        f.write("## checkpoint converted from the binary format\n")
+        for name, entries in sections.items():
+            f.write(f"\n[{name}]\n")
+            for entry, value in entries.items():
+                f.write(f"{entry}={value}\n")
+
+
+def write_binary(path, sections):
+    def string(s):
+        b = s.encode()
+        return struct.pack("=I", len(b)) + b
+
+    with open(path, "wb") as f:
+        f.write(b"\0" * HEADER.size)
+        offset = HEADER.size
+        index = []
+        for name, entries in sections.items():
+            body = bytearray()
+            for entry, value in entries.items():
+                text = value.encode()
+                body += struct.pack("=B", TEXT_ENTRY) + string(entry)
+                body += struct.pack("=Q", len(text)) + text
+            f.write(body)
+            index.append(string(name) + struct.pack("=QQ", offset, len(body)))
+            offset += len(body)
+        f.write(b"".join(index))
+        f.seek(0)
+        f.write(
+            HEADER.pack(MAGIC, VERSION, BYTE_ORDER, len(sections), offset)
+        )
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert an m5.cpt between the INI and binary formats"
+    )
+    parser.add_argument("input", help="m5.cpt to read")
+    parser.add_argument("output", help="m5.cpt to write")
+    args = parser.parse_args()
+
+    if is_binary(args.input):
+        write_ini(args.output, read_binary(args.input))
+    else:
+        write_binary(args.output, read_ini(args.input))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,465 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026 The gem5 Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Reader for gem5 binary stat files (bin://stats.bin).
+
+The file layout is described in src/base/stats/binary.hh: a file header,
+then a sequence of schema and snapshot blocks. Each snapshot holds the
+tick of a dump and one double per column of the most recent schema.
+
+Library usage:
+
+    from binstats import BinaryStats
+
+    stats = BinaryStats("m5out/stats.bin")
+    for dump in stats.dumps():
+        print(dump.tick, dump["system.cpu.ipc"])
+
+    # One value per dump, e.g., to plot a time series.
+    ticks, ipc = stats.series("system.cpu.ipc")
+
+The snapshot values are zero-copy views into the memory-mapped file. If
+numpy is available, BinaryStats.table() returns the snapshots sharing a
+schema as a [dumps x columns] array without copying.
+
+Command line usage:
+
+    binstats.py stats.bin               # convert to text on stdout
+    binstats.py stats.bin -o stats.txt  # convert to a text file
+    binstats.py stats.bin --list        # list the stats in the file
+"""
+
+import argparse
+import math
+import mmap
+import struct
+import sys
+from collections import namedtuple
+
+MAGIC = b"gem5stat"
+VERSION = 1
+BYTE_ORDER_MARK = 0x01020304
+
+SCHEMA_BLOCK = 1
+SNAPSHOT_BLOCK = 2
+
+SCALAR = 0
+VECTOR = 1
+DIST = 2
+VECTOR_ROW = 3
+
+# Fixed columns of a distribution entry, followed by its buckets.
+DIST_FIELDS = (
+    "samples",
+    "sum",
+    "squares",
+    "logs",
+    "min_val",
+    "max_val",
+    "underflow",
+    "overflow",
+    "min",
+    "max",
+    "bucket_size",
+)
+
+# DistType in src/base/stats/types.hh
+DEVIATION, DIST_TYPE, HIST = range(3)
+
+# Flags in src/base/stats/info.hh
+FLAG_TOTAL = 0x0010
+FLAG_PDF = 0x0020
+FLAG_CDF = 0x0040
+FLAG_NOZERO = 0x0100
+FLAG_NONAN = 0x0200
+
+Entry = namedtuple(
+    "Entry",
+    "kind dist_type flags precision num_cols name desc unit separator "
+    "labels first_col",
+)
+
+
+class Schema:
+    """The stats of a sequence of dumps and their column ranges."""
+
+    def __init__(self, entries, num_cols):
+        self.entries = entries
+        self.num_cols = num_cols
+        self.by_name = {e.name: e for e in entries}
+
+
+class Dump:
+    """The values of one stat dump."""
+
+    def __init__(self, tick, schema, values):
+        self.tick = tick
+        self.schema = schema
+        self.values = values
+
+    def __getitem__(self, name):
+        """The value of a scalar, or the list of values of any other stat."""
+        entry = self.schema.by_name[name]
+        first = entry.first_col
+        vals = self.values[first : first + entry.num_cols]
+        return vals[0] if entry.kind == SCALAR else list(vals)
+
+
+class BinaryStats:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self._map = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        self._buf = memoryview(self._map)
+
+        if len(self._buf) < 16 or bytes(self._buf[:8]) != MAGIC:
+            raise ValueError(f"{path} is not a gem5 binary stat file")
+        for order in "<>":
+            version, bom = struct.unpack_from(order + "II", self._buf, 8)
+            if bom == BYTE_ORDER_MARK:
+                self._order = order
+                break
+        else:
+            raise ValueError(f"{path}: unknown byte order")
+        if version != VERSION:
+            raise ValueError(f"{path}: unsupported version {version}")
+
+        # List of (schema, [snapshot offsets]).
+        self.segments = []
+        self._index()
+
+    def _index(self):
+        pos = 16
+        end = len(self._buf)
+        while pos + 16 <= end:
+            kind, _, size = struct.unpack_from(
+                self._order + "IIQ", self._buf, pos
+            )
+            payload = pos + 16
+            if payload + size > end:
+                # Truncated by a dump in progress or a crash.
+                break
+            if kind == SCHEMA_BLOCK:
+                self.segments.append((self._parse_schema(payload), []))
+            elif kind == SNAPSHOT_BLOCK:
+                if not self.segments:
+                    raise ValueError("snapshot before schema")
+                self.segments[-1][1].append(payload)
+            pos = payload + size
+
+    def _parse_schema(self, pos):
+        order = self._order
+        buf = self._buf
+
+        def get(fmt):
+            nonlocal pos
+            vals = struct.unpack_from(order + fmt, buf, pos)
+            pos += struct.calcsize(order + fmt)
+            return vals
+
+        def get_str():
+            nonlocal pos
+            (length,) = get("I")
+            s = bytes(buf[pos : pos + length]).decode("utf-8")
+            pos += length
+            return s
+
+        num_cols, num_entries = get("QQ")
+        entries = []
+        col = 0
+        for _ in range(num_entries):
+            kind, dist_type, flags, precision, ncols, nlabels = get("BBHiII")
+            name = get_str()
+            desc = get_str()
+            unit = get_str()
+            sep = get_str()
+            labels = [get_str() for _ in range(nlabels)]
+            entries.append(
+                Entry(
+                    kind,
+                    dist_type,
+                    flags,
+                    precision,
+                    ncols,
+                    name,
+                    desc,
+                    unit,
+                    sep,
+                    labels,
+                    col,
+                )
+            )
+            col += ncols
+        assert col == num_cols
+        return Schema(entries, num_cols)
+
+    def _snapshot(self, schema, pos):
+        (tick,) = struct.unpack_from(self._order + "Q", self._buf, pos)
+        values = self._buf[pos + 8 : pos + 8 + 8 * schema.num_cols]
+        if self._order == ("<" if sys.byteorder == "little" else ">"):
+            values = values.cast("d")
+        else:
+            values = struct.unpack(
+                f"{self._order}{schema.num_cols}d", values
+            )
+        return Dump(tick, schema, values)
+
+    def dumps(self):
+        """Iterate over all dumps in the file, in order."""
+        for schema, offsets in self.segments:
+            for pos in offsets:
+                yield self._snapshot(schema, pos)
+
+    def series(self, name):
+        """Ticks and values of a stat for every dump that contains it."""
+        ticks = []
+        values = []
+        for dump in self.dumps():
+            if name in dump.schema.by_name:
+                ticks.append(dump.tick)
+                values.append(dump[name])
+        return ticks, values
+
+    def table(self, segment=0):
+        """The snapshots of a segment as numpy arrays (ticks, values).
+
+        values has one row per dump and one column per schema column. Both
+        arrays are views of the memory-mapped file.
+        """
+        import numpy as np
+
+        schema, offsets = self.segments[segment]
+        if not offsets:
+            return np.empty(0, np.uint64), np.empty((0, schema.num_cols))
+        stride = 16 + 8 + 8 * schema.num_cols
+        dt = np.dtype(self._order + "f8")
+        base = offsets[0]
+        ticks = np.ndarray(
+            (len(offsets),),
+            np.dtype(self._order + "u8"),
+            self._map,
+            base,
+            (stride,),
+        )
+        values = np.ndarray(
+            (len(offsets), schema.num_cols),
+            dt,
+            self._map,
+            base + 8,
+            (stride, 8),
+        )
+        return ticks, values
+
+
+def _value_str(value, precision):
+    if math.isnan(value):
+        return "nan"
+    if precision == -1:
+        precision = 0 if value == round(value) else 6
+    return f"{value:.{precision}f}"
+
+
+class TextWriter:
+    """Render dumps in the format of the text stat output."""
+
+    def __init__(self, out, desc=True, spaces=True):
+        self.out = out
+        self.desc = desc
+        self.spaces = spaces
+
+    def _line(self, entry, name, value, desc=None, pdf=None, cdf=None):
+        if (entry.flags & FLAG_NOZERO and value == 0.0) or (
+            entry.flags & FLAG_NONAN and math.isnan(value)
+        ):
+            return
+        w = (40, 12, 10) if self.spaces else (0, 0, 0)
+        line = f"{name:<{w[0]}} {_value_str(value, entry.precision):>{w[1]}}"
+        pdfstr = "" if pdf is None else f"{pdf * 100:.2f}%"
+        cdfstr = "" if cdf is None else f"{cdf * 100:.2f}%"
+        if self.spaces or pdfstr:
+            line += f" {pdfstr:>{w[2]}}"
+        if self.spaces or cdfstr:
+            line += f" {cdfstr:>{w[2]}}"
+        desc = entry.desc if desc is None else desc
+        if self.desc and desc:
+            line += f" # {desc}"
+        if self.desc and entry.unit:
+            line += f" ({entry.unit})"
+        self.out.write(line + "\n")
+
+    def _vector(self, entry, vals):
+        base = entry.name + entry.separator
+        labels = entry.labels
+        havesub = any(labels)
+        if len(vals) == 1:
+            name = entry.name
+            if entry.kind == VECTOR_ROW:
+                name = base + (labels[0] if havesub else "0")
+            self._line(entry, name, vals[0])
+            return
+
+        total = sum(vals)
+        pdf_total = total if entry.flags & (FLAG_PDF | FLAG_CDF) else 0
+        if not entry.flags & FLAG_NOZERO or total != 0:
+            cdf = 0.0
+            for i, v in enumerate(vals):
+                if havesub and not labels[i]:
+                    continue
+                pdf = cdf_val = None
+                if pdf_total:
+                    pdf = v / pdf_total
+                    cdf += pdf
+                    cdf_val = cdf
+                name = base + (labels[i] if havesub else str(i))
+                self._line(entry, name, v, pdf=pdf, cdf=cdf_val)
+        if entry.flags & FLAG_TOTAL:
+            self._line(entry, base + "total", total)
+
+    def _dist(self, entry, vals):
+        d = dict(zip(DIST_FIELDS, vals))
+        buckets = vals[len(DIST_FIELDS) :]
+        samples = d["samples"]
+        if entry.flags & FLAG_NOZERO and samples == 0:
+            return
+        base = entry.name + entry.separator
+        nan = float("nan")
+
+        self._line(entry, base + "samples", samples)
+        mean = d["sum"] / samples if samples else nan
+        self._line(entry, base + "mean", mean)
+        if entry.dist_type == HIST:
+            self._line(
+                entry,
+                base + "gmean",
+                math.exp(d["logs"] / samples) if samples else nan,
+            )
+        stdev = nan
+        if samples:
+            try:
+                stdev = math.sqrt(
+                    (samples * d["squares"] - d["sum"] * d["sum"])
+                    / (samples * (samples - 1.0))
+                )
+            except (ValueError, ZeroDivisionError):
+                stdev = nan
+        self._line(entry, base + "stdev", stdev)
+        if entry.dist_type == DEVIATION:
+            return
+
+        is_dist = entry.dist_type == DIST_TYPE
+        total = sum(buckets)
+        if is_dist:
+            total += d["underflow"] + d["overflow"]
+        cdf = 0.0
+
+        def frac(v):
+            nonlocal cdf
+            if not total:
+                return None, None
+            cdf += v / total
+            return v / total, cdf
+
+        if is_dist:
+            pdf, cdf_val = frac(d["underflow"])
+            self._line(
+                entry,
+                base + "underflows",
+                d["underflow"],
+                pdf=pdf,
+                cdf=cdf_val,
+            )
+        for i, v in enumerate(buckets):
+            low = i * d["bucket_size"] + d["min"]
+            high = min(low + d["bucket_size"] - 1.0, d["max"])
+            label = f"{low:g}" + (f"-{high:g}" if low < high else "")
+            pdf, cdf_val = frac(v)
+            self._line(entry, base + label, v, pdf=pdf, cdf=cdf_val)
+        if is_dist:
+            pdf, cdf_val = frac(d["overflow"])
+            self._line(
+                entry, base + "overflows", d["overflow"], pdf=pdf, cdf=cdf_val
+            )
+            self._line(entry, base + "min_value", d["min_val"])
+            self._line(entry, base + "max_value", d["max_val"])
+        self._line(entry, base + "total", total)
+
+    def write(self, dump):
+        self.out.write(
+            "\n---------- Begin Simulation Statistics ----------\n"
+        )
+        for entry in dump.schema.entries:
+            first = entry.first_col
+            vals = dump.values[first : first + entry.num_cols]
+            if entry.kind == SCALAR:
+                self._line(entry, entry.name, vals[0])
+            elif entry.kind in (VECTOR, VECTOR_ROW):
+                self._vector(entry, list(vals))
+            elif entry.kind == DIST:
+                self._dist(entry, list(vals))
+        self.out.write(
+            "\n---------- End Simulation Statistics   ----------\n"
+        )
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Read gem5 binary stat files and convert them to text."
+    )
+    parser.add_argument("file", help="binary stat file")
+    parser.add_argument(
+        "-o", "--output", default="-", help="text output file (default: -)"
+    )
+    parser.add_argument(
+        "--list", action="store_true", help="list the stats in the file"
+    )
+    parser.add_argument(
+        "--no-desc", action="store_true", help="omit stat descriptions"
+    )
+    parser.add_argument(
+        "--no-spaces", action="store_true", help="omit alignment spaces"
+    )
+    args = parser.parse_args()
+
+    stats = BinaryStats(args.file)
+    out = sys.stdout if args.output == "-" else open(args.output, "w")
+
+    if args.list:
+        for schema, offsets in stats.segments:
+            out.write(f"# {len(offsets)} dumps, {schema.num_cols} columns\n")
+            for e in schema.entries:
+                last = e.first_col + e.num_cols
+                out.write(f"{e.name} [{e.first_col}:{last}]\n")
+        return
+
+    writer = TextWriter(out, desc=not args.no_desc, spaces=not args.no_spaces)
+    for dump in stats.dumps():
+        writer.write(dump)
+
+
+if __name__ == "__main__":
+    main()